@@ -20,6 +20,7 @@
 #define AS5048B_MAX_DEVICES     2
 #define MAX_I2C_ADDR           127
 #define AS5048B_DEFAULT_ADDR   0x40U  /* Default 7-bit I2C address */
+#define AS5048B_I2C_TIMEOUT_MS 5U     /* Longest transfer is 6 bytes, ~1 ms at 100 kHz */
 
 /* AS5048B Register Addresses ----------------------------------------------*/
 enum {
@@ -120,6 +121,17 @@ HAL_StatusTypeDef AS5048B_SetZeroPosition(AS5048B_Driver_t *driver,
 HAL_StatusTypeDef AS5048B_UpdateRegisters(AS5048B_Driver_t *driver,
 									      uint8_t num_encoder);
 
+/**
+ * @brief Write a known zero position into the (volatile) zero position registers
+ * @param driver       Pointer to driver struct
+ * @param num_encoder  Index in driver->devices[]
+ * @param position     14-bit zero position
+ * @return HAL status
+ */
+HAL_StatusTypeDef AS5048B_WriteZeroPosition(AS5048B_Driver_t *driver,
+                                            uint8_t num_encoder,
+                                            uint16_t position);
+
 /**
  * @brief Get angle in degrees for given encoder
  * @param driver       Pointer to driver struct
@@ -129,6 +141,27 @@ HAL_StatusTypeDef AS5048B_UpdateRegisters(AS5048B_Driver_t *driver,
 float AS5048B_GetAngleDegrees(AS5048B_Driver_t *driver,
                               uint8_t num_encoder);
 
+/**
+ * @brief Decode the angle registers (0xFE, 0xFF) into the register cache
+ * @note  Used by AS5048B_GetAngleDegrees() and to replay recorded reads
+ * @param driver       Pointer to driver struct
+ * @param num_encoder  Index in driver->devices[]
+ * @param data         Contents of registers 0xFE and 0xFF
+ * @return Angle [0..360)
+ */
+float AS5048B_ProcessAngle(AS5048B_Driver_t *driver,
+                           uint8_t num_encoder,
+                           const uint8_t data[2]);
+
+/**
+ * @brief Get the cached 14-bit angle of given encoder
+ * @param driver       Pointer to driver struct
+ * @param num_encoder  Index in driver->devices[]
+ * @return Raw angle [0..16383]
+ */
+uint16_t AS5048B_GetRawAngle(AS5048B_Driver_t *driver,
+                             uint8_t num_encoder);
+
 /**
  * @brief Get angle in radians for given encoder
  * @param driver       Pointer to driver struct
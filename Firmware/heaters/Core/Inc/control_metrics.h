@@ -0,0 +1,83 @@
+/**
+ * @file      control_metrics.h
+ * @author    Adrian Silva Palafox
+ * @brief     Closed-loop step response scoring for heater zones
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Accumulates, sample by sample, the figures used to compare PID
+ *            gain sets on a setpoint step: rise time, settling time, overshoot,
+ *            steady-state ripple, integral of absolute error (IAE) and heater
+ *            energy. Gain sets can then be ranked with ControlMetrics_Dominates()
+ *            to keep only the Pareto optimal ones. Gains picked this way are
+ *            stored per zone through ParamStore_SetZone().
+ *
+ * @note      No HAL dependency: the same code scores runs on the machine and
+ *            runs against the barrel thermal model.
+ */
+
+#ifndef INC_CONTROL_METRICS_H_
+#define INC_CONTROL_METRICS_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Step response figures of one zone
+ */
+typedef struct {
+    float setpoint;      /**< Target temperature [°C] */
+    float start;         /**< Temperature when the step was applied [°C] */
+    float band;          /**< Half-width of the settling band [°C] */
+    float elapsed;       /**< Time since the step [s] */
+    float iae;           /**< Integral of |error| [°C s] */
+    float energy;        /**< Integral of heater command [% s] */
+    float peak;          /**< Highest temperature in the step direction [°C] */
+    float overshoot;     /**< Peak beyond the setpoint [°C], 0 if none */
+    float settling_time; /**< Time the error last left the band [s] */
+    float rise_start;    /**< Time 10 % of the step was reached [s], -1 before */
+    float rise_time;     /**< Time from 10 % to 90 % of the step [s], -1 before */
+    float band_min;      /**< Lowest temperature since entering the band [°C] */
+    float band_max;      /**< Highest temperature since entering the band [°C] */
+    float ripple;        /**< Peak-to-peak inside the band [°C] */
+    float max_error;     /**< Largest |error| after the rise [°C] */
+} ControlMetrics_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Start scoring a setpoint step
+ * @param   metrics     Pointer to metrics structure
+ * @param   start       Temperature at the step [°C]
+ * @param   setpoint    New setpoint [°C]
+ * @param   band        Half-width of the settling band [°C]
+ */
+void ControlMetrics_Start(ControlMetrics_t *metrics, float start, float setpoint, float band);
+
+/**
+ * @brief   Accumulate one sample
+ * @param   metrics     Pointer to metrics structure
+ * @param   temp        Measured temperature [°C]
+ * @param   command     Heater command [%]
+ * @param   dt          Time since the previous sample [s]
+ */
+void ControlMetrics_Update(ControlMetrics_t *metrics, float temp, float command, float dt);
+
+/**
+ * @brief   Check whether the response has stayed inside the band long enough
+ * @param   metrics     Pointer to metrics structure
+ * @param   hold        Time the error must stay inside the band [s]
+ * @return  uint8_t     1 once settled, 0 otherwise
+ */
+uint8_t ControlMetrics_IsSettled(const ControlMetrics_t *metrics, float hold);
+
+/**
+ * @brief   Pareto comparison of two scored runs
+ * @details a dominates b when it is no worse on settling time, overshoot, IAE
+ *          and energy, and strictly better on at least one of them.
+ * @param   a, b        Runs to compare
+ * @return  uint8_t     1 if a dominates b, 0 otherwise
+ */
+uint8_t ControlMetrics_Dominates(const ControlMetrics_t *a, const ControlMetrics_t *b);
+
+#endif /* INC_CONTROL_METRICS_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file      decoupling.h
+ * @author    Adrian Silva Palafox
+ * @brief     Static decoupling of the thermally coupled barrel zones
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Adjacent zones conduct heat to each other, so the steady-state
+ *            response to the heater commands is a full matrix:
+ *
+ *              dT = G du          G[i][j] = dT_i / du_j  [°C/%]
+ *
+ *            and a zone's PID also moves its neighbours. The decoupler sits
+ *            between the PID outputs v and the heaters:
+ *
+ *              u = D v            D = G^-1 S,  S = diag(G 1)
+ *
+ *            G D = S is diagonal, so each PID sees only its own zone and no
+ *            longer fights its neighbours after a disturbance in another
+ *            zone. Any diagonal S decouples; the row sums of G make D pass
+ *            equal PID outputs through unchanged (D 1 = 1), so heating the
+ *            whole barrel together behaves as without the decoupler and each
+ *            PID keeps the loop gain it was tuned with. Scaling by diag(G)
+ *            alone would ask the PIDs for outputs beyond 100 % when the
+ *            coupling is strong, as a zone's own gain is then small.
+ *
+ *            G comes from step tests (one column per heater: step it, wait for
+ *            every zone to settle, Decoupling_SetStep()) or from the zone
+ *            parameters (Decoupling_GainFromModel()). The decoupling is static:
+ *            it is exact in steady state and only approximate during
+ *            transients, which is where the zones' own dynamics dominate.
+ *
+ *            When the heater commands are cut after the decoupler (output
+ *            limits, power budget), Decoupling_Restore() maps what was applied
+ *            back to the PID outputs that would have produced it, so each PID
+ *            winds its integrator back by its own share of the cut.
+ *
+ *            All kernels are fixed-size 3x3, no allocation.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_DECOUPLING_H_
+#define INC_DECOUPLING_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of coupled zones
+ */
+#define DECOUPLING_ZONES    THERMAL_MODEL_ZONES
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Decoupler control structure
+ */
+typedef struct {
+    float gain[DECOUPLING_ZONES][DECOUPLING_ZONES];     /**< Steady-state gains G [°C/%] */
+    float matrix[DECOUPLING_ZONES][DECOUPLING_ZONES];   /**< Decoupler D */
+    float inverse[DECOUPLING_ZONES][DECOUPLING_ZONES];  /**< D^-1 = S^-1 G */
+    uint8_t enabled;                                    /**< D is applied */
+} Decoupling_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize as a pass-through (identity, disabled)
+ * @param   dec         Pointer to decoupler control structure
+ */
+void Decoupling_Init(Decoupling_t *dec);
+
+/**
+ * @brief   Steady-state gains of the zone model
+ * @param   dec         Pointer to decoupler control structure
+ * @param   model       Model with its zone parameters and couplings filled in
+ */
+void Decoupling_GainFromModel(Decoupling_t *dec, const ThermalModel_t *model);
+
+/**
+ * @brief   Enter one step test result as a column of G
+ * @param   dec         Pointer to decoupler control structure
+ * @param   input       Heater that was stepped
+ * @param   before      Settled zone temperatures before the step [°C]
+ * @param   after       Settled zone temperatures after the step [°C]
+ * @param   step        Command step [%]
+ */
+void Decoupling_SetStep(Decoupling_t *dec, uint8_t input, const float *before,
+                        const float *after, float step);
+
+/**
+ * @brief   Compute D from G and enable it
+ * @param   dec         Pointer to decoupler control structure
+ * @return  uint8_t     1 if enabled, 0 if G is singular (left disabled)
+ */
+uint8_t Decoupling_Compute(Decoupling_t *dec);
+
+/**
+ * @brief   Transform the PID outputs into heater commands
+ * @param   dec         Pointer to decoupler control structure
+ * @param   in          PID outputs [%]
+ * @param   out         Heater commands [%], must not alias in
+ */
+void Decoupling_Apply(const Decoupling_t *dec, const float *in, float *out);
+
+/**
+ * @brief   Transform heater commands back into the PID outputs giving them
+ * @param   dec         Pointer to decoupler control structure
+ * @param   in          Heater commands [%]
+ * @param   out         PID outputs [%], must not alias in
+ */
+void Decoupling_Restore(const Decoupling_t *dec, const float *in, float *out);
+
+#endif /* INC_DECOUPLING_H_ */
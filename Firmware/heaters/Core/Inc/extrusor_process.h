@@ -1,13 +1,192 @@
-/*
- * extrusor_process.h
+/**
+ * @file      extrusor_process.h
+ * @author    Adrian Silva Palafox
+ * @brief     Extrusion process sequencing (hierarchical state machine)
+ * @version   1.0
+ * @date      October 2026
  *
- *  Created on: Apr 24, 2025
- *      Author: adrian
+ * @details   Orchestrates heaters, screw and winder through the phases of a
+ *            production run. States are nested, a state inherits the
+ *            transitions of its parents:
+ *
+ *              IDLE
+ *              RUN                 heaters on
+ *                PREHEAT           waiting for every zone to reach its setpoint
+ *                SOAK              holding temperature until the melt is uniform
+ *                PRODUCE           screw turning, drops back to PREHEAT if a
+ *                  FEED            zone leaves the temperature band
+ *                  EXTRUDE         waiting for the filament to be threaded
+ *                  WIND            winder pulling the filament
+ *                PURGE             screw flushing the barrel
+ *              COOLDOWN            heaters off until the barrel is cold
+ *              FAULT               everything off until reset
+ *
+ *            Transitions are described by a constant rule table (state, event,
+ *            guard, target). ExtrusorProcess_Init() flattens it into a
+ *            [state][event] lookup that already includes the rules inherited
+ *            from parent states, so dispatching an event is a single table
+ *            access. Leaving a state runs the exit actions up to the common
+ *            ancestor and entering runs the entry actions down to the target,
+ *            drilling into initial substates.
+ *
+ *            Events are queued and processed run-to-completion by
+ *            ExtrusorProcess_Dispatch(). ExtrusorProcess_Tick() turns
+ *            temperatures, faults and elapsed time into events.
+ *
+ *            EXTRUDE moves on to WIND on EXTRUSOR_EV_THREADED when
+ *            thread_time is 0. Without an operator input to post it, a
+ *            non-zero thread_time gives the operator that long to thread the
+ *            filament and then starts the winder on its own.
+ *
+ * @note      No HAL dependency and no dynamic allocation. Outputs go through
+ *            callbacks so the sequence can be exercised against the thermal
+ *            model. Events must be posted from a single context (main loop).
  */
 
 #ifndef INC_EXTRUSOR_PROCESS_H_
 #define INC_EXTRUSOR_PROCESS_H_
 
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of heater zones watched by the sequence
+ */
+#define EXTRUSOR_ZONES          3
+
+/**
+ * @brief Event queue length (power of two)
+ */
+#define EXTRUSOR_QUEUE_SIZE     16U
+
+/**
+ * @brief Deepest state nesting
+ */
+#define EXTRUSOR_MAX_DEPTH      3
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Process states
+ */
+typedef enum {
+    EXTRUSOR_IDLE = 0,
+    EXTRUSOR_RUN,
+    EXTRUSOR_PREHEAT,
+    EXTRUSOR_SOAK,
+    EXTRUSOR_PRODUCE,
+    EXTRUSOR_FEED,
+    EXTRUSOR_EXTRUDE,
+    EXTRUSOR_WIND,
+    EXTRUSOR_PURGE,
+    EXTRUSOR_COOLDOWN,
+    EXTRUSOR_FAULT,
+    EXTRUSOR_STATES,
+    EXTRUSOR_NONE = EXTRUSOR_STATES /**< No parent / no initial substate */
+} ExtrusorProcess_State_t;
+
+/**
+ * @brief Process events
+ */
+typedef enum {
+    EXTRUSOR_EV_START = 0,      /**< Operator: begin a run */
+    EXTRUSOR_EV_STOP,           /**< Operator: end the run and cool down */
+    EXTRUSOR_EV_PURGE,          /**< Operator: flush the barrel */
+    EXTRUSOR_EV_THREADED,       /**< Operator: filament attached to the winder */
+    EXTRUSOR_EV_RESET,          /**< Operator: acknowledge a fault */
+    EXTRUSOR_EV_AT_TEMP,        /**< Every zone inside the band */
+    EXTRUSOR_EV_OFF_TEMP,       /**< A zone left the wider running band */
+    EXTRUSOR_EV_TIMEOUT,        /**< Time limit of the current state elapsed */
+    EXTRUSOR_EV_COLD,           /**< Every zone below the cool-down temperature */
+    EXTRUSOR_EV_FAULT,          /**< A fault bit is set */
+    EXTRUSOR_EVENTS
+} ExtrusorProcess_Event_t;
+
+/**
+ * @brief Sequence parameters
+ */
+typedef struct {
+    float band;          /**< |error| that counts as at temperature [°C] */
+    float run_band;      /**< |error| tolerated once producing [°C] */
+    float soak_time;     /**< Time held at temperature before feeding [s] */
+    float feed_time;     /**< Slow feed before full screw speed [s] */
+    float purge_time;    /**< Purge duration [s] */
+    float cool_temp;     /**< Temperature considered cold [°C] */
+    float feed_rpm;      /**< Screw speed while feeding [rpm] */
+    float screw_rpm;     /**< Production screw speed [rpm] */
+    float purge_rpm;     /**< Screw speed while purging [rpm] */
+    float winder_rpm;    /**< Puller and winder speed while winding [rpm] */
+    float thread_time;   /**< Extrusion before the winder starts [s], 0 waits for
+                              EXTRUSOR_EV_THREADED */
+} ExtrusorProcess_Config_t;
+
+/**
+ * @brief Actuator callbacks (any of them may be NULL)
+ */
+typedef struct {
+    void (*heaters)(void *ctx, uint8_t enable); /**< Heater zones on/off */
+    void (*screw)(void *ctx, float rpm);        /**< Screw speed, 0 stops */
+    void (*winder)(void *ctx, float rpm);       /**< Puller and winder speed, 0 stops */
+    void *ctx;                                  /**< Passed to every callback */
+} ExtrusorProcess_Outputs_t;
+
+/**
+ * @brief Process control structure
+ */
+typedef struct {
+    ExtrusorProcess_Config_t config;            /**< Sequence parameters */
+    ExtrusorProcess_Outputs_t outputs;          /**< Actuator callbacks */
+    uint8_t state;                              /**< Current leaf state */
+    float state_time;                           /**< Time in the current state [s] */
+    uint32_t faults;                            /**< Fault bits of the last tick */
+    uint8_t at_temp;                            /**< Every zone inside the band on the last tick */
+    uint8_t dispatch[EXTRUSOR_STATES][EXTRUSOR_EVENTS]; /**< Rule index per state and event */
+    uint8_t queue[EXTRUSOR_QUEUE_SIZE];         /**< Pending events */
+    uint8_t head;                               /**< Events posted */
+    uint8_t tail;                               /**< Events processed */
+} ExtrusorProcess_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Build the dispatch table and enter IDLE
+ * @param   process     Pointer to process control structure
+ * @param   config      Sequence parameters
+ * @param   outputs     Actuator callbacks
+ */
+void ExtrusorProcess_Init(ExtrusorProcess_t *process, const ExtrusorProcess_Config_t *config,
+                          const ExtrusorProcess_Outputs_t *outputs);
 
+/**
+ * @brief   Queue an event
+ * @param   process     Pointer to process control structure
+ * @param   event       ExtrusorProcess_Event_t
+ * @return  uint8_t     1 if queued, 0 if the queue is full
+ */
+uint8_t ExtrusorProcess_Post(ExtrusorProcess_t *process, uint8_t event);
+
+/**
+ * @brief   Generate the events due to temperatures, faults and time
+ * @param   process     Pointer to process control structure
+ * @param   setpoints   Zone setpoints [°C]
+ * @param   temps       Zone temperatures [°C]
+ * @param   faults      Active fault bits, 0 if none
+ * @param   dt          Time since the previous tick [s]
+ */
+void ExtrusorProcess_Tick(ExtrusorProcess_t *process, const float *setpoints,
+                          const float *temps, uint32_t faults, float dt);
+
+/**
+ * @brief   Process every queued event
+ * @param   process     Pointer to process control structure
+ */
+void ExtrusorProcess_Dispatch(ExtrusorProcess_t *process);
+
+/**
+ * @brief   Check whether the process is in a state or one of its substates
+ * @param   process     Pointer to process control structure
+ * @param   state       ExtrusorProcess_State_t
+ * @return  uint8_t     1 if inside the state, 0 otherwise
+ */
+uint8_t ExtrusorProcess_IsIn(const ExtrusorProcess_t *process, uint8_t state);
 
 #endif /* INC_EXTRUSOR_PROCESS_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @file      feedforward.h
+ * @author    Adrian Silva Palafox
+ * @brief     Model-based setpoint feedforward for one heater zone
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   With feedback alone a zone only starts heating harder once the
+ *            error has built up, so it lags every ramp and then overshoots
+ *            while the integrator unwinds. The zone model gives the power a
+ *            setpoint trajectory needs directly:
+ *
+ *              u_ff = 100 (h (SP - Ta) + C dSP/dt) / P    [%]
+ *
+ *            the steady-state loss at the setpoint plus the heat stored while
+ *            it rises. PID_SetFeedforward() adds it to the PID output ahead of
+ *            the output limits, so the PID only corrects what the model gets
+ *            wrong (coupling to the neighbours, screw load, parameter error).
+ *            dSP/dt comes from consecutive setpoints, so the feedforward
+ *            follows the ramps from the warm-up planner; a setpoint step only
+ *            gives a single saturated tick.
+ *
+ *            The PID integrator limits must allow negative values for the
+ *            loop to trim a model that over-estimates the loss.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_FEEDFORWARD_H_
+#define INC_FEEDFORWARD_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Feedforward control structure
+ */
+typedef struct {
+    ThermalModel_Zone_t model;  /**< Zone parameters, heat_capacity 0 = off */
+    float ambient;              /**< Ambient temperature [°C] */
+    float T;                    /**< Control period [s] */
+    float prevSetpoint;         /**< Setpoint of the previous update [°C] */
+    float out;                  /**< Last feedforward power [%] */
+    uint8_t primed;             /**< prevSetpoint holds a setpoint */
+} Feedforward_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize switched off
+ * @param   ff          Pointer to feedforward control structure
+ * @param   t           Control period [s]
+ */
+void Feedforward_Init(Feedforward_t *ff, float t);
+
+/**
+ * @brief   Set the zone model, keeping the setpoint history
+ * @param   ff          Pointer to feedforward control structure
+ * @param   model       Zone model, NULL to switch the feedforward off
+ * @param   ambient     Ambient temperature [°C]
+ */
+void Feedforward_SetModel(Feedforward_t *ff, const ThermalModel_Zone_t *model, float ambient);
+
+/**
+ * @brief   Forget the setpoint history (the next update has no ramp term)
+ * @param   ff          Pointer to feedforward control structure
+ */
+void Feedforward_Reset(Feedforward_t *ff);
+
+/**
+ * @brief   Power the setpoint trajectory needs
+ * @param   ff          Pointer to feedforward control structure
+ * @param   setpoint    Setpoint of this control period [°C]
+ * @return  float       Feedforward power [%], 0 when switched off
+ */
+float Feedforward_Update(Feedforward_t *ff, float setpoint);
+
+#endif /* INC_FEEDFORWARD_H_ */
@@ -0,0 +1,64 @@
+/**
+ * @file      flash_if.h
+ * @author    Adrian Silva Palafox
+ * @brief     Internal flash access helpers for persistent storage
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Thin layer over the HAL flash driver used by the modules that keep
+ *            data across resets. It erases whole sectors, programs word-aligned
+ *            blocks and provides the CRC used to validate stored records.
+ *
+ * @note      While a sector is being erased or a word is being programmed the
+ *            CPU stalls on any instruction fetch from flash. Sector erases take
+ *            hundreds of milliseconds, so callers must only erase when the
+ *            heaters are in a safe state (e.g. at boot).
+ */
+
+#ifndef INC_FLASH_IF_H_
+#define INC_FLASH_IF_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Value read back from an erased flash word
+ */
+#define FLASH_IF_ERASED_WORD    0xFFFFFFFFU
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Erase a single flash sector
+ * @param   sector      Sector number (FLASH_SECTOR_x)
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef FlashIf_EraseSector(uint32_t sector);
+
+/**
+ * @brief   Program a block of data into erased flash
+ * @param   address     Destination address (4-byte aligned)
+ * @param   data        Source buffer
+ * @param   len         Number of bytes to write (multiple of 4)
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef FlashIf_Program(uint32_t address, const void *data, uint32_t len);
+
+/**
+ * @brief   Check whether a flash area is fully erased
+ * @param   address     Start address (4-byte aligned)
+ * @param   len         Number of bytes to check (multiple of 4)
+ * @return  uint8_t     1 if every word reads 0xFFFFFFFF, 0 otherwise
+ */
+uint8_t FlashIf_IsErased(uint32_t address, uint32_t len);
+
+/**
+ * @brief   Compute the CRC-16/CCITT-FALSE of a buffer
+ * @param   data        Source buffer
+ * @param   len         Number of bytes
+ * @return  uint16_t    CRC value
+ */
+uint16_t FlashIf_Crc16(const void *data, uint32_t len);
+
+#endif /* INC_FLASH_IF_H_ */
@@ -0,0 +1,65 @@
+/**
+ * @file      gain_schedule.h
+ * @author    Adrian Silva Palafox
+ * @brief     PID gain scheduling on zone temperature and screw speed
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   One set of gains is a compromise: far below the setpoint during
+ *            warm-up the integral term only winds up, while at extrusion
+ *            temperature the pellets entering with the screw turning are the
+ *            main disturbance and call for a firmer loop. The table holds
+ *            multipliers of a zone's base gains (the material profile gains)
+ *            on a small temperature x screw speed grid:
+ *
+ *                         rpm[0]   rpm[1]   rpm[2]
+ *              temp[0]    s00      s01      s02
+ *              ...
+ *
+ *            GainSchedule_Lookup() interpolates bilinearly, clamping to the
+ *            edges of the grid: a short scan over a handful of breakpoints
+ *            and three bilinear blends, cheap enough for every control tick.
+ *            The caller hands the result to PID_UpdateGainsBumpless(), which
+ *            keeps the controller output continuous while the gains move with
+ *            the operating point.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_GAIN_SCHEDULE_H_
+#define INC_GAIN_SCHEDULE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "pid.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Grid size
+ */
+#define GAIN_SCHEDULE_TEMPS     4
+#define GAIN_SCHEDULE_RPMS      3
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Schedule table
+ */
+typedef struct {
+    float temp[GAIN_SCHEDULE_TEMPS];                        /**< Temperature breakpoints, ascending [°C] */
+    float rpm[GAIN_SCHEDULE_RPMS];                          /**< Screw speed breakpoints, ascending [rpm] */
+    PIDGains scale[GAIN_SCHEDULE_TEMPS][GAIN_SCHEDULE_RPMS];/**< Multipliers of the base gains */
+} GainSchedule_Table_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Gains at an operating point
+ * @param   table       Schedule table
+ * @param   base        Base gains of the zone
+ * @param   temp        Zone temperature [°C]
+ * @param   rpm         Screw speed [rpm]
+ * @return  PIDGains    Scheduled gains
+ */
+PIDGains GainSchedule_Lookup(const GainSchedule_Table_t *table, const PIDGains *base,
+                             float temp, float rpm);
+
+#endif /* INC_GAIN_SCHEDULE_H_ */
@@ -0,0 +1,140 @@
+/**
+ * @file      heater_supervisor.h
+ * @author    Adrian Silva Palafox
+ * @brief     Thermal runaway and heater fault detection
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Watches every zone independently of the PID loop and latches a
+ *            fault as soon as one of these conditions is seen:
+ *
+ *              - OPEN:      the thermocouple reports an open circuit
+ *              - STUCK:     the reading has not changed at all for stuck_time
+ *                           while the heater is on and the zone is more than
+ *                           runaway_band away from its setpoint
+ *              - NO_RISE:   the heater has been driven hard (runaway_power or
+ *                           more) below the setpoint for runaway_time without
+ *                           the temperature rising by runaway_rise, e.g. a
+ *                           thermocouple that fell out of the barrel
+ *              - OVERTEMP:  the reading is above the zone limit
+ *              - OVERSHOOT: the zone keeps heating past setpoint + overshoot
+ *                           while its heater is off (shorted TRIAC)
+ *
+ *            A latched fault stays set until the operator acknowledges it with
+ *            HeaterSupervisor_Acknowledge(), which only releases zones whose
+ *            fault condition is gone (thermocouple closed, reading below the
+ *            limit and setpoint + overshoot, a STUCK reading moving again). A
+ *            released zone restarts its watches, so NO_RISE trips again if the
+ *            thermocouple is still out of the barrel. The caller cuts the
+ *            heaters (TriacFire_Kill()) when HeaterSupervisor_Check() reports a
+ *            zone and only re-arms them once no fault is latched; the time each
+ *            fault was latched is kept to measure detection latency.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_HEATER_SUPERVISOR_H_
+#define INC_HEATER_SUPERVISOR_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of supervised zones
+ */
+#define HEATER_SUPERVISOR_ZONES     3
+
+/**
+ * @brief Fault reasons (HeaterSupervisor_Zone_t.fault bits)
+ */
+#define HEATER_FAULT_OPEN           0x01U
+#define HEATER_FAULT_STUCK          0x02U
+#define HEATER_FAULT_NO_RISE        0x04U
+#define HEATER_FAULT_OVERTEMP       0x08U
+#define HEATER_FAULT_OVERSHOOT      0x10U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Detection thresholds
+ */
+typedef struct {
+    float temp_limit[HEATER_SUPERVISOR_ZONES]; /**< Highest temperature allowed [°C] */
+    float stuck_time;                          /**< Unchanged reading tolerated while heating [s] */
+    float runaway_power;                       /**< Command considered heating hard [%] */
+    float runaway_band;                        /**< Below setpoint - band counts as heating up [°C] */
+    float runaway_rise;                        /**< Rise expected within runaway_time [°C] */
+    float runaway_time;                        /**< Window for the expected rise [s] */
+    float overshoot;                           /**< Margin above setpoint for OVERSHOOT [°C] */
+} HeaterSupervisor_Config_t;
+
+/**
+ * @brief Per-zone supervision state
+ */
+typedef struct {
+    uint8_t fault;       /**< Latched HEATER_FAULT_* bits */
+    uint8_t started;     /**< Watches seeded with a valid reading */
+    float fault_time;    /**< Supervisor time when the first fault latched [s] */
+    float fault_temp;    /**< Reading when the first fault latched [°C] */
+    float last_temp;     /**< Previous reading [°C] */
+    float stuck_timer;   /**< Time the reading has not changed while heating [s] */
+    float watch_temp;    /**< Reference of the rise window [°C] */
+    float watch_timer;   /**< Time since the last expected rise [s] */
+    float idle_min;      /**< Lowest reading since the heater went off [°C] */
+} HeaterSupervisor_Zone_t;
+
+/**
+ * @brief Supervisor control structure
+ */
+typedef struct {
+    HeaterSupervisor_Config_t config;                 /**< Thresholds */
+    HeaterSupervisor_Zone_t zone[HEATER_SUPERVISOR_ZONES]; /**< Zone states */
+    float time;                                       /**< Time since init [s] */
+} HeaterSupervisor_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the supervisor with no fault latched
+ * @param   sup         Pointer to supervisor control structure
+ * @param   config      Detection thresholds
+ */
+void HeaterSupervisor_Init(HeaterSupervisor_t *sup, const HeaterSupervisor_Config_t *config);
+
+/**
+ * @brief   Check every zone
+ * @param   sup         Pointer to supervisor control structure
+ * @param   temps       Zone readings [°C]
+ * @param   open_mask   Bit n set when thermocouple n reports open
+ * @param   power       Heater commands applied since the previous check [%]
+ * @param   setpoints   Zone setpoints [°C]
+ * @param   dt          Time since the previous check [s]
+ * @return  uint8_t     Bit n set when zone n has a latched fault
+ */
+uint8_t HeaterSupervisor_Check(HeaterSupervisor_t *sup, const float *temps, uint32_t open_mask,
+                               const float *power, const float *setpoints, float dt);
+
+/**
+ * @brief   Zones with a latched fault
+ * @param   sup         Pointer to supervisor control structure
+ * @return  uint8_t     Bit n set when zone n has a latched fault
+ */
+uint8_t HeaterSupervisor_Faults(const HeaterSupervisor_t *sup);
+
+/**
+ * @brief   Operator acknowledge: release the zones whose fault has cleared
+ * @param   sup         Pointer to supervisor control structure
+ * @param   temps       Zone readings [°C]
+ * @param   open_mask   Bit n set when thermocouple n reports open
+ * @param   setpoints   Zone setpoints [°C]
+ * @return  uint8_t     Bit n set when zone n still has a latched fault
+ */
+uint8_t HeaterSupervisor_Acknowledge(HeaterSupervisor_t *sup, const float *temps,
+                                     uint32_t open_mask, const float *setpoints);
+
+/**
+ * @brief   Clear every latched fault and restart the watches
+ * @param   sup         Pointer to supervisor control structure
+ */
+void HeaterSupervisor_Reset(HeaterSupervisor_t *sup);
+
+#endif /* INC_HEATER_SUPERVISOR_H_ */
@@ -0,0 +1,121 @@
+/**
+ * @file      heaters.h
+ * @author    Adrian Silva Palafox
+ * @brief     Barrel heater zone control
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Groups the per-zone PID controllers and runs one control step for
+ *            every zone from the sampled temperatures and the setpoints. A zone
+ *            with a dead-time model runs its PID through a Smith predictor, and
+ *            a zone with a feedforward model gets the power its setpoint
+ *            trajectory needs added to the PID output. When the decoupling is
+ *            enabled these outputs pass through it before they become the zone
+ *            powers.
+ *
+ * @note      This module only depends on pid.h, the predictor, the
+ *            feedforward and the decoupling. It does not include any HAL or
+ *            board header. Sensor acquisition and actuator output stay in the
+ *            caller, so the control step can be compiled and run anywhere.
+ */
+
+#ifndef INC_HEATERS_H_
+#define INC_HEATERS_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "pid.h"
+#include "smith_predictor.h"
+#include "feedforward.h"
+#include "decoupling.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of barrel heater zones
+ */
+#define HEATERS_ZONES           3
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Heater zones control structure
+ */
+typedef struct {
+    PIDController pid[HEATERS_ZONES]; /**< One controller per zone */
+    SmithPredictor_t smith[HEATERS_ZONES]; /**< Dead-time compensation, off by default */
+    Feedforward_t feedforward[HEATERS_ZONES]; /**< Setpoint feedforward, off by default */
+    Decoupling_t decoupling;          /**< Cross-zone decoupling, off by default */
+    float power[HEATERS_ZONES];       /**< Last output of every zone */
+    float T;                          /**< Control period [s] */
+} Heaters_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the zones with zero gains and limits
+ * @param   heaters     Pointer to heaters control structure
+ * @param   t           Control period [s]
+ */
+void Heaters_Init(Heaters_t *heaters, float t);
+
+/**
+ * @brief   Configure the controller of one zone
+ * @param   heaters     Pointer to heaters control structure
+ * @param   zone        Zone index (0..HEATERS_ZONES-1)
+ * @param   kp, ki, kd  PID gains
+ * @param   tau         Derivative low-pass time constant [s]
+ * @param   limMin, limMax        Output limits
+ * @param   limMinInt, limMaxInt  Integrator limits
+ */
+void Heaters_ConfigureZone(Heaters_t *heaters, uint8_t zone,
+                           float kp, float ki, float kd, float tau,
+                           float limMin, float limMax,
+                           float limMinInt, float limMaxInt);
+
+/**
+ * @brief   Compensate the thermocouple lag and dead time of one zone
+ * @param   heaters     Pointer to heaters control structure
+ * @param   zone        Zone index (0..HEATERS_ZONES-1)
+ * @param   model       Zone model, NULL to control on the bare reading
+ * @param   dead_time   Transport delay on top of the thermocouple lag [s]
+ */
+void Heaters_SetDeadTime(Heaters_t *heaters, uint8_t zone,
+                         const ThermalModel_Zone_t *model, float dead_time);
+
+/**
+ * @brief   Add the model-based setpoint feedforward to one zone
+ * @param   heaters     Pointer to heaters control structure
+ * @param   zone        Zone index (0..HEATERS_ZONES-1)
+ * @param   model       Zone model, NULL to switch the feedforward off
+ * @param   ambient     Ambient temperature [°C]
+ */
+void Heaters_SetFeedforward(Heaters_t *heaters, uint8_t zone,
+                            const ThermalModel_Zone_t *model, float ambient);
+
+/**
+ * @brief   Run one control step for every zone
+ * @param   heaters     Pointer to heaters control structure
+ * @param   setpoints   Zone setpoints [°C]
+ * @param   temps       Zone temperatures [°C]
+ */
+void Heaters_ControlStep(Heaters_t *heaters, const float *setpoints, const float *temps);
+
+/**
+ * @brief   Cap the zone outputs and feed the cut back to the controllers
+ * @param   heaters     Pointer to heaters control structure
+ * @param   limit       Highest power of every zone [%]
+ */
+void Heaters_LimitPower(Heaters_t *heaters, const float *limit);
+
+/**
+ * @brief   Switch every zone off and clear the controller state
+ * @param   heaters     Pointer to heaters control structure
+ */
+void Heaters_Off(Heaters_t *heaters);
+
+/**
+ * @brief   Check whether every zone is currently off
+ * @param   heaters     Pointer to heaters control structure
+ * @return  uint8_t     1 if no zone is demanding power, 0 otherwise
+ */
+uint8_t Heaters_IsIdle(const Heaters_t *heaters);
+
+#endif /* INC_HEATERS_H_ */
@@ -0,0 +1,91 @@
+/**
+ * @file      idle.h
+ * @author    Adrian Silva Palafox
+ * @brief     Sleep-on-idle for the main loop
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Idle_Sleep() stops the core with WFI (Sleep mode, peripherals keep
+ *            running) until the next enabled interrupt: SysTick, the control
+ *            tick timer or any other interrupt enabled in the NVIC. Interrupts
+ *            are masked around the check for pending work, so a flag raised
+ *            just before the WFI is not missed: the core wakes on the pending
+ *            interrupt and the handler runs when they are unmasked again.
+ *
+ *            In tickless mode SysTick is suspended during the sleep and the
+ *            core only wakes on the other interrupts (at least once per control
+ *            tick). The time slept is then read from the control tick timer
+ *            counter and added to the HAL tick, so HAL_GetTick() keeps counting
+ *            real time.
+ *
+ *            Tickless mode must stay off while the zero-cross detector is
+ *            locked to the mains. The edge and gate interrupts time the
+ *            half-cycle with the DWT cycle counter, and a tickless wake-up may
+ *            move that counter forward by the estimated slept time. That
+ *            estimate is only accurate to one tick timer count (100 us), so
+ *            one correction would shift the edge timestamps and the firing
+ *            angle. The caller passes tickless = 0 whenever
+ *            ZeroCross_t.period is non-zero and the mains is not lost. In
+ *            practice tickless sleep is only used with the heaters
+ *            unpowered.
+ *
+ *            The figures are meant to be read with a debugger:
+ *              - idle_percent:  share of the last window spent asleep
+ *              - wake_latency:  time from the SysTick event to the code after
+ *                               the WFI running again (Profiling stopwatch)
+ *
+ * @note      The slept time is measured with SysTick or the tick timer, not
+ *            with the DWT cycle counter, which may stop while the core clock is
+ *            gated. The counter is advanced by the missing cycles on wake-up so
+ *            the Profiling time base stays continuous.
+ */
+
+#ifndef INC_IDLE_H_
+#define INC_IDLE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "profiling.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Length of the idle percentage window [ms]
+ */
+#define IDLE_WINDOW_MS      1000U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Idle control structure
+ */
+typedef struct {
+    TIM_HandleTypeDef *htim;            /**< Control tick timer, runs while SysTick is suspended */
+    uint32_t cycles_per_count;          /**< Core cycles per tick timer count */
+    uint32_t window_start;              /**< Cycle counter at the start of the window */
+    uint32_t slept;                     /**< Cycles slept in the current window */
+    uint32_t tick_carry;                /**< Slept cycles not yet added to the HAL tick */
+    uint32_t sleeps;                    /**< Number of WFI entries */
+    float idle_percent;                 /**< Share of the last window spent asleep [%] */
+    Profiling_Stopwatch_t wake_latency; /**< SysTick event to wake-up [cycles] */
+} Idle_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the idle figures
+ * @param   idle        Pointer to idle control structure
+ * @param   htim        Free-running timer on APB1 whose update interrupt is
+ *                      enabled (control tick)
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef Idle_Init(Idle_t *idle, TIM_HandleTypeDef *htim);
+
+/**
+ * @brief   Sleep until the next interrupt unless work is pending
+ * @param   idle        Pointer to idle control structure
+ * @param   pending     Work flags set from interrupt handlers, no sleep when
+ *                      non-zero
+ * @param   tickless    Suspend SysTick during the sleep
+ */
+void Idle_Sleep(Idle_t *idle, volatile const uint8_t *pending, uint8_t tickless);
+
+#endif /* INC_IDLE_H_ */
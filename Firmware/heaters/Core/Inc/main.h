@@ -65,6 +65,10 @@ void Error_Handler(void);
 #define fire_GPIO_Port GPIOA
 #define zero_crossig_Pin GPIO_PIN_1
 #define zero_crossig_GPIO_Port GPIOA
+#define fire_1_Pin GPIO_PIN_2
+#define fire_1_GPIO_Port GPIOA
+#define fire_2_Pin GPIO_PIN_3
+#define fire_2_GPIO_Port GPIOA
 #define CS_0_Pin GPIO_PIN_7
 #define CS_0_GPIO_Port GPIOA
 #define CS_1_Pin GPIO_PIN_0
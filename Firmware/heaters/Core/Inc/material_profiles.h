@@ -0,0 +1,107 @@
+/**
+ * @file      material_profiles.h
+ * @author    Adrian Silva Palafox
+ * @brief     Per-material temperature and speed recipes
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   The built-in materials (PLA, ABS, PETG) are a constant table in
+ *            flash indexed by Material_t, so a lookup is a single array access.
+ *            Their gains are conservative starting values; tuned gains belong in
+ *            the custom material.
+ *
+ *            The custom material is assembled from the parameter store: zone
+ *            setpoints, gains and output limits come from the zone records (the
+ *            values used before materials existed) and the process figures from
+ *            the material record. MaterialProfile_SaveCustom() writes a whole
+ *            profile back.
+ *
+ *            MaterialProfile_Apply() sets every zone gain and limit, every
+ *            setpoint and the screw and puller speeds in one call, so the
+ *            controller never runs a tick with a mix of two materials. The gains
+ *            change bumplessly: a material change while heating moves the
+ *            setpoints (ramped by the warm-up planner), not the output. A zone
+ *            whose lim_max is 0 is not heated by that material.
+ */
+
+#ifndef INC_MATERIAL_PROFILES_H_
+#define INC_MATERIAL_PROFILES_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "heaters.h"
+#include "extrusor_process.h"
+#include "param_store.h"
+#include <stdint.h>
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Materials
+ */
+typedef enum {
+    MATERIAL_PLA = 0,
+    MATERIAL_ABS,
+    MATERIAL_PETG,
+    MATERIAL_CUSTOM,     /**< Built from the parameter store */
+    MATERIAL_COUNT
+} Material_t;
+
+/**
+ * @brief Output and integrator limits of one zone
+ */
+typedef struct {
+    float lim_min;      /**< Minimum controller output [%] */
+    float lim_max;      /**< Maximum controller output [%], 0 leaves the zone unheated */
+    float lim_min_int;  /**< Minimum integrator value [%] */
+    float lim_max_int;  /**< Maximum integrator value [%] */
+} MaterialProfile_Limits_t;
+
+/**
+ * @brief Material recipe
+ */
+typedef struct {
+    char     name[8];                    /**< Display name */
+    float    setpoint[HEATERS_ZONES];    /**< Zone setpoints, feed to die [°C] */
+    float    ramp_rate;                  /**< Heat-up rate limit [°C/min] */
+    PIDGains gains[HEATERS_ZONES];       /**< Zone PID gains */
+    MaterialProfile_Limits_t limits[HEATERS_ZONES]; /**< Zone output limits */
+    float    screw_rpm;                  /**< Production screw speed [rpm] */
+    float    puller_rpm;                 /**< Puller speed [rpm] */
+    float    diameter;                   /**< Target filament diameter [mm] */
+    float    density;                    /**< Material density [g/cm3] */
+} MaterialProfile_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Look up a built-in material
+ * @param   material    Material_t
+ * @return  const MaterialProfile_t*   Profile in flash, NULL for MATERIAL_CUSTOM
+ *                                     or an unknown material
+ */
+const MaterialProfile_t *MaterialProfile_Get(uint8_t material);
+
+/**
+ * @brief   Assemble the custom material from the stored parameters
+ * @param   profile     Destination
+ * @param   params      Parameter store image
+ */
+void MaterialProfile_GetCustom(MaterialProfile_t *profile, const ParamStore_Data_t *params);
+
+/**
+ * @brief   Store a profile as the custom material (deferred write)
+ * @param   store       Pointer to store control structure
+ * @param   profile     Profile to store
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef MaterialProfile_SaveCustom(ParamStore_t *store, const MaterialProfile_t *profile);
+
+/**
+ * @brief   Reconfigure every zone and the process speeds for a material
+ * @param   profile     Material to apply
+ * @param   heaters     Heater zones, gains (bumpless) and limits are replaced
+ * @param   setpoints   Zone setpoints to overwrite [°C]
+ * @param   config      Process sequence parameters to update
+ */
+void MaterialProfile_Apply(const MaterialProfile_t *profile, Heaters_t *heaters,
+                           float *setpoints, ExtrusorProcess_Config_t *config);
+
+#endif /* INC_MATERIAL_PROFILES_H_ */
@@ -69,6 +69,14 @@
  */
 #define MAX6675_TEMP_FACTOR     0.25f
 
+/**
+ * @brief Maximum conversion time (ms)
+ * @note  Pulling CS low aborts the conversion in progress and a new one only
+ *        starts when CS goes high again, so a device polled faster than this
+ *        never updates its reading.
+ */
+#define MAX6675_CONVERSION_MS   220U
+
 /* Type Definitions ---------------------------------------------------------*/
 /**
  * @brief MAX6675 device structure
@@ -79,6 +87,7 @@ typedef struct
     uint16_t raw_data;   /**< Raw 16-bit data from the MAX6675 register */
     float    temperature; /**< Processed temperature reading in Celsius */
     uint8_t  is_connected; /**< Connection status (1=connected, 0=disconnected) */
+    uint32_t last_read;  /**< HAL tick of the last frame read */
 } MAX6675_Device_t;
 
 /**
@@ -113,10 +122,22 @@ HAL_StatusTypeDef MAX6675_AddDevice(MAX6675_Driver_t *driver, uint8_t device_id)
  * @brief   Read temperature data from a specific MAX6675 device
  * @param   driver      Pointer to driver control structure
  * @param   device_id   Device ID (0-3) to read from
- * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR, HAL_BUSY if the
+ *                              previous conversion has not finished yet)
  */
 HAL_StatusTypeDef MAX6675_ReadTemperature(MAX6675_Driver_t *driver, uint8_t device_id);
 
+/**
+ * @brief   Decode a raw 16-bit frame into the device state
+ * @details Used by MAX6675_ReadTemperature() and to feed recorded frames
+ *          through the same decoding when replaying a sensor trace.
+ * @param   driver      Pointer to driver control structure
+ * @param   device_id   Device ID (0-3) the frame belongs to
+ * @param   raw         Frame as shifted out by the MAX6675
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef MAX6675_ProcessFrame(MAX6675_Driver_t *driver, uint8_t device_id, uint16_t raw);
+
 /**
  * @brief   Get the temperature value from a specific MAX6675 device
  * @param   driver      Pointer to driver control structure
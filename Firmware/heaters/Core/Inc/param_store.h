@@ -0,0 +1,223 @@
+/**
+ * @file      param_store.h
+ * @author    Adrian Silva Palafox
+ * @brief     Persistent parameter store (EEPROM emulation in internal flash)
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Keeps the per-zone PID gains, output limits, setpoints and
+ *            thermocouple offsets, the encoder zero positions and the selected
+ *            material, across resets. Parameters live in a RAM image that the application reads
+ *            directly; flash only holds the history of changes.
+ *
+ *            Each change is appended as a versioned, CRC-checked record keyed by
+ *            parameter group. At boot the active sector is read in a single pass
+ *            and the newest valid record of every key is applied on top of the
+ *            defaults. When the sector fills up, the current image is compacted
+ *            into the spare sector, whose header is written last so that a power
+ *            loss during compaction leaves the previous sector in charge.
+ *
+ *            Writes are deferred: setters only update the RAM image and mark the
+ *            group dirty, and ParamStore_Service() writes at most one record per
+ *            call from the main loop. Repeated changes to the same group before
+ *            it is serviced collapse into a single record.
+ *
+ * @note      Compaction erases a 16 KB sector (a few hundred ms of CPU stall),
+ *            so ParamStore_Service() only compacts when the caller allows it.
+ */
+
+#ifndef INC_PARAM_STORE_H_
+#define INC_PARAM_STORE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "flash_if.h"
+#include "AS5048B.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of heater zones with stored parameters
+ */
+#define PARAM_STORE_ZONES           3
+
+/**
+ * @brief Flash sectors reserved for the store (see the PARAMS region in the linker script)
+ */
+#define PARAM_STORE_SECTOR_COUNT    2
+#define PARAM_STORE_SECTORS         { FLASH_SECTOR_1, FLASH_SECTOR_2 }
+#define PARAM_STORE_ADDRESSES       { 0x08004000U, 0x08008000U }
+#define PARAM_STORE_SECTOR_SIZE     0x4000U
+
+/**
+ * @brief Layout version of the stored payloads
+ * @note  Bump when a payload structure changes. Records with another version
+ *        are ignored and the defaults are used instead.
+ */
+#define PARAM_STORE_VERSION         1U
+
+/**
+ * @brief Compact at boot once the active sector is filled above this fraction
+ */
+#define PARAM_STORE_BOOT_COMPACT    0.75f
+
+/**
+ * @brief Record and sector markers
+ */
+#define PARAM_STORE_RECORD_MAGIC    0x5A3CU
+#define PARAM_STORE_SECTOR_MAGIC    0x534D5250U /* "PRMS" */
+
+/**
+ * @brief Payload bytes available in every record
+ */
+#define PARAM_STORE_PAYLOAD_SIZE    48U
+
+/**
+ * @brief Parameter groups, one record key each
+ */
+typedef enum {
+    PARAM_KEY_ZONE0 = 0,
+    PARAM_KEY_ZONE1,
+    PARAM_KEY_ZONE2,
+    PARAM_KEY_ENCODERS,
+    PARAM_KEY_MATERIAL,
+    PARAM_KEY_COUNT
+} ParamStore_Key_t;
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Parameters of one heater zone
+ */
+typedef struct {
+    float kp;          /**< Proportional gain */
+    float ki;          /**< Integral gain */
+    float kd;          /**< Derivative gain */
+    float tau;         /**< Derivative low-pass time constant [s] */
+    float lim_min;     /**< Minimum controller output */
+    float lim_max;     /**< Maximum controller output */
+    float lim_min_int; /**< Minimum integrator value */
+    float lim_max_int; /**< Maximum integrator value */
+    float setpoint;    /**< Zone setpoint [°C] */
+    float tc_offset;   /**< Thermocouple offset added to readings [°C] */
+    float temp_limit;  /**< Highest temperature allowed on the zone [°C] */
+} ParamStore_Zone_t;
+
+/**
+ * @brief Encoder calibration
+ */
+typedef struct {
+    uint16_t zero_position[AS5048B_MAX_DEVICES]; /**< 14-bit zero position per encoder */
+} ParamStore_Encoders_t;
+
+/**
+ * @brief Selected material and the process figures of the custom material
+ * @note  The custom material takes its setpoints and gains from the zones
+ */
+typedef struct {
+    uint8_t selected;  /**< Material_t applied at boot */
+    uint8_t reserved[3];
+    float ramp_rate;   /**< Custom: heat-up rate limit [°C/min] */
+    float screw_rpm;   /**< Custom: production screw speed [rpm] */
+    float puller_rpm;  /**< Custom: puller speed [rpm] */
+    float diameter;    /**< Custom: target filament diameter [mm] */
+    float density;     /**< Custom: material density [g/cm3] */
+} ParamStore_Material_t;
+
+/**
+ * @brief RAM image of every stored parameter
+ */
+typedef struct {
+    ParamStore_Zone_t     zones[PARAM_STORE_ZONES];
+    ParamStore_Encoders_t encoders;
+    ParamStore_Material_t material;
+} ParamStore_Data_t;
+
+/**
+ * @brief Header written at the start of a sector once it is complete (16 bytes)
+ */
+typedef struct {
+    uint32_t magic;       /**< PARAM_STORE_SECTOR_MAGIC */
+    uint32_t generation;  /**< Increases on every compaction, newest is active */
+    uint32_t reserved;    /**< Keep 0xFFFFFFFF */
+    uint16_t reserved2;   /**< Keep 0xFFFF */
+    uint16_t crc;         /**< CRC-16 over the previous fields */
+} ParamStore_SectorHeader_t;
+
+/**
+ * @brief Stored record (56 bytes)
+ */
+typedef struct {
+    uint16_t magic;                             /**< PARAM_STORE_RECORD_MAGIC */
+    uint16_t crc;                               /**< CRC-16 over the fields that follow */
+    uint8_t  key;                               /**< ParamStore_Key_t */
+    uint8_t  version;                           /**< PARAM_STORE_VERSION */
+    uint16_t length;                            /**< Payload bytes in use */
+    uint8_t  payload[PARAM_STORE_PAYLOAD_SIZE]; /**< Group contents */
+} ParamStore_Record_t;
+
+/**
+ * @brief Parameter store control structure
+ */
+typedef struct {
+    ParamStore_Data_t data;    /**< Current parameters, read freely by the application */
+    uint8_t  active;           /**< Index of the active sector */
+    uint32_t generation;       /**< Generation of the active sector */
+    uint32_t write_offset;     /**< Next free slot inside the active sector */
+    uint32_t dirty;            /**< Bit n set when key n awaits writing */
+    uint8_t  usable;           /**< 0 while no complete sector is active (first
+                                    format failed), writes then wait for a compaction */
+} ParamStore_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Load the parameters in a single pass over the active sector
+ * @param   store       Pointer to store control structure
+ * @param   defaults    Values used for groups with no valid record
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR). On error the
+ *                              defaults are loaded and the store is left
+ *                              unusable until ParamStore_Service() compacts it.
+ */
+HAL_StatusTypeDef ParamStore_Init(ParamStore_t *store, const ParamStore_Data_t *defaults);
+
+/**
+ * @brief   Update the parameters of one zone (deferred write)
+ * @param   store       Pointer to store control structure
+ * @param   zone        Zone index (0..PARAM_STORE_ZONES-1)
+ * @param   params      New zone parameters
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ParamStore_SetZone(ParamStore_t *store, uint8_t zone, const ParamStore_Zone_t *params);
+
+/**
+ * @brief   Update the zero position of one encoder (deferred write)
+ * @param   store       Pointer to store control structure
+ * @param   encoder     Encoder index (0..AS5048B_MAX_DEVICES-1)
+ * @param   position    14-bit zero position
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ParamStore_SetEncoderZero(ParamStore_t *store, uint8_t encoder, uint16_t position);
+
+/**
+ * @brief   Update the material selection and custom material (deferred write)
+ * @param   store       Pointer to store control structure
+ * @param   material    New material parameters
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ParamStore_SetMaterial(ParamStore_t *store, const ParamStore_Material_t *material);
+
+/**
+ * @brief   Write pending changes, at most one record per call
+ * @param   store       Pointer to store control structure
+ * @param   allow_erase 1 if a sector erase (compaction) may stall the CPU now
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_BUSY if a compaction is
+ *                              needed but not allowed, HAL_ERROR)
+ */
+HAL_StatusTypeDef ParamStore_Service(ParamStore_t *store, uint8_t allow_erase);
+
+/**
+ * @brief   Check whether changes are waiting to be written
+ * @param   store       Pointer to store control structure
+ * @return  uint8_t     1 if a group is dirty, 0 otherwise
+ */
+uint8_t ParamStore_IsPending(const ParamStore_t *store);
+
+#endif /* INC_PARAM_STORE_H_ */
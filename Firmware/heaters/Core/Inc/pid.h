@@ -53,6 +53,9 @@ typedef struct {
     float differentiator;  // Stores the value of the derivative term
     float prevMeasurement; // Previous measurement (needed to calculate the derivative)
 
+    // Feedforward added to the output ahead of the limits (model-based setpoint power)
+    float feedforward;
+
     // Controller output (final result after applying the PID formula)
     float out;
 } PIDController;
@@ -72,9 +75,23 @@ void PID_Reset(PIDController* pid);
 // Update the PID controller output based on the setpoint and current measurement
 float PID_Update(PIDController* pid, float setpoint, float measurement);
 
+// Report the output actually applied when it differs from the controller output
+// (shared power budget, limits after the decoupler), so the integrator does not
+// wind up meanwhile
+void PID_LimitOutput(PIDController* pid, float applied);
+
+// Set the feedforward term added to the next outputs (the PID then only corrects residuals)
+void PID_SetFeedforward(PIDController* pid, float feedforward);
+
+// Replace the output and integrator limits, clamping the current state to them
+void PID_SetLimits(PIDController* pid, float limMin, float limMax, float limMinInt, float limMaxInt);
+
 // Update the PID controller gains (Kp, Ki, Kd) in real time
 void PID_UpdateGains(PIDController* pid, float kp, float ki, float kd);
 
+// Update the gains without a step in the controller output (gain scheduling)
+void PID_UpdateGainsBumpless(PIDController* pid, float kp, float ki, float kd);
+
 // Methods to get the current PID gains:
 float PID_GetKp(const PIDController* pid); // Returns the proportional gain (Kp)
 float PID_GetKi(const PIDController* pid); // Returns the integral gain (Ki)
@@ -0,0 +1,86 @@
+/**
+ * @file      power_allocator.h
+ * @author    Adrian Silva Palafox
+ * @brief     Shared power budget across heater loads
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Sits between the controllers and the firing outputs. Every load
+ *            requests a percentage of its rated power; when the total exceeds
+ *            the budget the power is handed out by priority, and inside one
+ *            priority level by water-filling on the control error: each load
+ *            gets min(demand, level * weight), with the weight being its error
+ *            (at least POWER_ALLOCATOR_MIN_WEIGHT) and the level chosen so the
+ *            grants add up to what is left of the budget. Zones far from
+ *            their setpoint get the larger share; a zone that falls behind
+ *            sees its error, and so its share, grow.
+ *
+ *            Phase-angle firing delivers the same energy every half-cycle for
+ *            a given command, so a budget met by the commands is met on every
+ *            half-cycle.
+ *
+ *            The caller feeds the grants back to the controllers
+ *            (Heaters_LimitPower()) so their integrators do not wind up while
+ *            a zone is held below its request.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_POWER_ALLOCATOR_H_
+#define INC_POWER_ALLOCATOR_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Most loads sharing the budget (barrel zones plus auxiliary heaters)
+ */
+#define POWER_ALLOCATOR_MAX_LOADS   6
+
+/**
+ * @brief Smallest water-filling weight [°C], so loads at or above their
+ *        setpoint still get a share
+ */
+#define POWER_ALLOCATOR_MIN_WEIGHT  1.0f
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Loads and budget
+ */
+typedef struct {
+    uint8_t loads;                              /**< Loads in use */
+    float budget;                               /**< Total power allowed [W] */
+    float rated[POWER_ALLOCATOR_MAX_LOADS];     /**< Power of each load at 100 % [W] */
+    uint8_t priority[POWER_ALLOCATOR_MAX_LOADS];/**< Served first when higher */
+} PowerAllocator_Config_t;
+
+/**
+ * @brief Allocator control structure
+ */
+typedef struct {
+    PowerAllocator_Config_t config;             /**< Loads and budget */
+    float total;                                /**< Power granted by the last allocation [W] */
+    uint8_t limited;                            /**< Bit n set when load n got less than requested */
+} PowerAllocator_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the allocator
+ * @param   pa          Pointer to allocator control structure
+ * @param   config      Loads and budget
+ */
+void PowerAllocator_Init(PowerAllocator_t *pa, const PowerAllocator_Config_t *config);
+
+/**
+ * @brief   Share the budget among the requests
+ * @param   pa          Pointer to allocator control structure
+ * @param   request     Requested power of each load [%]
+ * @param   error       Control error of each load (setpoint - temperature) [°C]
+ * @param   granted     Power granted to each load [%], may alias request
+ * @return  float       Total power granted [W]
+ */
+float PowerAllocator_Allocate(PowerAllocator_t *pa, const float *request,
+                              const float *error, float *granted);
+
+#endif /* INC_POWER_ALLOCATOR_H_ */
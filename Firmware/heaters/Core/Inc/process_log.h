@@ -0,0 +1,194 @@
+/**
+ * @file      process_log.h
+ * @author    Adrian Silva Palafox
+ * @brief     Flash-backed circular log of per-minute process summaries
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Production runs are summarised once per minute (zone temperatures,
+ *            heater power, screw speed and sensor faults) into a packed 32-byte
+ *            record that is appended to flash sectors reserved for the log in
+ *            STM32F411CEUX_FLASH.ld.
+ *
+ *            Each sector starts with a header carrying a generation number and
+ *            an erase counter. Sectors are filled one after the other and reused
+ *            round-robin, so every sector sees the same number of erases. The
+ *            newest generation is the active sector; when it fills up the oldest
+ *            one is erased and becomes the new active sector.
+ *
+ *            Records are written with the magic first and the CRC covering the
+ *            rest, so a power loss in the middle of a write leaves a slot that
+ *            is skipped when reading and never reused on the next boot.
+ *
+ * @note      Rotating into a new sector erases 128 KB of flash (1-2 s CPU stall).
+ *            ProcessLog_Init() rotates ahead of time at boot when the active
+ *            sector is nearly full so that a typical run never erases mid-way.
+ */
+
+#ifndef INC_PROCESS_LOG_H_
+#define INC_PROCESS_LOG_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "flash_if.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of heater zones summarised in each record
+ */
+#define PROCESS_LOG_ZONES           3
+
+/**
+ * @brief Flash sectors reserved for the log (see the LOG region in the linker script)
+ */
+#define PROCESS_LOG_SECTOR_COUNT    2
+#define PROCESS_LOG_SECTORS         { FLASH_SECTOR_6, FLASH_SECTOR_7 }
+#define PROCESS_LOG_ADDRESSES       { 0x08040000U, 0x08060000U }
+#define PROCESS_LOG_SECTOR_SIZE     0x20000U
+
+/**
+ * @brief Summary period in seconds
+ */
+#define PROCESS_LOG_PERIOD_S        60.0f
+
+/**
+ * @brief Rotate at boot or while stopped once the active sector is filled above
+ *        this fraction
+ * @note  Rotation erases a 128 KB sector (1-2 s with the core stalled), it is
+ *        never done while the heaters run: a full sector drops records instead
+ */
+#define PROCESS_LOG_ROTATE_FILL     0.75f
+
+/**
+ * @brief Record and sector markers
+ */
+#define PROCESS_LOG_RECORD_MAGIC    0xA55AU
+#define PROCESS_LOG_SECTOR_MAGIC    0x474F4C50U /* "PLOG" */
+
+/**
+ * @brief Fault bits stored in ProcessLog_Record_t.faults
+ * @note  Bits 0..PROCESS_LOG_ZONES-1 flag a thermocouple fault on that zone
+ */
+#define PROCESS_LOG_FAULT_ZONE(n)   (1U << (n))
+#define PROCESS_LOG_FAULT_MAINS     (1U << PROCESS_LOG_ZONES) /**< Zero-cross detector lost */
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Header written at the start of every log sector (16 bytes)
+ */
+typedef struct {
+    uint32_t magic;       /**< PROCESS_LOG_SECTOR_MAGIC */
+    uint32_t generation;  /**< Increases on every rotation, newest is active */
+    uint32_t erase_count; /**< Number of times this sector has been erased */
+    uint16_t reserved;    /**< Keep 0xFFFF */
+    uint16_t crc;         /**< CRC-16 over the previous fields */
+} ProcessLog_SectorHeader_t;
+
+/**
+ * @brief Packed per-minute process summary (32 bytes)
+ */
+typedef struct {
+    uint16_t magic;                          /**< PROCESS_LOG_RECORD_MAGIC */
+    uint16_t crc;                            /**< CRC-16 over the fields that follow */
+    uint32_t sequence;                       /**< Monotonic record number */
+    uint32_t uptime_min;                     /**< Minutes since boot */
+    int16_t  temp_avg[PROCESS_LOG_ZONES];    /**< Average temperature [0.25 °C] */
+    int16_t  temp_max[PROCESS_LOG_ZONES];    /**< Peak temperature [0.25 °C] */
+    uint8_t  power_avg[PROCESS_LOG_ZONES];   /**< Average heater power [%] */
+    uint8_t  faults;                         /**< Fault bits seen during the minute */
+    uint16_t throughput;                     /**< Average screw speed [0.1 RPM] */
+    uint16_t reserved;                       /**< Keep 0xFFFF */
+} ProcessLog_Record_t;
+
+/**
+ * @brief Callback used to stream records out of the log
+ * @return 0 to continue, any other value stops the stream
+ */
+typedef uint8_t (*ProcessLog_Callback_t)(const ProcessLog_Record_t *record, void *ctx);
+
+/**
+ * @brief Process log control structure
+ */
+typedef struct {
+    uint8_t  active;             /**< Index of the active sector */
+    uint32_t generation;         /**< Generation of the active sector */
+    uint32_t erase_count;        /**< Erase counter of the active sector */
+    uint32_t write_offset;       /**< Next free slot inside the active sector */
+    uint32_t sequence;           /**< Sequence number of the next record */
+    uint32_t dropped;            /**< Records dropped while the active sector was full */
+
+    /* Accumulators for the summary being built */
+    float    elapsed;                        /**< Seconds accumulated */
+    uint32_t samples;                        /**< Samples accumulated */
+    float    temp_sum[PROCESS_LOG_ZONES];    /**< Temperature sum [°C] */
+    float    temp_max[PROCESS_LOG_ZONES];    /**< Temperature peak [°C] */
+    float    power_sum[PROCESS_LOG_ZONES];   /**< Power sum [%] */
+    float    rpm_sum;                        /**< Screw speed sum [RPM] */
+    uint8_t  faults;                         /**< Fault bits seen */
+    uint32_t uptime_min;                     /**< Minutes logged since boot */
+} ProcessLog_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Recover the log state from flash
+ * @details Picks the newest valid sector, finds the first free slot and
+ *          formats the log area if nothing valid is found.
+ * @param   log         Pointer to log control structure
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ProcessLog_Init(ProcessLog_t *log);
+
+/**
+ * @brief   Check whether the active sector is due for rotation
+ * @param   log         Pointer to log control structure
+ * @return  uint8_t     1 once the sector is filled above PROCESS_LOG_ROTATE_FILL
+ */
+uint8_t ProcessLog_RotateDue(const ProcessLog_t *log);
+
+/**
+ * @brief   Move on to the next sector, erasing its oldest records
+ * @details Stalls the core for the whole sector erase. Only call it with the
+ *          process stopped and the heater outputs off.
+ * @param   log         Pointer to log control structure
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ProcessLog_Rotate(ProcessLog_t *log);
+
+/**
+ * @brief   Accumulate one control-tick sample into the current summary
+ * @details Appends a record to flash once PROCESS_LOG_PERIOD_S has elapsed.
+ * @param   log         Pointer to log control structure
+ * @param   temps       Zone temperatures [°C]
+ * @param   power       Zone heater power [%]
+ * @param   screw_rpm   Screw speed [RPM]
+ * @param   faults      Fault bits (PROCESS_LOG_FAULT_ZONE)
+ * @param   dt          Time since the previous sample [s]
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ProcessLog_Sample(ProcessLog_t *log, const float *temps,
+                                    const float *power, float screw_rpm,
+                                    uint8_t faults, float dt);
+
+/**
+ * @brief   Append a record to the log
+ * @details Fills in magic, sequence and CRC. Never erases: once the active
+ *          sector is full the record is dropped and counted until the next
+ *          ProcessLog_Rotate().
+ * @param   log         Pointer to log control structure
+ * @param   record      Record to store
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR, HAL_BUSY when
+ *                              dropped)
+ */
+HAL_StatusTypeDef ProcessLog_Append(ProcessLog_t *log, ProcessLog_Record_t *record);
+
+/**
+ * @brief   Stream every valid record from oldest to newest
+ * @details Records are read in place from memory-mapped flash.
+ * @param   log         Pointer to log control structure
+ * @param   callback    Called once per record
+ * @param   ctx         User pointer passed to the callback
+ * @return  uint32_t    Number of records delivered
+ */
+uint32_t ProcessLog_Stream(const ProcessLog_t *log, ProcessLog_Callback_t callback, void *ctx);
+
+#endif /* INC_PROCESS_LOG_H_ */
@@ -0,0 +1,102 @@
+/**
+ * @file      profiling.h
+ * @author    Adrian Silva Palafox
+ * @brief     Cycle-accurate timing of the control loop and sensor reads
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Uses the Cortex-M4 DWT cycle counter, which runs at the core clock
+ *            on the board and is also modelled by the usual emulators, so the
+ *            same firmware image reports comparable figures on both. Each
+ *            measured section owns a stopwatch that keeps the last, minimum,
+ *            maximum and accumulated cycle counts; the figures can be read with
+ *            a debugger or dumped over the debug link.
+ *
+ *            Profiling_Micros() extends the 32-bit cycle counter into a
+ *            microsecond time base for timestamps (the raw counter wraps every
+ *            ~43 s at 100 MHz).
+ *
+ * @note      Stopwatches are not reentrant: a stopwatch must be started and
+ *            stopped from the same context.
+ */
+
+#ifndef INC_PROFILING_H_
+#define INC_PROFILING_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Timing figures of one code section
+ */
+typedef struct {
+    uint32_t start;   /**< Counter value at Profiling_Start() */
+    uint32_t last;    /**< Duration of the last run [cycles] */
+    uint32_t min;     /**< Shortest run [cycles] */
+    uint32_t max;     /**< Longest run [cycles] */
+    uint64_t total;   /**< Sum of all runs [cycles] */
+    uint32_t count;   /**< Number of runs */
+} Profiling_Stopwatch_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Enable the DWT cycle counter
+ */
+void Profiling_Init(void);
+
+/**
+ * @brief   Current cycle counter value
+ * @return  uint32_t    Core clock cycles (wraps around)
+ */
+static inline uint32_t Profiling_Cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief   Time since Profiling_Init()
+ * @details Must be called at least once per counter wrap (~43 s at 100 MHz);
+ *          the main loop does so on every pass.
+ * @return  uint32_t    Elapsed time [us] (wraps after ~71 minutes)
+ */
+uint32_t Profiling_Micros(void);
+
+/**
+ * @brief   Clear the figures of a stopwatch
+ * @param   sw          Pointer to stopwatch
+ */
+void Profiling_Reset(Profiling_Stopwatch_t *sw);
+
+/**
+ * @brief   Mark the beginning of a measured section
+ * @param   sw          Pointer to stopwatch
+ */
+static inline void Profiling_Start(Profiling_Stopwatch_t *sw)
+{
+    sw->start = DWT->CYCCNT;
+}
+
+/**
+ * @brief   Mark the end of a measured section and update the figures
+ * @param   sw          Pointer to stopwatch
+ * @return  uint32_t    Duration of this run [cycles]
+ */
+uint32_t Profiling_Stop(Profiling_Stopwatch_t *sw);
+
+/**
+ * @brief   Add a duration measured elsewhere to the figures of a stopwatch
+ * @param   sw          Pointer to stopwatch
+ * @param   cycles      Duration [cycles]
+ */
+void Profiling_Record(Profiling_Stopwatch_t *sw, uint32_t cycles);
+
+/**
+ * @brief   Convert a cycle count to microseconds at the current core clock
+ * @param   cycles      Core clock cycles
+ * @return  uint32_t    Duration [us]
+ */
+uint32_t Profiling_CyclesToMicros(uint32_t cycles);
+
+#endif /* INC_PROFILING_H_ */
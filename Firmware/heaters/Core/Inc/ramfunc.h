@@ -0,0 +1,33 @@
+/**
+ * @file      ramfunc.h
+ * @author    Adrian Silva Palafox
+ * @brief     Execution from SRAM for latency-critical functions
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   At 100 MHz the flash needs 3 wait states; the ART accelerator
+ *            hides them only while the code is in its cache, so a cold ISR or
+ *            control step sees a variable fetch delay. A function marked
+ *            RAMFUNC is placed in the .RamFunc section, which the linker script
+ *            puts in .data: the startup code copies it to SRAM together with
+ *            the initialized variables and it then runs without wait states.
+ *
+ *            Placement is per function, at the definition. The linker script
+ *            checks the total against _RamFunc_Budget. Building with
+ *            RAMFUNC_IN_FLASH defined leaves every function in flash, to
+ *            compare the Profiling figures of both placements.
+ *
+ * @note      No HAL dependency. Host builds (non-ARM) ignore the attribute.
+ */
+
+#ifndef INC_RAMFUNC_H_
+#define INC_RAMFUNC_H_
+
+#if defined(__GNUC__) && defined(__arm__) && !defined(RAMFUNC_IN_FLASH)
+/* noinline keeps callers in flash from pulling a copy back into flash */
+#define RAMFUNC     __attribute__((section(".RamFunc"), noinline))
+#else
+#define RAMFUNC
+#endif
+
+#endif /* INC_RAMFUNC_H_ */
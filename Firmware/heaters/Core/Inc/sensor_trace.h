@@ -0,0 +1,126 @@
+/**
+ * @file      sensor_trace.h
+ * @author    Adrian Silva Palafox
+ * @brief     Flight recorder of raw sensor data seen by the controller
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Keeps the most recent raw inputs of the control stack in a RAM
+ *            ring buffer: MAX6675 frames, AS5048B angle registers, zero-cross
+ *            edges and the control tick that consumed them. Every entry is an
+ *            8-byte record with a timestamp, so a trace dumped from a machine
+ *            can be replayed entry by entry through MAX6675_ProcessFrame(),
+ *            AS5048B_ProcessAngle() and the heater control step to reproduce
+ *            exactly what the controller computed.
+ *
+ *            When the buffer is full the oldest entries are overwritten.
+ *            A control tick writes six records (three thermocouple frames,
+ *            the tick, the encoder angle and the zero-cross count), so at
+ *            the 250 ms tick the buffer holds the last 42 s.
+ *
+ *            Export: the trace is read out with the debugger, as an image of
+ *            the whole SensorTrace_t (e.g. GDB "dump binary value trace.bin
+ *            sensorTrace"). SensorTrace_Freeze() stops recording so the
+ *            lead-up to a fault is still there when the debugger is
+ *            attached. Host/Tools/trace_replay decodes such an image and runs
+ *            it through the drivers and the zone controllers.
+ *
+ * @note      No HAL dependency, the caller provides the timestamps. Records
+ *            must all be written from the same context (the main loop);
+ *            interrupt-driven events are counted and recorded from there.
+ */
+
+#ifndef INC_SENSOR_TRACE_H_
+#define INC_SENSOR_TRACE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of records kept (power of two)
+ */
+#define SENSOR_TRACE_DEPTH      1024U
+
+/**
+ * @brief Record types
+ */
+typedef enum {
+    SENSOR_TRACE_MAX6675 = 1,   /**< value = raw 16-bit frame, channel = device */
+    SENSOR_TRACE_AS5048B,       /**< value = reg 0xFE << 8 | reg 0xFF, channel = encoder */
+    SENSOR_TRACE_ZERO_CROSS,    /**< value = edges accepted since the previous record,
+                                     channel = half-cycles started by the flywheel */
+    SENSOR_TRACE_CONTROL_TICK   /**< value = tick counter (low 16 bits) */
+} SensorTrace_Type_t;
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Trace record (8 bytes)
+ */
+typedef struct {
+    uint32_t time;    /**< Capture time [us] */
+    uint8_t  type;    /**< SensorTrace_Type_t */
+    uint8_t  channel; /**< Device or encoder index */
+    uint16_t value;   /**< Raw data */
+} SensorTrace_Record_t;
+
+/**
+ * @brief Trace control structure
+ */
+typedef struct {
+    SensorTrace_Record_t records[SENSOR_TRACE_DEPTH]; /**< Ring buffer */
+    volatile uint32_t head;    /**< Total records written */
+    volatile uint32_t tail;    /**< Total records read */
+    uint8_t enabled;           /**< Recording enabled */
+} SensorTrace_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Clear the trace and enable recording
+ * @param   trace       Pointer to trace control structure
+ */
+void SensorTrace_Init(SensorTrace_t *trace);
+
+/**
+ * @brief   Append one record, overwriting the oldest when full
+ * @param   trace       Pointer to trace control structure
+ * @param   time        Capture time [us]
+ * @param   type        SensorTrace_Type_t
+ * @param   channel     Device or encoder index
+ * @param   value       Raw data
+ */
+void SensorTrace_Record(SensorTrace_t *trace, uint32_t time, uint8_t type,
+                        uint8_t channel, uint16_t value);
+
+/**
+ * @brief   Stop recording, the records kept stay readable
+ * @details Called on a fault so the records leading to it are not
+ *          overwritten before the trace is exported.
+ * @param   trace       Pointer to trace control structure
+ */
+void SensorTrace_Freeze(SensorTrace_t *trace);
+
+/**
+ * @brief   Record again after SensorTrace_Freeze()
+ * @details Called once the fault is acknowledged, new records overwrite the
+ *          oldest ones from then on.
+ * @param   trace       Pointer to trace control structure
+ */
+void SensorTrace_Resume(SensorTrace_t *trace);
+
+/**
+ * @brief   Take the oldest record out of the trace
+ * @param   trace       Pointer to trace control structure
+ * @param   record      Destination
+ * @return  uint8_t     1 if a record was returned, 0 if the trace is empty
+ */
+uint8_t SensorTrace_Next(SensorTrace_t *trace, SensorTrace_Record_t *record);
+
+/**
+ * @brief   Number of records available to read
+ * @param   trace       Pointer to trace control structure
+ * @return  uint32_t    Record count
+ */
+uint32_t SensorTrace_Count(const SensorTrace_t *trace);
+
+#endif /* INC_SENSOR_TRACE_H_ */
@@ -0,0 +1,99 @@
+/**
+ * @file      smith_predictor.h
+ * @author    Adrian Silva Palafox
+ * @brief     Smith predictor around a zone PID controller
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   A thermocouple in the barrel wall sees a heater change only
+ *            after the heat has crossed the wall (a lag) and, for deep wells,
+ *            after a transport delay. Both sit inside the loop and force low
+ *            gains. The predictor runs a model of the zone twice:
+ *
+ *              m:  barrel rise over ambient due to the heater,
+ *                  C dm/dt = P u / 100 - h m
+ *              md: m through the thermocouple lag and the dead time
+ *
+ *            and feeds the PID with measurement + m - md: the measurement with
+ *            the modelled lag and delay taken out. The PID is then tuned for
+ *            the undelayed barrel; model error and disturbances still reach it
+ *            through the measurement, one dead time later.
+ *
+ *            The model runs on the power actually applied over the previous
+ *            period (after any budget limit), and on deviations from ambient,
+ *            so neither the ambient temperature nor the operating point has to
+ *            be known.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_SMITH_PREDICTOR_H_
+#define INC_SMITH_PREDICTOR_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "pid.h"
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Longest dead time [control periods], 60 s at 250 ms
+ */
+#define SMITH_PREDICTOR_MAX_DELAY   240U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Predictor control structure
+ */
+typedef struct {
+    ThermalModel_Zone_t model;                      /**< Zone model, heat capacity 0 when off */
+    float T;                                        /**< Control period [s] */
+    uint16_t delay;                                 /**< Dead time [control periods] */
+    float undelayed;                                /**< m [°C] */
+    float lagged;                                   /**< m through the thermocouple lag [°C] */
+    float delayed;                                  /**< md [°C] */
+    float history[SMITH_PREDICTOR_MAX_DELAY + 1];   /**< Past lagged values */
+    uint16_t head;                                  /**< Newest entry of history */
+} SmithPredictor_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Set the zone model and dead time
+ * @param   sp          Pointer to predictor control structure
+ * @param   model       Zone model (C, h, P and thermocouple lag), NULL to
+ *                      switch the predictor off
+ * @param   dead_time   Transport delay on top of the thermocouple lag [s]
+ * @param   t           Control period [s]
+ */
+void SmithPredictor_Init(SmithPredictor_t *sp, const ThermalModel_Zone_t *model,
+                         float dead_time, float t);
+
+/**
+ * @brief   Replace the model of a running predictor, keeping its state and
+ *          dead time (a model updated online does not step the PID input)
+ * @param   sp          Pointer to predictor control structure
+ * @param   model       New zone model
+ * @return  uint8_t     1 if replaced, 0 if the predictor is off or the model
+ *                      has no heat capacity
+ */
+uint8_t SmithPredictor_SetModel(SmithPredictor_t *sp, const ThermalModel_Zone_t *model);
+
+/**
+ * @brief   Clear the model state (heaters off, barrel at its reading)
+ * @param   sp          Pointer to predictor control structure
+ */
+void SmithPredictor_Reset(SmithPredictor_t *sp);
+
+/**
+ * @brief   One PID update through the predictor
+ * @param   sp          Pointer to predictor control structure
+ * @param   pid         Zone controller
+ * @param   setpoint    Setpoint [°C]
+ * @param   measurement Thermocouple reading [°C]
+ * @param   applied     Power applied over the previous period [%]
+ * @return  float       Controller output [%]
+ */
+float SmithPredictor_Update(SmithPredictor_t *sp, PIDController *pid, float setpoint,
+                            float measurement, float applied);
+
+#endif /* INC_SMITH_PREDICTOR_H_ */
@@ -57,6 +57,9 @@ void PendSV_Handler(void);
 void SysTick_Handler(void);
 void TIM3_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void EXTI0_IRQHandler(void);
+void EXTI1_IRQHandler(void);
+void TIM1_CC_IRQHandler(void);
 
 /* USER CODE END EFP */
 
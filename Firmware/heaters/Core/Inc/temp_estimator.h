@@ -0,0 +1,103 @@
+/**
+ * @file      temp_estimator.h
+ * @author    Adrian Silva Palafox
+ * @brief     Kalman-filtered zone temperature and heating rate
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Kalman filter per zone on x = [T, T_tc, d]: the barrel
+ *            temperature, the thermocouple temperature lagging it, and the
+ *            heating rate the zone model does not explain (neighbour
+ *            conduction, pellet load, model error), taken as a random walk:
+ *
+ *              dT/dt    = (P u / 100 - h (T - T_amb)) / C + d
+ *              dT_tc/dt = (T - T_tc) / tc_tau
+ *
+ *            TempEstimator_Predict() advances the state with the heater power
+ *            actually applied and can run at any rate; TempEstimator_Correct()
+ *            fuses a MAX6675 reading whenever a fresh one is available. The
+ *            measurement noise covers the quarter-degree quantization. The
+ *            estimate is smooth enough to feed the PID directly (its
+ *            derivative term then sees the model rate instead of quantization
+ *            steps), and it carries on from the power command when a reading
+ *            is missing.
+ *
+ *            The output is the thermocouple temperature, the same quantity the
+ *            raw reading gives, so the controller tuning carries over. The lag
+ *            state matters: without it the estimate would answer the power
+ *            command within one step, faster than the thermocouple can, and a
+ *            derivative term acting on it chatters.
+ *
+ *            The control tick stays at 250 ms, one prediction per reading.
+ *            Predicting five times per reading at a 50 ms tick gives the same
+ *            step response on the bench model to within 10 %: the zones
+ *            respond over minutes and the readings are what limit it.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_TEMP_ESTIMATOR_H_
+#define INC_TEMP_ESTIMATOR_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Filter parameters
+ */
+typedef struct {
+    ThermalModel_Zone_t model;  /**< Zone parameters (C, h, P, thermocouple lag) */
+    float ambient;              /**< Ambient temperature [°C] */
+    float q_temp;               /**< Barrel temperature process noise [°C²/s] */
+    float q_rate;               /**< Unexplained rate process noise [(°C/s)²/s] */
+    float r;                    /**< Reading noise variance [°C²] */
+} TempEstimator_Config_t;
+
+/**
+ * @brief Filter control structure
+ */
+typedef struct {
+    TempEstimator_Config_t config;  /**< Parameters */
+    float x[3];                     /**< Barrel, thermocouple [°C] and unexplained rate [°C/s] */
+    float p[3][3];                  /**< Error covariance */
+    float temp;                     /**< Estimated thermocouple temperature [°C] */
+    float rate;                     /**< Its rate of change [°C/s] */
+    float power;                    /**< Heater power of the last prediction [%] */
+    float innovation;               /**< Last reading minus prediction [°C] */
+    uint8_t primed;                 /**< A reading has been fused */
+} TempEstimator_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the filter, the first reading sets the temperatures
+ * @param   est         Pointer to filter control structure
+ * @param   config      Filter parameters
+ */
+void TempEstimator_Init(TempEstimator_t *est, const TempEstimator_Config_t *config);
+
+/**
+ * @brief   Replace the zone model (e.g. with an identified one)
+ * @param   est         Pointer to filter control structure
+ * @param   model       Zone parameters
+ * @param   ambient     Ambient temperature [°C]
+ */
+void TempEstimator_SetModel(TempEstimator_t *est, const ThermalModel_Zone_t *model, float ambient);
+
+/**
+ * @brief   Advance the estimate
+ * @param   est         Pointer to filter control structure
+ * @param   power       Heater power applied over the step [%]
+ * @param   dt          Step [s]
+ */
+void TempEstimator_Predict(TempEstimator_t *est, float power, float dt);
+
+/**
+ * @brief   Fuse a fresh reading
+ * @param   est         Pointer to filter control structure
+ * @param   measurement Thermocouple reading [°C]
+ */
+void TempEstimator_Correct(TempEstimator_t *est, float measurement);
+
+#endif /* INC_TEMP_ESTIMATOR_H_ */
@@ -0,0 +1,131 @@
+/**
+ * @file      thermal_model.h
+ * @author    Adrian Silva Palafox
+ * @brief     Lumped-parameter thermal model of the three-zone barrel
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Every zone is a thermal mass heated by its band heater, losing heat
+ *            to ambient and exchanging heat with its neighbours through the
+ *            barrel wall:
+ *
+ *              C_i dT_i/dt = P_i u_i - h_i (T_i - T_amb)
+ *                            + k_(i-1) (T_(i-1) - T_i) + k_i (T_(i+1) - T_i) + Q_i
+ *
+ *            where u_i is the heater command in percent and Q_i an external
+ *            heat flow (e.g. cold pellets entering the feed zone). The
+ *            thermocouple follows the barrel through a first-order lag and is
+ *            read back with the MAX6675 quarter-degree quantization, after an
+ *            optional dead time (a thermocouple deep in a well, a reading
+ *            taken downstream): ThermalModel_ReadSensor() returns the
+ *            thermocouple temperature of dead_time seconds ago, interpolated
+ *            from a history kept every THERMAL_MODEL_DELAY_STEP.
+ *
+ *            The model integrates with fixed internal sub-steps, so it runs with
+ *            any step size and only costs a few multiply-adds per zone. It has no
+ *            HAL dependency and is the reference plant for the model-based
+ *            control helpers.
+ *
+ * @note      The temperatures are kept in double precision: near equilibrium a
+ *            sub-step moves a zone by less than half a float ulp at 200 °C and
+ *            a float state would stall up to 0.1 °C short of it. The model is
+ *            a host and bench plant, it is not run by the control loop.
+ */
+
+#ifndef INC_THERMAL_MODEL_H_
+#define INC_THERMAL_MODEL_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of barrel zones
+ */
+#define THERMAL_MODEL_ZONES         3
+
+/**
+ * @brief Longest internal integration step [s]
+ */
+#define THERMAL_MODEL_MAX_STEP      0.05f
+
+/**
+ * @brief MAX6675 resolution [°C]
+ */
+#define THERMAL_MODEL_QUANTUM       0.25f
+
+/**
+ * @brief Reading dead time history: spacing [s] and length [entries], 60 s
+ */
+#define THERMAL_MODEL_DELAY_STEP    0.5f
+#define THERMAL_MODEL_DELAY_LEN     121U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Physical parameters of one zone
+ */
+typedef struct {
+    float heat_capacity; /**< Thermal mass C [J/°C] */
+    float loss;          /**< Loss to ambient h [W/°C] */
+    float heater_power;  /**< Heater power at 100 % command P [W] */
+    float tc_tau;        /**< Thermocouple lag time constant [s] */
+} ThermalModel_Zone_t;
+
+/**
+ * @brief Barrel model state
+ */
+typedef struct {
+    ThermalModel_Zone_t zone[THERMAL_MODEL_ZONES];     /**< Zone parameters */
+    float coupling[THERMAL_MODEL_ZONES - 1];           /**< Conductance between zone i and i+1 [W/°C] */
+    float ambient;                                     /**< Ambient temperature [°C] */
+    float disturbance[THERMAL_MODEL_ZONES];            /**< External heat flow Q [W] */
+    float dead_time[THERMAL_MODEL_ZONES];              /**< Reading dead time [s], 0 for none, up to 60 s */
+    double temp[THERMAL_MODEL_ZONES];                  /**< Barrel temperature [°C] */
+    double tc_temp[THERMAL_MODEL_ZONES];               /**< Thermocouple temperature [°C] */
+    float history[THERMAL_MODEL_DELAY_LEN][THERMAL_MODEL_ZONES]; /**< Past tc_temp, one per DELAY_STEP */
+    uint32_t head;                                     /**< Newest history entry */
+    double since;                                      /**< Time since the newest entry [s] */
+} ThermalModel_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Set every temperature to ambient and clear the disturbances
+ * @param   model       Pointer to model structure (parameters already filled in)
+ * @param   ambient     Ambient temperature [°C]
+ */
+void ThermalModel_Init(ThermalModel_t *model, float ambient);
+
+/**
+ * @brief   Advance the model
+ * @param   model       Pointer to model structure
+ * @param   command     Heater commands [%], one per zone
+ * @param   dt          Time step [s]
+ */
+void ThermalModel_Step(ThermalModel_t *model, const float *command, float dt);
+
+/**
+ * @brief   Thermocouple temperature as the MAX6675 would report it, one dead
+ *          time late
+ * @param   model       Pointer to model structure
+ * @param   zone        Zone index
+ * @return  float       Temperature quantized to THERMAL_MODEL_QUANTUM [°C]
+ */
+float ThermalModel_ReadSensor(const ThermalModel_t *model, uint8_t zone);
+
+/**
+ * @brief   Open-loop time constant of one zone, ignoring coupling (C / h)
+ * @param   model       Pointer to model structure
+ * @param   zone        Zone index
+ * @return  float       Time constant [s]
+ */
+float ThermalModel_TimeConstant(const ThermalModel_t *model, uint8_t zone);
+
+/**
+ * @brief   Steady-state rise per percent of command, ignoring coupling (P / 100 h)
+ * @param   model       Pointer to model structure
+ * @param   zone        Zone index
+ * @return  float       Gain [°C / %]
+ */
+float ThermalModel_Gain(const ThermalModel_t *model, uint8_t zone);
+
+#endif /* INC_THERMAL_MODEL_H_ */
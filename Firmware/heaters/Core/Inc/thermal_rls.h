@@ -0,0 +1,133 @@
+/**
+ * @file      thermal_rls.h
+ * @author    Adrian Silva Palafox
+ * @brief     Online identification of a zone's first-order-plus-dead-time model
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Recursive least squares with exponential forgetting on the
+ *            discrete first-order model with a dead time of d samples:
+ *
+ *              y[k] = a y[k-1] + b u[k-1-d] + c
+ *
+ *            with y the zone temperature and u the heater power actually
+ *            applied. The estimate maps back to the continuous model
+ *            (C dT/dt = P u - h (T - T_amb)):
+ *
+ *              tau = -Ts / ln(a)     gain K = b / (1 - a) [°C/%]
+ *              T_amb = c / (1 - a)   h = P / (100 K)     C = h tau
+ *
+ *            The zone time constants are tens of minutes, so at the 250 ms
+ *            control rate a would sit at 0.9998 and the MAX6675 quantization
+ *            would swamp the fit. ThermalRLS_Update() is called every control
+ *            tick and only averages its inputs; every decimation calls one RLS
+ *            step runs on the averages. Temperature and power are scaled by
+ *            1/100 inside so the regressor entries are of order one. The cost
+ *            per step is fixed (one 3x3 covariance update).
+ *
+ *            The dead time is configured, not estimated (in Ts samples; it
+ *            covers the thermocouple lag and the heater band). Steps where
+ *            neither the temperature nor the power moved are skipped, and the
+ *            covariance trace is capped, so holding a setpoint for hours does
+ *            not let the forgetting wind the covariance up.
+ *
+ *            The model is per zone: heat conducted from the neighbours folds
+ *            into the estimated loss and ambient, which then describe the zone
+ *            as the controller sees it rather than the bare heater band. The
+ *            heat capacity is the best determined parameter; loss and ambient
+ *            only separate after warm-ups or setpoint changes.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_THERMAL_RLS_H_
+#define INC_THERMAL_RLS_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Longest dead time [samples]
+ */
+#define THERMAL_RLS_MAX_DELAY       8
+
+/**
+ * @brief Steps before the estimate is reported valid
+ */
+#define THERMAL_RLS_MIN_UPDATES     30U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Estimator parameters
+ */
+typedef struct {
+    float dt;                   /**< Time between ThermalRLS_Update() calls [s] */
+    uint16_t decimation;        /**< Calls averaged per RLS step */
+    uint8_t delay;              /**< Dead time [samples], at most THERMAL_RLS_MAX_DELAY */
+    float lambda;               /**< Forgetting factor (0..1], memory ~ 1 / (1 - lambda) steps */
+    float p0;                   /**< Initial covariance diagonal */
+    float p_max;                /**< Covariance trace cap */
+    float min_dy;               /**< Smallest temperature change that counts as excitation [°C] */
+    float min_du;               /**< Smallest power change that counts as excitation [%] */
+    ThermalModel_Zone_t prior;  /**< Starting model (heater power is taken as known) */
+    float ambient;              /**< Starting ambient temperature [°C] */
+} ThermalRLS_Config_t;
+
+/**
+ * @brief Estimator control structure
+ */
+typedef struct {
+    ThermalRLS_Config_t config;             /**< Parameters */
+    float theta[3];                         /**< a, b, c (scaled) */
+    float p[3][3];                          /**< Covariance */
+    float u_hist[THERMAL_RLS_MAX_DELAY + 1];/**< Past averaged inputs (scaled) */
+    uint8_t head;                           /**< Newest entry of u_hist */
+    uint8_t filled;                         /**< Entries of u_hist in use */
+    float y_prev;                           /**< Previous averaged temperature (scaled) */
+    float u_sum;                            /**< Power summed in this step [%] */
+    float y_sum;                            /**< Temperature summed in this step [°C] */
+    uint16_t count;                         /**< Calls summed in this step */
+    uint32_t updates;                       /**< RLS steps since reset */
+    float residual;                         /**< Last one-step prediction error [°C] */
+
+    /* Live model, refreshed after every step */
+    float tau;                              /**< Time constant [s] */
+    float gain;                             /**< Static gain [°C/%] */
+    float ambient;                          /**< Temperature at 0 % [°C] */
+    uint8_t valid;                          /**< Estimate settled and physical (0 < a < 1, b > 0) */
+} ThermalRLS_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the estimator from its prior model
+ * @param   rls         Pointer to estimator control structure
+ * @param   config      Estimator parameters
+ */
+void ThermalRLS_Init(ThermalRLS_t *rls, const ThermalRLS_Config_t *config);
+
+/**
+ * @brief   Restart from the prior model (e.g. after a heater change)
+ * @param   rls         Pointer to estimator control structure
+ */
+void ThermalRLS_Reset(ThermalRLS_t *rls);
+
+/**
+ * @brief   Feed one control tick of data
+ * @param   rls         Pointer to estimator control structure
+ * @param   power       Heater power applied since the previous call [%]
+ * @param   temp        Zone temperature [°C]
+ * @return  uint8_t     1 when an RLS step ran on this call
+ */
+uint8_t ThermalRLS_Update(ThermalRLS_t *rls, float power, float temp);
+
+/**
+ * @brief   Live estimate as physical zone parameters
+ * @param   rls         Pointer to estimator control structure
+ * @param   zone        Filled with C, h and the known P and thermocouple lag
+ * @return  uint8_t     1 if the estimate is valid, zone untouched otherwise
+ */
+uint8_t ThermalRLS_GetZone(const ThermalRLS_t *rls, ThermalModel_Zone_t *zone);
+
+#endif /* INC_THERMAL_RLS_H_ */
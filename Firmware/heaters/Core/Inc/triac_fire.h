@@ -0,0 +1,119 @@
+/**
+ * @file      triac_fire.h
+ * @author    Adrian Silva Palafox
+ * @brief     Phase-angle TRIAC firing for the barrel heaters
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   TIM2 runs in one-pulse mode and is restarted by the zero-cross
+ *            detector on TI2 (PA1) every mains half-cycle. Each zone owns one
+ *            output channel in PWM mode 2: the gate turns on when the counter
+ *            reaches the phase delay held in CCRx and stays on until the end of
+ *            the timer period, just before the next zero crossing.
+ *
+ *              zone 0  TIM2_CH1  PA0  fire
+ *              zone 1  TIM2_CH3  PA2  fire_1
+ *              zone 2  TIM2_CH4  PA3  fire_2
+ *
+ *            All three pins are set up in heaters.ioc (labels above), so
+ *            HAL_TIM_MspPostInit() configures them. Each one drives the LED of
+ *            its zone's optotriac gate driver, wired the same way as the
+ *            original zone 0 output on PA0.
+ *
+ *            The power percentage is converted to a phase delay through a table
+ *            built at init, so that the delivered energy (not the conduction
+ *            angle) is proportional to the command. Compare registers are
+ *            preloaded, a new power takes effect on the next half-cycle.
+ *
+ *            The table delays are counted from the true zero crossing. The
+ *            timer starts some time away from it (detector pulse width, input
+ *            filter, optocoupler delay), so that offset, set with
+ *            TriacFire_SetCompensation(), is subtracted from every delay.
+ *
+ *            TriacFire_Kill() is the emergency path: it forces every output
+ *            inactive and detaches the timer from the zero-cross trigger with
+ *            direct register writes, so it can be called from any context and
+ *            takes effect immediately, inside the current half-cycle.
+ */
+
+#ifndef INC_TRIAC_FIRE_H_
+#define INC_TRIAC_FIRE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of heater zones fired
+ */
+#define TRIAC_FIRE_ZONES            3
+
+/**
+ * @brief Mains half-cycle [us] (60 Hz)
+ */
+#define TRIAC_FIRE_HALF_CYCLE_US    8333U
+
+/**
+ * @brief Firing window [us]
+ * @note  Earliest: the zero-cross pulse is wide and the triac needs some
+ *        voltage to latch. Latest: leaves a usable gate pulse before the
+ *        timer period (8300 us) ends.
+ */
+#define TRIAC_FIRE_MIN_DELAY_US     300U
+#define TRIAC_FIRE_MAX_DELAY_US     7800U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief TRIAC firing control structure
+ */
+typedef struct {
+    TIM_HandleTypeDef *htim;      /**< Zero-cross triggered timer */
+    uint16_t delay[101];          /**< Phase delay per percent of power [us] */
+    uint32_t off;                 /**< Compare value that never fires */
+    int32_t compensation;         /**< Timer start after the true zero crossing [us] */
+    uint32_t ccmr1;               /**< Channel modes saved for re-arming */
+    uint32_t ccmr2;
+    uint32_t smcr;                /**< Slave mode saved for re-arming */
+    volatile uint8_t armed;       /**< 0 after TriacFire_Kill() */
+} TriacFire_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Configure the output channels, build the delay table and arm
+ * @param   fire        Pointer to firing control structure
+ * @param   htim        Timer handle (TIM2, already initialized)
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef TriacFire_Init(TriacFire_t *fire, TIM_HandleTypeDef *htim);
+
+/**
+ * @brief   Set the power of one zone from the next half-cycle on
+ * @param   fire        Pointer to firing control structure
+ * @param   zone        Zone index (0..TRIAC_FIRE_ZONES-1)
+ * @param   percent     Power [%], clamped to 0..100
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR if killed or invalid zone)
+ */
+HAL_StatusTypeDef TriacFire_SetPower(TriacFire_t *fire, uint8_t zone, float percent);
+
+/**
+ * @brief   Set the timer start offset subtracted from every firing delay
+ * @param   fire        Pointer to firing control structure
+ * @param   offset_us   Timer start after the true zero crossing [us], negative
+ *                      when the detector edge comes before it
+ */
+void TriacFire_SetCompensation(TriacFire_t *fire, float offset_us);
+
+/**
+ * @brief   Stop firing every zone immediately
+ * @param   fire        Pointer to firing control structure
+ */
+void TriacFire_Kill(TriacFire_t *fire);
+
+/**
+ * @brief   Re-enable firing after TriacFire_Kill(), every zone off
+ * @param   fire        Pointer to firing control structure
+ */
+void TriacFire_Arm(TriacFire_t *fire);
+
+#endif /* INC_TRIAC_FIRE_H_ */
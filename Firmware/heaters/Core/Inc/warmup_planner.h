@@ -0,0 +1,107 @@
+/**
+ * @file      warmup_planner.h
+ * @author    Adrian Silva Palafox
+ * @brief     Staggered warm-up so every zone reaches its setpoint together
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Instead of stepping every zone straight to its target, the
+ *            controllers follow linear setpoint ramps that all end at the same
+ *            moment. The ramp duration is the shortest one that every zone and
+ *            the shared budget can follow, from the zone parameters
+ *            (C dT/dt = P u - h (T - T_amb), coupling ignored):
+ *
+ *              - per zone:   C rise / (headroom P - h (T_mid - T_amb))
+ *              - budget:     sum(C rise) / (headroom budget - sum(h (T_mid - T_amb)))
+ *              - rate limit: rise / ramp_limit (material heat-up limit)
+ *
+ *            with T_mid the middle of the ramp, i.e. the mean loss while it
+ *            runs. The headroom left to the controllers covers the higher
+ *            loss at the top of the ramp and the parameter errors.
+ *
+ *            Light zones then no longer reach temperature early and idle (or
+ *            overshoot) while the heaviest one is still heating.
+ *
+ *            WarmupPlanner_Step() sits on the setpoint path to the controllers:
+ *            it turns the final setpoints into the ramp setpoints and replans
+ *            from the current temperatures when the final setpoints change.
+ *            The planned (expected) and measured (actual) time-to-ready are
+ *            kept for comparison.
+ *
+ * @note      No HAL dependency.
+ */
+
+#ifndef INC_WARMUP_PLANNER_H_
+#define INC_WARMUP_PLANNER_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "thermal_model.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Number of planned zones
+ */
+#define WARMUP_PLANNER_ZONES    THERMAL_MODEL_ZONES
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Planner parameters
+ */
+typedef struct {
+    ThermalModel_Zone_t zone[WARMUP_PLANNER_ZONES]; /**< Identified zone parameters */
+    float ambient;                                  /**< Ambient temperature [°C] */
+    float budget;                                   /**< Total heater power available [W] */
+    float headroom;                                 /**< Share of the power planned for, the rest is left to the controllers (0..1] */
+    float ramp_limit;                               /**< Fastest ramp allowed [°C/s], 0 for none */
+    float band;                                     /**< A zone is ready within this of its target [°C] */
+} WarmupPlanner_Config_t;
+
+/**
+ * @brief Planner control structure
+ */
+typedef struct {
+    WarmupPlanner_Config_t config;                  /**< Parameters */
+    float target[WARMUP_PLANNER_ZONES];             /**< Final setpoints planned for [°C] */
+    float start[WARMUP_PLANNER_ZONES];              /**< Temperatures when the plan started [°C] */
+    float elapsed;                                  /**< Time since the plan started [s] */
+    float expected;                                 /**< Planned time-to-ready [s], 0 when nothing to ramp */
+    float actual;                                   /**< Measured time-to-ready [s], -1 until ready */
+    uint8_t active;                                 /**< A plan is running */
+} WarmupPlanner_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Initialize the planner with no plan running
+ * @param   planner     Pointer to planner control structure
+ * @param   config      Planner parameters
+ */
+void WarmupPlanner_Init(WarmupPlanner_t *planner, const WarmupPlanner_Config_t *config);
+
+/**
+ * @brief   Plan the ramps from the current temperatures
+ * @param   planner     Pointer to planner control structure
+ * @param   targets     Final setpoints [°C]
+ * @param   temps       Zone temperatures [°C]
+ */
+void WarmupPlanner_Start(WarmupPlanner_t *planner, const float *targets, const float *temps);
+
+/**
+ * @brief   Advance the plan and produce the controller setpoints
+ * @param   planner     Pointer to planner control structure
+ * @param   targets     Final setpoints [°C]
+ * @param   temps       Zone temperatures [°C]
+ * @param   dt          Time since the previous step [s]
+ * @param   setpoints   Setpoints for the controllers [°C], the targets when no
+ *                      plan is running
+ */
+void WarmupPlanner_Step(WarmupPlanner_t *planner, const float *targets, const float *temps,
+                        float dt, float *setpoints);
+
+/**
+ * @brief   Drop the running plan
+ * @param   planner     Pointer to planner control structure
+ */
+void WarmupPlanner_Stop(WarmupPlanner_t *planner);
+
+#endif /* INC_WARMUP_PLANNER_H_ */
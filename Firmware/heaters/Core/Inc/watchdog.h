@@ -0,0 +1,134 @@
+/**
+ * @file      watchdog.h
+ * @author    Adrian Silva Palafox
+ * @brief     Independent watchdog with per-task liveness tracking
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   The IWDG runs from the LSI oscillator and cannot be stopped once
+ *            started. It is only reloaded by Watchdog_Service() when every
+ *            registered task has checked in within its own deadline, so a task
+ *            that stops running (e.g. a bus transfer that never completes) lets
+ *            the watchdog reset the MCU, which leaves every heater output off.
+ *
+ *            Every check-in is recorded in a .noinit RAM area that the startup
+ *            code does not clear: the task, its tick and the last check-in of
+ *            every task. The record is therefore current even when the main
+ *            loop hangs before Watchdog_Service() can see the stall. After a
+ *            watchdog reset, Watchdog_Init() names the overdue task, either the
+ *            one Watchdog_Service() found or the registered task whose last
+ *            check-in is the oldest, and Watchdog_LastFailure() reports it.
+ *            The IWDG of the F411 has no early-warning interrupt to catch the
+ *            stall itself.
+ *
+ * @note      Driven through the IWDG registers directly; the HAL IWDG module is
+ *            not part of this project. The timeout covers the longest flash
+ *            erase done from the main loop (128 KB log sector).
+ */
+
+#ifndef INC_WATCHDOG_H_
+#define INC_WATCHDOG_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Watchdog timeout [ms] (LSI 32 kHz / 64, at most 8190 ms)
+ */
+#define WATCHDOG_TIMEOUT_MS     3000U
+
+/**
+ * @brief Marker of a valid failure record
+ */
+#define WATCHDOG_RECORD_MAGIC   0x57444F47U /* "WDOG" */
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Supervised tasks
+ */
+typedef enum {
+    WATCHDOG_TASK_SENSORS = 0,  /**< Thermocouple acquisition */
+    WATCHDOG_TASK_CONTROL,      /**< Control tick */
+    WATCHDOG_TASK_FIRING,       /**< Heater output update */
+    WATCHDOG_TASK_ENCODERS,     /**< Encoder reads in the main loop */
+    WATCHDOG_TASK_COMMS,        /**< Host communication */
+    WATCHDOG_TASKS
+} Watchdog_Task_t;
+
+/**
+ * @brief Failure record kept across the reset (.noinit)
+ */
+typedef struct {
+    uint32_t magic;     /**< WATCHDOG_RECORD_MAGIC when valid */
+    uint32_t task;      /**< Watchdog_Task_t that missed its deadline,
+                             WATCHDOG_TASKS until one is known */
+    uint32_t overdue;   /**< Time since its last check-in [ms] */
+    uint32_t tick;      /**< HAL tick of the stall detection or, if the loop
+                             hung first, of the last check-in [ms] */
+    uint32_t resets;    /**< Watchdog resets since power-up */
+    uint32_t last_task; /**< Watchdog_Task_t that checked in last */
+    uint32_t registered;                /**< Bit n set when task n is supervised */
+    uint32_t last[WATCHDOG_TASKS];      /**< HAL tick of each task's last check-in [ms] */
+} Watchdog_Record_t;
+
+/**
+ * @brief Watchdog control structure
+ */
+typedef struct {
+    uint32_t deadline[WATCHDOG_TASKS];      /**< Longest time between check-ins [ms] */
+    volatile uint32_t last[WATCHDOG_TASKS]; /**< HAL tick of the last check-in [ms] */
+    uint32_t registered;                    /**< Bit n set when task n is supervised */
+    uint8_t  stalled;                       /**< A task missed its deadline, kicks withheld */
+} Watchdog_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Read the previous reset cause and start the IWDG
+ * @param   wd          Pointer to watchdog control structure
+ */
+void Watchdog_Init(Watchdog_t *wd);
+
+/**
+ * @brief   Supervise a task
+ * @param   wd          Pointer to watchdog control structure
+ * @param   task        Watchdog_Task_t
+ * @param   deadline_ms Longest time allowed between check-ins [ms]
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef Watchdog_Register(Watchdog_t *wd, uint8_t task, uint32_t deadline_ms);
+
+/**
+ * @brief   Report that a task has run
+ * @param   wd          Pointer to watchdog control structure
+ * @param   task        Watchdog_Task_t
+ */
+void Watchdog_CheckIn(Watchdog_t *wd, uint8_t task);
+
+/**
+ * @brief   Reload the IWDG if every registered task is alive
+ * @param   wd          Pointer to watchdog control structure
+ * @return  HAL_StatusTypeDef   HAL_OK if reloaded, HAL_TIMEOUT if a task is
+ *                              overdue (the reset will follow)
+ */
+HAL_StatusTypeDef Watchdog_Service(Watchdog_t *wd);
+
+/**
+ * @brief   Restart every deadline after a deliberate stall
+ * @details For blocking flash work done while the process is stopped (log
+ *          sector rotation). Call Watchdog_Service() right before the stall,
+ *          which must stay below WATCHDOG_TIMEOUT_MS. A task already found
+ *          overdue stays overdue.
+ * @param   wd          Pointer to watchdog control structure
+ */
+void Watchdog_Restart(Watchdog_t *wd);
+
+/**
+ * @brief   Failure that caused the last reset
+ * @return  const Watchdog_Record_t*   Record, NULL if the last reset was not
+ *                                     caused by the watchdog
+ */
+const Watchdog_Record_t *Watchdog_LastFailure(void);
+
+#endif /* INC_WATCHDOG_H_ */
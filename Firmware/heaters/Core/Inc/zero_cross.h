@@ -0,0 +1,192 @@
+/**
+ * @file      zero_cross.h
+ * @author    Adrian Silva Palafox
+ * @brief     Zero-cross detector timing and firing delay compensation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   The detector output (PA1) is a pulse centred on the mains zero
+ *            crossing, and the firing timer starts on its filtered rising
+ *            edge. Relative to the true zero crossing the timer therefore
+ *            starts at:
+ *
+ *              offset = opto_delay + filter_delay - width / 2
+ *
+ *            where width is the pulse width (it changes with the mains voltage
+ *            and the optocoupler gain) and filter_delay follows from the TI2
+ *            input filter setting. The offset is passed to
+ *            TriacFire_SetCompensation() so every firing delay is counted
+ *            from the true zero crossing.
+ *
+ *            Both edges of the detector pulse (EXTI1) and the rising edge of
+ *            the zone 0 gate output (PA0, EXTI0) are timestamped with the DWT
+ *            cycle counter. The pulse centre is the reference: the time from
+ *            it to the gate edge is the measured zero-cross-to-fire latency,
+ *            and comparing it with the delay that was requested gives the
+ *            residual error of the compensation. Both interrupts have the
+ *            same entry latency, which cancels in the difference.
+ *
+ *            Flywheel: the half-cycle period is tracked from the accepted
+ *            edges. TIM1 is reset by TIM2 whenever the firing timer starts
+ *            (TIM2 TRGO = enable, TIM1 slave reset on ITR1) and its channel 1
+ *            expires one period plus ZERO_CROSS_WINDOW_US later. If no edge
+ *            has started TIM2 by then, the edge is taken as missing and TIM2 is
+ *            started by software, with its counter advanced to where the
+ *            predicted edge would have put it, so the half-cycle still fires
+ *            at the right phase. After ZERO_CROSS_LOST_LIMIT consecutive
+ *            missing edges the flywheel gives up and flags the detector as
+ *            lost until a real edge comes back.
+ *
+ *            Noise: TIM2 ignores its trigger while it runs (most of the
+ *            half-cycle). Once locked, its slave mode is also cleared from the
+ *            accepted edge (or flywheel start) until TIM1 channel 2 opens the
+ *            acceptance window, ZERO_CROSS_WINDOW_US before the predicted edge,
+ *            so a glitch in the gap between the end of the firing period and
+ *            the window cannot start the half-cycle in hardware either. Edges
+ *            outside the window are rejected for the period tracking and the
+ *            pulse measurement. The window stays open until lock and after
+ *            the detector is lost, and never opens while the TRIACs are
+ *            killed.
+ *
+ *            The handlers run from SRAM and are called straight from the
+ *            EXTI0/EXTI1/TIM1_CC vectors in stm32f4xx_it.c, not through the HAL
+ *            IRQ handlers. They only store timestamps or restart the timer;
+ *            ZeroCross_Update() processes the latest samples from the control
+ *            tick, and records the accepted and flywheel half-cycles since the
+ *            previous tick in the sensor trace when one is attached.
+ */
+
+#ifndef INC_ZERO_CROSS_H_
+#define INC_ZERO_CROSS_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "profiling.h"
+#include "sensor_trace.h"
+#include "triac_fire.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Detector propagation delay [us] (board dependent)
+ */
+#define ZERO_CROSS_OPTO_DELAY_US    10.0f
+
+/**
+ * @brief Plausible pulse widths [us], anything else is taken as noise
+ */
+#define ZERO_CROSS_MIN_WIDTH_US     20U
+#define ZERO_CROSS_MAX_WIDTH_US     2000U
+
+/**
+ * @brief Weight of a new pulse width in the filtered width
+ */
+#define ZERO_CROSS_WIDTH_ALPHA      0.125f
+
+/**
+ * @brief Time an edge may come after the predicted one before the flywheel
+ *        starts the half-cycle [us]
+ */
+#define ZERO_CROSS_WINDOW_US        100U
+
+/**
+ * @brief Largest firing timer count when the edge that started it is seen
+ *        (EXTI entry latency against the trigger filter) [us]
+ */
+#define ZERO_CROSS_EDGE_SLACK_US    20U
+
+/**
+ * @brief Consecutive missing edges before the detector is flagged as lost
+ */
+#define ZERO_CROSS_LOST_LIMIT       12U
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Zero-cross timing control structure
+ */
+typedef struct {
+    TriacFire_t *fire;              /**< Firing control, its timer is gated */
+    TIM_HandleTypeDef *htim;        /**< Zero-cross triggered firing timer */
+    TIM_HandleTypeDef *htim_fly;    /**< Flywheel deadline timer */
+    uint32_t cycles_per_us;         /**< Core cycles per microsecond */
+    float opto_delay;               /**< Detector propagation delay [us] */
+    float filter_delay;             /**< Trigger input filter delay [us] */
+    float width;                    /**< Filtered pulse width [us], 0 until measured */
+    float compensation;             /**< Timer start after the true zero crossing [us] */
+    float error;                    /**< Last measured minus requested firing time [us] */
+    Profiling_Stopwatch_t pulse;    /**< Detector pulse widths [cycles] */
+    Profiling_Stopwatch_t latency;  /**< Pulse centre to zone 0 gate [cycles] */
+    SensorTrace_t *trace;           /**< Trace of the edge counts, NULL for none */
+    uint32_t traced_edges;          /**< edges at the last trace record */
+    uint32_t traced_flywheel;       /**< flywheel at the last trace record */
+
+    /* Written by the interrupt handlers */
+    volatile uint32_t rise;         /**< Cycle counter at the last rising edge */
+    volatile uint32_t edge_width;   /**< Width of the last pulse [cycles] */
+    volatile uint32_t fire_rise;    /**< Rising edge of the half-cycle last fired */
+    volatile uint32_t fire_time;    /**< Cycle counter at the last gate edge */
+    volatile uint32_t fire_compare; /**< Zone 0 compare value when it fired [us] */
+    volatile uint8_t  in_pulse;     /**< Rising edge accepted, falling edge pending */
+    volatile uint8_t  new_width;    /**< edge_width not processed yet */
+    volatile uint8_t  new_fire;     /**< fire_time not processed yet */
+    volatile uint32_t period;       /**< Tracked half-cycle [cycles], 0 until locked */
+    volatile uint32_t edges;        /**< Accepted edges */
+    volatile uint32_t missed;       /**< Consecutive missing edges */
+    volatile uint32_t flywheel;     /**< Half-cycles started by the flywheel */
+    volatile uint32_t rejected;     /**< Edges rejected as noise */
+    volatile uint8_t  lost;         /**< Too many missing edges, flywheel stopped */
+} ZeroCross_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Derive the filter delay, set up the flywheel and enable the edge
+ *          interrupts
+ * @param   zc          Pointer to zero-cross control structure
+ * @param   fire        Firing control (TriacFire_Init() done), its timer is
+ *                      started by the detector
+ * @param   htim_fly    Flywheel timer handle (TIM1, reconfigured here)
+ * @param   opto_delay  Detector propagation delay [us]
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR)
+ */
+HAL_StatusTypeDef ZeroCross_Init(ZeroCross_t *zc, TriacFire_t *fire,
+                                 TIM_HandleTypeDef *htim_fly, float opto_delay);
+
+/**
+ * @brief   Detector edge interrupt (EXTI1, both edges)
+ * @param   zc          Pointer to zero-cross control structure
+ */
+void ZeroCross_EdgeISR(ZeroCross_t *zc);
+
+/**
+ * @brief   Zone 0 gate edge interrupt (EXTI0, rising edge)
+ * @param   zc          Pointer to zero-cross control structure
+ */
+void ZeroCross_FireISR(ZeroCross_t *zc);
+
+/**
+ * @brief   Flywheel deadline interrupt (TIM1 compare 1)
+ * @param   zc          Pointer to zero-cross control structure
+ */
+void ZeroCross_DeadlineISR(ZeroCross_t *zc);
+
+/**
+ * @brief   Acceptance window interrupt (TIM1 compare 2)
+ * @param   zc          Pointer to zero-cross control structure
+ */
+void ZeroCross_WindowISR(ZeroCross_t *zc);
+
+/**
+ * @brief   Record the edge counts in a sensor trace from now on
+ * @param   zc          Pointer to zero-cross control structure
+ * @param   trace       Trace to write to, NULL to stop
+ */
+void ZeroCross_SetTrace(ZeroCross_t *zc, SensorTrace_t *trace);
+
+/**
+ * @brief   Process the latest samples and update the firing compensation
+ * @param   zc          Pointer to zero-cross control structure
+ * @param   fire        Firing control structure to compensate
+ */
+void ZeroCross_Update(ZeroCross_t *zc, TriacFire_t *fire);
+
+#endif /* INC_ZERO_CROSS_H_ */
@@ -14,12 +14,9 @@ static HAL_StatusTypeDef user_i2c_read(AS5048B_Driver_t *drv,
                                       uint8_t *reg_data,
                                       uint16_t len)
 {
-    uint16_t addr = dev_id;
-    HAL_StatusTypeDef rslt;
-
-    rslt = HAL_I2C_Master_Transmit(drv->hi2c, addr, &reg_addr, 1, HAL_MAX_DELAY);
-    if (rslt != HAL_OK) return rslt;
-    return HAL_I2C_Master_Receive(drv->hi2c, addr, reg_data, len, HAL_MAX_DELAY);
+    /* Register address, repeated start, then auto-incremented reads */
+    return HAL_I2C_Mem_Read(drv->hi2c, dev_id, reg_addr, I2C_MEMADD_SIZE_8BIT,
+                            reg_data, len, AS5048B_I2C_TIMEOUT_MS);
 }
 
 static HAL_StatusTypeDef user_i2c_write(AS5048B_Driver_t *drv,
@@ -28,12 +25,9 @@ static HAL_StatusTypeDef user_i2c_write(AS5048B_Driver_t *drv,
                                        uint8_t *reg_data,
                                        uint16_t len)
 {
-    uint16_t addr = dev_id;
-    HAL_StatusTypeDef rslt;
-
-    rslt = HAL_I2C_Master_Transmit(drv->hi2c, addr, &reg_addr, 1, HAL_MAX_DELAY);
-    if (rslt != HAL_OK) return rslt;
-    return HAL_I2C_Master_Transmit(drv->hi2c, addr, reg_data, len, HAL_MAX_DELAY);
+    /* Register address and data must go in the same transaction */
+    return HAL_I2C_Mem_Write(drv->hi2c, dev_id, reg_addr, I2C_MEMADD_SIZE_8BIT,
+                             reg_data, len, AS5048B_I2C_TIMEOUT_MS);
 }
 
 /* Public API ---------------------------------------------------------------*/
@@ -57,15 +51,15 @@ HAL_StatusTypeDef AS5048B_AddDevice(AS5048B_Driver_t *driver,
     driver->device_count++;
 
     // Verify if there's connection to device
-    return HAL_I2C_IsDeviceReady(driver->hi2c, dev_id << 1, 1, HAL_MAX_DELAY);
+    return HAL_I2C_IsDeviceReady(driver->hi2c, dev_id << 1, 1, AS5048B_I2C_TIMEOUT_MS);
 }
 
 void find_dev_id_address(AS5048B_Driver_t *driver)
 {
     uint8_t found = 0;
     for (uint8_t addr = 0; addr <= MAX_I2C_ADDR && found < driver->device_count; addr++) {
-        if (HAL_I2C_IsDeviceReady(driver->hi2c, addr << 1, 1, HAL_MAX_DELAY) == HAL_OK) {
-            driver->devices[found++].dev_id = addr;
+        if (HAL_I2C_IsDeviceReady(driver->hi2c, addr << 1, 1, AS5048B_I2C_TIMEOUT_MS) == HAL_OK) {
+            driver->devices[found++].dev_id = addr << 1; // Use 8-bit address
         }
     }
 }
@@ -74,12 +68,12 @@ HAL_StatusTypeDef AS5048B_UpdateRegisters(AS5048B_Driver_t *driver,
 										  uint8_t num_encoder)
 {
     AS5048B_Sensor *sens = &driver->devices[num_encoder];
-    uint8_t buf[8];
+    uint8_t buf[10];
     HAL_StatusTypeDef st = HAL_OK;
 
     st |= user_i2c_read(driver, sens->dev_id, REG_PROG_CTRL, buf, 1);
     st |= user_i2c_read(driver, sens->dev_id, REG_I2C_ADDR, buf + 1, 3); // read from REG_I2C_ADDR to REG_ZERO_POS_LOW
-    st |= user_i2c_read(driver, sens->dev_id, REG_AGC, buf + 4, 4); // read from REG_AGC to REG_MAGNITUDE_LOW
+    st |= user_i2c_read(driver, sens->dev_id, REG_AGC, buf + 4, 6); // read from REG_AGC to REG_ANGLE_LOW
 
     sens->registers.prog_ctrl              = buf[0];
     sens->registers.i2c_slave_addr         = buf[1];
@@ -89,6 +83,8 @@ HAL_StatusTypeDef AS5048B_UpdateRegisters(AS5048B_Driver_t *driver,
     sens->registers.diagnostics            = buf[5];
     sens->registers.magnitude_high         = buf[6];
     sens->registers.magnitude_low          = buf[7];
+    sens->registers.angle_high             = buf[8];
+    sens->registers.angle_low              = buf[9];
     return st;
 }
 
@@ -113,9 +109,10 @@ HAL_StatusTypeDef AS5048B_SetZeroPosition(AS5048B_Driver_t *driver,
 	 * 8. Read angle information (equals to 0)
      */
     // 1.-
-    st = user_i2c_write(driver, sens->dev_id, REG_ZERO_POS_HIGH, data, 1);
+    st = user_i2c_write(driver, sens->dev_id, REG_ZERO_POS_HIGH, data, 2);
+    if (st != HAL_OK) return st;
     // 2.-
-    AS5048B_GetAngleDegrees(driver, sens->dev_id);
+    if (AS5048B_GetAngleDegrees(driver, num_encoder) < 0.0f) return HAL_ERROR;
     data[0] = sens->registers.angle_high;
     data[1] = sens->registers.angle_low;
     // 3-
@@ -124,6 +121,19 @@ HAL_StatusTypeDef AS5048B_SetZeroPosition(AS5048B_Driver_t *driver,
     return st;
 }
 
+HAL_StatusTypeDef AS5048B_WriteZeroPosition(AS5048B_Driver_t *driver,
+                                            uint8_t num_encoder,
+                                            uint16_t position)
+{
+    AS5048B_Sensor *sens = &driver->devices[num_encoder];
+    uint8_t data[2];
+
+    /* Register 0x16 holds bits 13..6, register 0x17 bits 5..0 */
+    data[0] = (uint8_t)((position >> 6) & 0xFF);
+    data[1] = (uint8_t)(position & 0x3F);
+    return user_i2c_write(driver, sens->dev_id, REG_ZERO_POS_HIGH, data, 2);
+}
+
 float AS5048B_GetAngleDegrees(AS5048B_Driver_t *driver,
                               uint8_t num_encoder)
 {
@@ -132,13 +142,28 @@ float AS5048B_GetAngleDegrees(AS5048B_Driver_t *driver,
 
     if (user_i2c_read(driver, sens->dev_id, REG_ANGLE_HIGH, data, 2) != HAL_OK) return -1.0f; //error
 
+    return AS5048B_ProcessAngle(driver, num_encoder, data);
+}
+
+float AS5048B_ProcessAngle(AS5048B_Driver_t *driver,
+                           uint8_t num_encoder,
+                           const uint8_t data[2])
+{
+    AS5048B_Sensor *sens = &driver->devices[num_encoder];
+
     /* Store raw */
     sens->registers.angle_high = data[0];
     sens->registers.angle_low = data[1];
 
-    /* Compute it to degrees*/
-    uint16_t raw = ((uint16_t)data[1] << 6) | (data[0] >> 2);
-    return raw * 360.0f / 16384.0f;
+    /* Compute it to degrees (0xFE holds bits 13..6, 0xFF bits 5..0) */
+    return AS5048B_GetRawAngle(driver, num_encoder) * 360.0f / 16384.0f;
+}
+
+uint16_t AS5048B_GetRawAngle(AS5048B_Driver_t *driver,
+                             uint8_t num_encoder)
+{
+    AS5048B_Sensor *sens = &driver->devices[num_encoder];
+    return ((uint16_t)sens->registers.angle_high << 6) | sens->registers.angle_low;
 }
 
 float AS5048B_GetAngleRadians(AS5048B_Driver_t *driver,
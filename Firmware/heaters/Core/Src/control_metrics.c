@@ -0,0 +1,129 @@
+/**
+ * @file      control_metrics.c
+ * @author    Adrian Silva Palafox
+ * @brief     Closed-loop step response scoring implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "control_metrics.h"
+
+/**
+ * @brief Start scoring a setpoint step
+ *
+ * @param metrics  Pointer to metrics structure
+ * @param start    Temperature at the step [°C]
+ * @param setpoint New setpoint [°C]
+ * @param band     Half-width of the settling band [°C]
+ */
+void ControlMetrics_Start(ControlMetrics_t *metrics, float start, float setpoint, float band)
+{
+    metrics->setpoint = setpoint;
+    metrics->start = start;
+    metrics->band = band;
+    metrics->elapsed = 0.0f;
+    metrics->iae = 0.0f;
+    metrics->energy = 0.0f;
+    metrics->peak = start;
+    metrics->overshoot = 0.0f;
+    metrics->settling_time = 0.0f;
+    metrics->band_min = setpoint + band;
+    metrics->band_max = setpoint - band;
+    metrics->ripple = 0.0f;
+    metrics->max_error = 0.0f;
+
+    /* A step inside the band has nothing to rise through */
+    if (setpoint - start <= band && start - setpoint <= band) {
+        metrics->rise_start = 0.0f;
+        metrics->rise_time = 0.0f;
+    } else {
+        metrics->rise_start = -1.0f;
+        metrics->rise_time = -1.0f;
+    }
+}
+
+/**
+ * @brief Accumulate one sample
+ *
+ * @param metrics Pointer to metrics structure
+ * @param temp    Measured temperature [°C]
+ * @param command Heater command [%]
+ * @param dt      Time since the previous sample [s]
+ */
+void ControlMetrics_Update(ControlMetrics_t *metrics, float temp, float command, float dt)
+{
+    float error = metrics->setpoint - temp;
+    float abs_error = (error < 0.0f) ? -error : error;
+    uint8_t rising = metrics->setpoint >= metrics->start;
+
+    metrics->elapsed += dt;
+    metrics->iae += abs_error * dt;
+    metrics->energy += ((command > 0.0f) ? command : 0.0f) * dt;
+
+    /* Overshoot is measured in the direction of the step */
+    if (rising ? (temp > metrics->peak) : (temp < metrics->peak)) {
+        metrics->peak = temp;
+        metrics->overshoot = rising ? (temp - metrics->setpoint) : (metrics->setpoint - temp);
+        if (metrics->overshoot < 0.0f) {
+            metrics->overshoot = 0.0f;
+        }
+    }
+
+    /* Rise time from 10 % to 90 % of the step */
+    if (metrics->rise_time < 0.0f) {
+        float progress = (temp - metrics->start) / (metrics->setpoint - metrics->start);
+        if (metrics->rise_start < 0.0f && progress >= 0.1f) {
+            metrics->rise_start = metrics->elapsed;
+        }
+        if (metrics->rise_start >= 0.0f && progress >= 0.9f) {
+            metrics->rise_time = metrics->elapsed - metrics->rise_start;
+        }
+    } else if (abs_error > metrics->max_error) {
+        metrics->max_error = abs_error;
+    }
+
+    /* Ripple only counts since the last time the error entered the band */
+    if (abs_error > metrics->band) {
+        metrics->settling_time = metrics->elapsed;
+        metrics->band_min = metrics->setpoint + metrics->band;
+        metrics->band_max = metrics->setpoint - metrics->band;
+    } else {
+        if (temp < metrics->band_min) {
+            metrics->band_min = temp;
+        }
+        if (temp > metrics->band_max) {
+            metrics->band_max = temp;
+        }
+    }
+    metrics->ripple = (metrics->band_max > metrics->band_min) ?
+                      (metrics->band_max - metrics->band_min) : 0.0f;
+}
+
+/**
+ * @brief Check whether the response has stayed inside the band long enough
+ *
+ * @param metrics Pointer to metrics structure
+ * @param hold    Time the error must stay inside the band [s]
+ * @return uint8_t 1 once settled, 0 otherwise
+ */
+uint8_t ControlMetrics_IsSettled(const ControlMetrics_t *metrics, float hold)
+{
+    return (metrics->elapsed - metrics->settling_time) >= hold;
+}
+
+/**
+ * @brief Pareto comparison of two scored runs
+ *
+ * @param a First run
+ * @param b Second run
+ * @return uint8_t 1 if a dominates b, 0 otherwise
+ */
+uint8_t ControlMetrics_Dominates(const ControlMetrics_t *a, const ControlMetrics_t *b)
+{
+    if (a->settling_time > b->settling_time || a->overshoot > b->overshoot ||
+        a->iae > b->iae || a->energy > b->energy) {
+        return 0;
+    }
+    return (a->settling_time < b->settling_time || a->overshoot < b->overshoot ||
+            a->iae < b->iae || a->energy < b->energy);
+}
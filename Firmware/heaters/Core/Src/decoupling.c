@@ -0,0 +1,215 @@
+/**
+ * @file      decoupling.c
+ * @author    Adrian Silva Palafox
+ * @brief     Static zone decoupling implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "decoupling.h"
+#include "ramfunc.h"
+
+#define N   DECOUPLING_ZONES
+
+/**
+ * @brief 3x3 inverse by the adjugate
+ *
+ * @param a   Matrix to invert
+ * @param inv Inverse
+ * @return uint8_t 1 if successful, 0 if a is singular
+ */
+static uint8_t mat3_inverse(const float a[N][N], float inv[N][N])
+{
+    float det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+                a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+                a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+    float scale = 0.0f;
+
+    /* Singular relative to the size of the entries */
+    for (uint8_t i = 0; i < N; i++) {
+        for (uint8_t j = 0; j < N; j++) {
+            float v = (a[i][j] < 0.0f) ? -a[i][j] : a[i][j];
+            if (v > scale) {
+                scale = v;
+            }
+        }
+    }
+    if (scale == 0.0f || (det < 0.0f ? -det : det) < 1e-6f * scale * scale * scale) {
+        return 0;
+    }
+
+    inv[0][0] = (a[1][1] * a[2][2] - a[1][2] * a[2][1]) / det;
+    inv[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) / det;
+    inv[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) / det;
+    inv[1][0] = (a[1][2] * a[2][0] - a[1][0] * a[2][2]) / det;
+    inv[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) / det;
+    inv[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) / det;
+    inv[2][0] = (a[1][0] * a[2][1] - a[1][1] * a[2][0]) / det;
+    inv[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) / det;
+    inv[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) / det;
+
+    return 1;
+}
+
+/**
+ * @brief 3x3 matrix times vector
+ *
+ * @param a   Matrix
+ * @param x   Vector
+ * @param y   Result, must not alias x
+ */
+RAMFUNC static void mat3_mul_vec(const float a[N][N], const float *x, float *y)
+{
+    for (uint8_t i = 0; i < N; i++) {
+        y[i] = a[i][0] * x[0] + a[i][1] * x[1] + a[i][2] * x[2];
+    }
+}
+
+/**
+ * @brief Initialize as a pass-through
+ *
+ * @param dec Pointer to decoupler control structure
+ */
+void Decoupling_Init(Decoupling_t *dec)
+{
+    for (uint8_t i = 0; i < N; i++) {
+        for (uint8_t j = 0; j < N; j++) {
+            dec->gain[i][j] = (i == j) ? 1.0f : 0.0f;
+            dec->matrix[i][j] = (i == j) ? 1.0f : 0.0f;
+            dec->inverse[i][j] = (i == j) ? 1.0f : 0.0f;
+        }
+    }
+    dec->enabled = 0;
+}
+
+/**
+ * @brief Steady-state gains of the zone model
+ *
+ * @details In steady state H dT = diag(P / 100) du, with H the loss and
+ *          conduction matrix (h_i + neighbour conductances on the diagonal,
+ *          minus the conductance between neighbours off it).
+ *
+ * @param dec   Pointer to decoupler control structure
+ * @param model Model with its parameters filled in
+ */
+void Decoupling_GainFromModel(Decoupling_t *dec, const ThermalModel_t *model)
+{
+    float h[N][N] = { { 0.0f } };
+    float inv[N][N];
+
+    for (uint8_t i = 0; i < N; i++) {
+        h[i][i] = model->zone[i].loss;
+    }
+    for (uint8_t i = 0; i < N - 1; i++) {
+        h[i][i] += model->coupling[i];
+        h[i + 1][i + 1] += model->coupling[i];
+        h[i][i + 1] = -model->coupling[i];
+        h[i + 1][i] = -model->coupling[i];
+    }
+    if (!mat3_inverse(h, inv)) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < N; i++) {
+        for (uint8_t j = 0; j < N; j++) {
+            dec->gain[i][j] = inv[i][j] * model->zone[j].heater_power * 0.01f;
+        }
+    }
+}
+
+/**
+ * @brief Enter one step test result as a column of G
+ *
+ * @param dec    Pointer to decoupler control structure
+ * @param input  Heater that was stepped
+ * @param before Settled zone temperatures before the step [°C]
+ * @param after  Settled zone temperatures after the step [°C]
+ * @param step   Command step [%]
+ */
+void Decoupling_SetStep(Decoupling_t *dec, uint8_t input, const float *before,
+                        const float *after, float step)
+{
+    if (input >= N || step == 0.0f) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < N; i++) {
+        dec->gain[i][input] = (after[i] - before[i]) / step;
+    }
+}
+
+/**
+ * @brief Compute D from G and enable it
+ *
+ * @param dec Pointer to decoupler control structure
+ * @return uint8_t 1 if enabled, 0 if G is singular
+ */
+uint8_t Decoupling_Compute(Decoupling_t *dec)
+{
+    float inv[N][N];
+    float sum[N];
+
+    if (!mat3_inverse(dec->gain, inv)) {
+        dec->enabled = 0;
+        return 0;
+    }
+
+    /* A zero row sum would make D singular as well */
+    for (uint8_t j = 0; j < N; j++) {
+        sum[j] = dec->gain[j][0] + dec->gain[j][1] + dec->gain[j][2];
+        if (sum[j] == 0.0f) {
+            dec->enabled = 0;
+            return 0;
+        }
+    }
+
+    /* D = G^-1 diag(G 1), D^-1 = diag(G 1)^-1 G */
+    for (uint8_t i = 0; i < N; i++) {
+        for (uint8_t j = 0; j < N; j++) {
+            dec->matrix[i][j] = inv[i][j] * sum[j];
+            dec->inverse[i][j] = dec->gain[i][j] / sum[i];
+        }
+    }
+    dec->enabled = 1;
+
+    return 1;
+}
+
+/**
+ * @brief Transform the PID outputs into heater commands (runs from SRAM)
+ *
+ * @param dec Pointer to decoupler control structure
+ * @param in  PID outputs [%]
+ * @param out Heater commands [%]
+ */
+RAMFUNC void Decoupling_Apply(const Decoupling_t *dec, const float *in, float *out)
+{
+    if (!dec->enabled) {
+        for (uint8_t i = 0; i < N; i++) {
+            out[i] = in[i];
+        }
+        return;
+    }
+
+    mat3_mul_vec(dec->matrix, in, out);
+}
+
+/**
+ * @brief Transform heater commands back into the PID outputs giving them
+ *        (runs from SRAM)
+ *
+ * @param dec Pointer to decoupler control structure
+ * @param in  Heater commands [%]
+ * @param out PID outputs [%]
+ */
+RAMFUNC void Decoupling_Restore(const Decoupling_t *dec, const float *in, float *out)
+{
+    if (!dec->enabled) {
+        for (uint8_t i = 0; i < N; i++) {
+            out[i] = in[i];
+        }
+        return;
+    }
+
+    mat3_mul_vec(dec->inverse, in, out);
+}
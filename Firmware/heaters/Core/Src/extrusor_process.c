@@ -1,8 +1,344 @@
-/*
- * extrusor_process.c
+/**
+ * @file      extrusor_process.c
+ * @author    Adrian Silva Palafox
+ * @brief     Extrusion process sequencing implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "extrusor_process.h"
+#include <stddef.h>
+
+#define QUEUE_MASK  (EXTRUSOR_QUEUE_SIZE - 1U)
+#define NO_RULE     0xFFU
+
+/* Type Definitions ---------------------------------------------------------*/
+typedef void (*action_t)(ExtrusorProcess_t *process);
+typedef uint8_t (*guard_t)(const ExtrusorProcess_t *process);
+
+/**
+ * @brief State description
+ */
+typedef struct {
+    uint8_t  parent;   /**< Enclosing state or EXTRUSOR_NONE */
+    uint8_t  initial;  /**< Substate entered by default or EXTRUSOR_NONE */
+    action_t entry;    /**< Run when the state is entered, may be NULL */
+    action_t exit;     /**< Run when the state is left, may be NULL */
+} state_t;
+
+/**
+ * @brief Transition rule
+ */
+typedef struct {
+    uint8_t state;     /**< State handling the event (inherited by substates) */
+    uint8_t event;     /**< Triggering event */
+    guard_t guard;     /**< Transition only if it returns 1, may be NULL */
+    uint8_t target;    /**< Destination state */
+} rule_t;
+
+/* Actions ------------------------------------------------------------------*/
+static void heaters(ExtrusorProcess_t *p, uint8_t enable)
+{
+    if (p->outputs.heaters != NULL) {
+        p->outputs.heaters(p->outputs.ctx, enable);
+    }
+}
+
+static void screw(ExtrusorProcess_t *p, float rpm)
+{
+    if (p->outputs.screw != NULL) {
+        p->outputs.screw(p->outputs.ctx, rpm);
+    }
+}
+
+static void winder(ExtrusorProcess_t *p, float rpm)
+{
+    if (p->outputs.winder != NULL) {
+        p->outputs.winder(p->outputs.ctx, rpm);
+    }
+}
+
+static void run_entry(ExtrusorProcess_t *p)     { heaters(p, 1); }
+static void run_exit(ExtrusorProcess_t *p)      { heaters(p, 0); }
+static void produce_exit(ExtrusorProcess_t *p)  { screw(p, 0.0f); }
+static void feed_entry(ExtrusorProcess_t *p)    { screw(p, p->config.feed_rpm); }
+static void extrude_entry(ExtrusorProcess_t *p) { screw(p, p->config.screw_rpm); }
+static void wind_entry(ExtrusorProcess_t *p)    { winder(p, p->config.winder_rpm); }
+static void wind_exit(ExtrusorProcess_t *p)     { winder(p, 0.0f); }
+static void purge_entry(ExtrusorProcess_t *p)   { screw(p, p->config.purge_rpm); }
+static void purge_exit(ExtrusorProcess_t *p)    { screw(p, 0.0f); }
+
+static void all_off(ExtrusorProcess_t *p)
+{
+    heaters(p, 0);
+    screw(p, 0.0f);
+    winder(p, 0.0f);
+}
+
+/* Guards -------------------------------------------------------------------*/
+static uint8_t no_faults(const ExtrusorProcess_t *p) { return p->faults == 0; }
+static uint8_t at_temp(const ExtrusorProcess_t *p)   { return p->at_temp; }
+
+/* Tables -------------------------------------------------------------------*/
+static const state_t states[EXTRUSOR_STATES] = {
+    [EXTRUSOR_IDLE]     = { EXTRUSOR_NONE,    EXTRUSOR_NONE,    NULL,          NULL },
+    [EXTRUSOR_RUN]      = { EXTRUSOR_NONE,    EXTRUSOR_PREHEAT, run_entry,     run_exit },
+    [EXTRUSOR_PREHEAT]  = { EXTRUSOR_RUN,     EXTRUSOR_NONE,    NULL,          NULL },
+    [EXTRUSOR_SOAK]     = { EXTRUSOR_RUN,     EXTRUSOR_NONE,    NULL,          NULL },
+    [EXTRUSOR_PRODUCE]  = { EXTRUSOR_RUN,     EXTRUSOR_FEED,    NULL,          produce_exit },
+    [EXTRUSOR_FEED]     = { EXTRUSOR_PRODUCE, EXTRUSOR_NONE,    feed_entry,    NULL },
+    [EXTRUSOR_EXTRUDE]  = { EXTRUSOR_PRODUCE, EXTRUSOR_NONE,    extrude_entry, NULL },
+    [EXTRUSOR_WIND]     = { EXTRUSOR_PRODUCE, EXTRUSOR_NONE,    wind_entry,    wind_exit },
+    [EXTRUSOR_PURGE]    = { EXTRUSOR_RUN,     EXTRUSOR_NONE,    purge_entry,   purge_exit },
+    [EXTRUSOR_COOLDOWN] = { EXTRUSOR_NONE,    EXTRUSOR_NONE,    NULL,          NULL },
+    [EXTRUSOR_FAULT]    = { EXTRUSOR_NONE,    EXTRUSOR_NONE,    all_off,       NULL },
+};
+
+static const rule_t rules[] = {
+    { EXTRUSOR_IDLE,     EXTRUSOR_EV_START,    no_faults, EXTRUSOR_RUN },
+    { EXTRUSOR_IDLE,     EXTRUSOR_EV_FAULT,    NULL,      EXTRUSOR_FAULT },
+    { EXTRUSOR_RUN,      EXTRUSOR_EV_STOP,     NULL,      EXTRUSOR_COOLDOWN },
+    { EXTRUSOR_RUN,      EXTRUSOR_EV_FAULT,    NULL,      EXTRUSOR_FAULT },
+    { EXTRUSOR_RUN,      EXTRUSOR_EV_PURGE,    at_temp,   EXTRUSOR_PURGE },
+    { EXTRUSOR_PREHEAT,  EXTRUSOR_EV_AT_TEMP,  NULL,      EXTRUSOR_SOAK },
+    { EXTRUSOR_SOAK,     EXTRUSOR_EV_TIMEOUT,  NULL,      EXTRUSOR_PRODUCE },
+    { EXTRUSOR_SOAK,     EXTRUSOR_EV_OFF_TEMP, NULL,      EXTRUSOR_PREHEAT },
+    { EXTRUSOR_PRODUCE,  EXTRUSOR_EV_OFF_TEMP, NULL,      EXTRUSOR_PREHEAT },
+    { EXTRUSOR_FEED,     EXTRUSOR_EV_TIMEOUT,  NULL,      EXTRUSOR_EXTRUDE },
+    { EXTRUSOR_EXTRUDE,  EXTRUSOR_EV_THREADED, NULL,      EXTRUSOR_WIND },
+    { EXTRUSOR_EXTRUDE,  EXTRUSOR_EV_TIMEOUT,  NULL,      EXTRUSOR_WIND },
+    { EXTRUSOR_PURGE,    EXTRUSOR_EV_TIMEOUT,  NULL,      EXTRUSOR_SOAK },
+    { EXTRUSOR_PURGE,    EXTRUSOR_EV_OFF_TEMP, NULL,      EXTRUSOR_PREHEAT },
+    { EXTRUSOR_COOLDOWN, EXTRUSOR_EV_COLD,     NULL,      EXTRUSOR_IDLE },
+    { EXTRUSOR_COOLDOWN, EXTRUSOR_EV_START,    no_faults, EXTRUSOR_RUN },
+    { EXTRUSOR_COOLDOWN, EXTRUSOR_EV_FAULT,    NULL,      EXTRUSOR_FAULT },
+    { EXTRUSOR_FAULT,    EXTRUSOR_EV_RESET,    no_faults, EXTRUSOR_COOLDOWN },
+};
+
+#define RULE_COUNT  (sizeof(rules) / sizeof(rules[0]))
+
+/* Private functions --------------------------------------------------------*/
+/**
+ * @brief Check whether state is inside ancestor (or equal to it)
+ */
+static uint8_t is_inside(uint8_t state, uint8_t ancestor)
+{
+    for (; state != EXTRUSOR_NONE; state = states[state].parent) {
+        if (state == ancestor) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Move to target, running exit and entry actions on the way
  *
- *  Created on: Apr 24, 2025
- *      Author: adrian
+ * @details Exits from the current leaf up to the nearest state that contains
+ *          both ends, enters down to target and then into its initial
+ *          substates. A transition to the current state or to one of its
+ *          parents is local: only the states below the target are left.
  */
+static void transition(ExtrusorProcess_t *p, uint8_t target)
+{
+    uint8_t path[EXTRUSOR_MAX_DEPTH];
+    uint8_t depth = 0;
+    uint8_t lca = target;
+    uint8_t s;
 
+    while (lca != EXTRUSOR_NONE && !is_inside(p->state, lca)) {
+        path[depth++] = lca;
+        lca = states[lca].parent;
+    }
 
+    for (s = p->state; s != lca; s = states[s].parent) {
+        if (states[s].exit != NULL) {
+            states[s].exit(p);
+        }
+    }
+
+    while (depth > 0) {
+        s = path[--depth];
+        if (states[s].entry != NULL) {
+            states[s].entry(p);
+        }
+    }
+
+    for (s = target; states[s].initial != EXTRUSOR_NONE; ) {
+        s = states[s].initial;
+        if (states[s].entry != NULL) {
+            states[s].entry(p);
+        }
+    }
+
+    p->state = s;
+    p->state_time = 0.0f;
+}
+
+/**
+ * @brief Time limit of the current state
+ *
+ * @return float Limit [s], 0 if the state has none
+ */
+static float state_timeout(const ExtrusorProcess_t *p)
+{
+    switch (p->state) {
+    case EXTRUSOR_SOAK:    return p->config.soak_time;
+    case EXTRUSOR_FEED:    return p->config.feed_time;
+    case EXTRUSOR_EXTRUDE: return p->config.thread_time;
+    case EXTRUSOR_PURGE:   return p->config.purge_time;
+    default:               return 0.0f;
+    }
+}
+
+/* Public functions ---------------------------------------------------------*/
+/**
+ * @brief Build the dispatch table and enter IDLE
+ *
+ * @param process Pointer to process control structure
+ * @param config  Sequence parameters
+ * @param outputs Actuator callbacks
+ */
+void ExtrusorProcess_Init(ExtrusorProcess_t *process, const ExtrusorProcess_Config_t *config,
+                          const ExtrusorProcess_Outputs_t *outputs)
+{
+    process->config = *config;
+    process->outputs = *outputs;
+    process->state = EXTRUSOR_IDLE;
+    process->state_time = 0.0f;
+    process->faults = 0;
+    process->at_temp = 0;
+    process->head = 0;
+    process->tail = 0;
+
+    /* Resolve inheritance once: the first rule found walking up from the state wins */
+    for (uint8_t state = 0; state < EXTRUSOR_STATES; state++) {
+        for (uint8_t event = 0; event < EXTRUSOR_EVENTS; event++) {
+            process->dispatch[state][event] = NO_RULE;
+            for (uint8_t s = state; s != EXTRUSOR_NONE && process->dispatch[state][event] == NO_RULE;
+                 s = states[s].parent) {
+                for (uint8_t r = 0; r < RULE_COUNT; r++) {
+                    if (rules[r].state == s && rules[r].event == event) {
+                        process->dispatch[state][event] = r;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    all_off(process);
+}
+
+/**
+ * @brief Queue an event
+ *
+ * @param process Pointer to process control structure
+ * @param event   ExtrusorProcess_Event_t
+ * @return uint8_t 1 if queued, 0 if the queue is full
+ */
+uint8_t ExtrusorProcess_Post(ExtrusorProcess_t *process, uint8_t event)
+{
+    if (event >= EXTRUSOR_EVENTS || (uint8_t)(process->head - process->tail) >= EXTRUSOR_QUEUE_SIZE) {
+        return 0;
+    }
+    process->queue[process->head & QUEUE_MASK] = event;
+    process->head++;
+    return 1;
+}
+
+/**
+ * @brief Generate the events due to temperatures, faults and time
+ *
+ * @param process   Pointer to process control structure
+ * @param setpoints Zone setpoints [°C]
+ * @param temps     Zone temperatures [°C]
+ * @param faults    Active fault bits
+ * @param dt        Time since the previous tick [s]
+ */
+void ExtrusorProcess_Tick(ExtrusorProcess_t *process, const float *setpoints,
+                          const float *temps, uint32_t faults, float dt)
+{
+    const ExtrusorProcess_Config_t *c = &process->config;
+    float limit = state_timeout(process);
+    float previous = process->state_time;
+    uint8_t in_band = 1;
+    uint8_t in_run_band = 1;
+    uint8_t cold = 1;
+
+    for (uint8_t zone = 0; zone < EXTRUSOR_ZONES; zone++) {
+        float error = setpoints[zone] - temps[zone];
+        if (error < 0.0f) {
+            error = -error;
+        }
+        if (error > c->band) {
+            in_band = 0;
+        }
+        if (error > c->run_band) {
+            in_run_band = 0;
+        }
+        if (temps[zone] >= c->cool_temp) {
+            cold = 0;
+        }
+    }
+
+    process->faults = faults;
+    process->at_temp = in_band;
+    process->state_time += dt;
+
+    if (faults != 0 && process->state != EXTRUSOR_FAULT) {
+        ExtrusorProcess_Post(process, EXTRUSOR_EV_FAULT);
+    }
+
+    if (process->state == EXTRUSOR_PREHEAT && in_band) {
+        ExtrusorProcess_Post(process, EXTRUSOR_EV_AT_TEMP);
+    } else if (ExtrusorProcess_IsIn(process, EXTRUSOR_RUN) &&
+               process->state != EXTRUSOR_PREHEAT && !in_run_band) {
+        ExtrusorProcess_Post(process, EXTRUSOR_EV_OFF_TEMP);
+    }
+
+    if (process->state == EXTRUSOR_COOLDOWN && cold) {
+        ExtrusorProcess_Post(process, EXTRUSOR_EV_COLD);
+    }
+
+    if (limit > 0.0f && previous < limit && process->state_time >= limit) {
+        ExtrusorProcess_Post(process, EXTRUSOR_EV_TIMEOUT);
+    }
+}
+
+/**
+ * @brief Process every queued event
+ *
+ * @details Events with no rule in the current state (or its parents), or whose
+ *          guard fails, are discarded.
+ *
+ * @param process Pointer to process control structure
+ */
+void ExtrusorProcess_Dispatch(ExtrusorProcess_t *process)
+{
+    while (process->tail != process->head) {
+        uint8_t event = process->queue[process->tail & QUEUE_MASK];
+        uint8_t index = process->dispatch[process->state][event];
+        process->tail++;
+
+        if (index == NO_RULE) {
+            continue;
+        }
+        if (rules[index].guard != NULL && !rules[index].guard(process)) {
+            continue;
+        }
+        transition(process, rules[index].target);
+    }
+}
+
+/**
+ * @brief Check whether the process is in a state or one of its substates
+ *
+ * @param process Pointer to process control structure
+ * @param state   ExtrusorProcess_State_t
+ * @return uint8_t 1 if inside the state, 0 otherwise
+ */
+uint8_t ExtrusorProcess_IsIn(const ExtrusorProcess_t *process, uint8_t state)
+{
+    return is_inside(process->state, state);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file      feedforward.c
+ * @author    Adrian Silva Palafox
+ * @brief     Setpoint feedforward implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "feedforward.h"
+#include "ramfunc.h"
+#include <stddef.h>
+
+/**
+ * @brief Initialize switched off
+ *
+ * @param ff Pointer to feedforward control structure
+ * @param t  Control period [s]
+ */
+void Feedforward_Init(Feedforward_t *ff, float t)
+{
+    ff->T = t;
+    Feedforward_SetModel(ff, NULL, 0.0f);
+    Feedforward_Reset(ff);
+}
+
+/**
+ * @brief Set the zone model, keeping the setpoint history
+ *
+ * @param ff      Pointer to feedforward control structure
+ * @param model   Zone model, NULL to switch the feedforward off
+ * @param ambient Ambient temperature [°C]
+ */
+void Feedforward_SetModel(Feedforward_t *ff, const ThermalModel_Zone_t *model, float ambient)
+{
+    if (model != NULL && model->heater_power > 0.0f) {
+        ff->model = *model;
+    } else {
+        ff->model.heat_capacity = 0.0f;
+    }
+    ff->ambient = ambient;
+}
+
+/**
+ * @brief Forget the setpoint history
+ *
+ * @param ff Pointer to feedforward control structure
+ */
+void Feedforward_Reset(Feedforward_t *ff)
+{
+    ff->prevSetpoint = 0.0f;
+    ff->out = 0.0f;
+    ff->primed = 0;
+}
+
+/**
+ * @brief Power the setpoint trajectory needs (runs from SRAM)
+ *
+ * @param ff       Pointer to feedforward control structure
+ * @param setpoint Setpoint of this control period [°C]
+ * @return float   Feedforward power [%]
+ */
+RAMFUNC float Feedforward_Update(Feedforward_t *ff, float setpoint)
+{
+    const ThermalModel_Zone_t *m = &ff->model;
+    float rate = 0.0f;
+    float watts;
+
+    if (m->heat_capacity <= 0.0f) {
+        ff->out = 0.0f;
+        return 0.0f;
+    }
+
+    if (ff->primed && ff->T > 0.0f) {
+        rate = (setpoint - ff->prevSetpoint) / ff->T;
+    }
+    ff->prevSetpoint = setpoint;
+    ff->primed = 1;
+
+    watts = m->loss * (setpoint - ff->ambient) + m->heat_capacity * rate;
+    ff->out = 100.0f * watts / m->heater_power;
+    if (ff->out < 0.0f) {
+        ff->out = 0.0f;
+    }
+
+    return ff->out;
+}
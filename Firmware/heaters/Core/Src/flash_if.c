@@ -0,0 +1,127 @@
+/**
+ * @file      flash_if.c
+ * @author    Adrian Silva Palafox
+ * @brief     Internal flash access helpers implementation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Sector erase, word programming and CRC helpers shared by the
+ *            persistent storage modules.
+ */
+
+#include "flash_if.h"
+
+/**
+ * @brief Clear any error flag left by a previous flash operation
+ */
+static void flash_if_clear_flags(void)
+{
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR |
+                           FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+}
+
+/**
+ * @brief Erase a single flash sector
+ *
+ * @param sector Sector number (FLASH_SECTOR_x)
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef FlashIf_EraseSector(uint32_t sector)
+{
+    FLASH_EraseInitTypeDef erase = {0};
+    uint32_t sector_error = 0;
+    HAL_StatusTypeDef status;
+
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Sector = sector;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+    HAL_FLASH_Unlock();
+    flash_if_clear_flags();
+    status = HAL_FLASHEx_Erase(&erase, &sector_error);
+    HAL_FLASH_Lock();
+
+    return status;
+}
+
+/**
+ * @brief Program a block of data into erased flash
+ *
+ * @param address Destination address (4-byte aligned)
+ * @param data    Source buffer
+ * @param len     Number of bytes to write (multiple of 4)
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef FlashIf_Program(uint32_t address, const void *data, uint32_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t word;
+
+    /* Validate input parameters */
+    if (data == NULL || (address & 0x3U) || (len & 0x3U)) {
+        return HAL_ERROR;
+    }
+
+    HAL_FLASH_Unlock();
+    flash_if_clear_flags();
+    for (uint32_t offset = 0; offset < len && status == HAL_OK; offset += 4) {
+        /* Byte-wise copy keeps unaligned source buffers safe */
+        word = (uint32_t)src[offset] |
+               ((uint32_t)src[offset + 1] << 8) |
+               ((uint32_t)src[offset + 2] << 16) |
+               ((uint32_t)src[offset + 3] << 24);
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address + offset, word);
+    }
+    HAL_FLASH_Lock();
+
+    /* Drop stale lines so the new contents are visible through the ART cache */
+    if (FLASH->ACR & FLASH_ACR_DCEN) {
+        __HAL_FLASH_DATA_CACHE_DISABLE();
+        __HAL_FLASH_DATA_CACHE_RESET();
+        __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check whether a flash area is fully erased
+ *
+ * @param address Start address (4-byte aligned)
+ * @param len     Number of bytes to check (multiple of 4)
+ * @return uint8_t 1 if erased, 0 otherwise
+ */
+uint8_t FlashIf_IsErased(uint32_t address, uint32_t len)
+{
+    const volatile uint32_t *word = (const volatile uint32_t *)address;
+
+    for (uint32_t i = 0; i < len / 4; i++) {
+        if (word[i] != FLASH_IF_ERASED_WORD) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Compute the CRC-16/CCITT-FALSE of a buffer
+ *
+ * @param data Source buffer
+ * @param len  Number of bytes
+ * @return uint16_t CRC value
+ */
+uint16_t FlashIf_Crc16(const void *data, uint32_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint16_t crc = 0xFFFF;
+
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)src[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
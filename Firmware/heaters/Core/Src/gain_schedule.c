@@ -0,0 +1,82 @@
+/**
+ * @file      gain_schedule.c
+ * @author    Adrian Silva Palafox
+ * @brief     Gain scheduling implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "gain_schedule.h"
+
+/**
+ * @brief Locate a value on ascending breakpoints
+ *
+ * @param points Breakpoints
+ * @param count  Number of breakpoints (at least 2)
+ * @param value  Value to locate
+ * @param frac   Position inside the returned interval (0..1, clamped)
+ * @return uint8_t Index of the interval's lower breakpoint
+ */
+static uint8_t schedule_locate(const float *points, uint8_t count, float value, float *frac)
+{
+    uint8_t i = 0;
+
+    while (i < count - 2 && value >= points[i + 1]) {
+        i++;
+    }
+
+    if (value <= points[i]) {
+        *frac = 0.0f;
+    } else if (value >= points[i + 1]) {
+        *frac = 1.0f;
+    } else {
+        *frac = (value - points[i]) / (points[i + 1] - points[i]);
+    }
+    return i;
+}
+
+/**
+ * @brief Bilinear blend of four grid values
+ *
+ * @param v00 Value at the lower temperature and lower speed
+ * @param v01 Value at the lower temperature and upper speed
+ * @param v10 Value at the upper temperature and lower speed
+ * @param v11 Value at the upper temperature and upper speed
+ * @param ft  Position between the temperatures (0..1)
+ * @param fr  Position between the speeds (0..1)
+ * @return float Blended value
+ */
+static float schedule_blend(float v00, float v01, float v10, float v11, float ft, float fr)
+{
+    float low = v00 + fr * (v01 - v00);
+    float high = v10 + fr * (v11 - v10);
+    return low + ft * (high - low);
+}
+
+/**
+ * @brief Gains at an operating point
+ *
+ * @param table Schedule table
+ * @param base  Base gains of the zone
+ * @param temp  Zone temperature [°C]
+ * @param rpm   Screw speed [rpm]
+ * @return PIDGains Scheduled gains
+ */
+PIDGains GainSchedule_Lookup(const GainSchedule_Table_t *table, const PIDGains *base,
+                             float temp, float rpm)
+{
+    float ft, fr;
+    uint8_t t = schedule_locate(table->temp, GAIN_SCHEDULE_TEMPS, temp, &ft);
+    uint8_t r = schedule_locate(table->rpm, GAIN_SCHEDULE_RPMS, rpm, &fr);
+    const PIDGains *s00 = &table->scale[t][r];
+    const PIDGains *s01 = &table->scale[t][r + 1];
+    const PIDGains *s10 = &table->scale[t + 1][r];
+    const PIDGains *s11 = &table->scale[t + 1][r + 1];
+    PIDGains gains;
+
+    gains.Kp = base->Kp * schedule_blend(s00->Kp, s01->Kp, s10->Kp, s11->Kp, ft, fr);
+    gains.Ki = base->Ki * schedule_blend(s00->Ki, s01->Ki, s10->Ki, s11->Ki, ft, fr);
+    gains.Kd = base->Kd * schedule_blend(s00->Kd, s01->Kd, s10->Kd, s11->Kd, ft, fr);
+
+    return gains;
+}
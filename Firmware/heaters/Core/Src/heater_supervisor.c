@@ -0,0 +1,207 @@
+/**
+ * @file      heater_supervisor.c
+ * @author    Adrian Silva Palafox
+ * @brief     Thermal runaway and heater fault detection implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "heater_supervisor.h"
+
+/**
+ * @brief Restart the watches of one zone from a reading
+ */
+static void supervisor_restart(HeaterSupervisor_Zone_t *z, float temp)
+{
+    z->last_temp = temp;
+    z->stuck_timer = 0.0f;
+    z->watch_temp = temp;
+    z->watch_timer = 0.0f;
+    z->idle_min = temp;
+}
+
+/**
+ * @brief Initialize the supervisor with no fault latched
+ *
+ * @param sup    Pointer to supervisor control structure
+ * @param config Detection thresholds
+ */
+void HeaterSupervisor_Init(HeaterSupervisor_t *sup, const HeaterSupervisor_Config_t *config)
+{
+    sup->config = *config;
+    sup->time = 0.0f;
+    HeaterSupervisor_Reset(sup);
+}
+
+/**
+ * @brief Check every zone
+ *
+ * @param sup       Pointer to supervisor control structure
+ * @param temps     Zone readings [°C]
+ * @param open_mask Bit n set when thermocouple n reports open
+ * @param power     Heater commands [%]
+ * @param setpoints Zone setpoints [°C]
+ * @param dt        Time since the previous check [s]
+ * @return uint8_t  Zones with a latched fault
+ */
+uint8_t HeaterSupervisor_Check(HeaterSupervisor_t *sup, const float *temps, uint32_t open_mask,
+                               const float *power, const float *setpoints, float dt)
+{
+    const HeaterSupervisor_Config_t *c = &sup->config;
+
+    sup->time += dt;
+
+    for (uint8_t zone = 0; zone < HEATER_SUPERVISOR_ZONES; zone++) {
+        HeaterSupervisor_Zone_t *z = &sup->zone[zone];
+        float temp = temps[zone];
+        uint8_t fault = 0;
+
+        if (open_mask & (1U << zone)) {
+            /* The reading is meaningless, restart the watches once it is back */
+            fault = HEATER_FAULT_OPEN;
+            z->started = 0;
+        } else if (!z->started) {
+            /* First valid reading only seeds the watches */
+            supervisor_restart(z, temp);
+            z->started = 1;
+            if (temp > c->temp_limit[zone]) {
+                fault |= HEATER_FAULT_OVERTEMP;
+            }
+        } else {
+            if (temp > c->temp_limit[zone]) {
+                fault |= HEATER_FAULT_OVERTEMP;
+            }
+
+            /* Away from the setpoint with the heater on, a live reading must move */
+            float error = setpoints[zone] - temp;
+            if (error < 0.0f) {
+                error = -error;
+            }
+            if (power[zone] > 0.0f && error > c->runaway_band && temp == z->last_temp) {
+                z->stuck_timer += dt;
+                if (z->stuck_timer >= c->stuck_time) {
+                    fault |= HEATER_FAULT_STUCK;
+                }
+            } else {
+                z->stuck_timer = 0.0f;
+            }
+            z->last_temp = temp;
+
+            /* Driven hard below the setpoint: expect a rise every window */
+            if (power[zone] >= c->runaway_power && temp < setpoints[zone] - c->runaway_band) {
+                if (temp >= z->watch_temp + c->runaway_rise) {
+                    z->watch_temp = temp;
+                    z->watch_timer = 0.0f;
+                } else {
+                    z->watch_timer += dt;
+                    if (z->watch_timer >= c->runaway_time) {
+                        fault |= HEATER_FAULT_NO_RISE;
+                    }
+                }
+            } else {
+                z->watch_temp = temp;
+                z->watch_timer = 0.0f;
+            }
+
+            /* Heater off: the zone may coast up a little, but not keep climbing */
+            if (power[zone] > 0.0f) {
+                z->idle_min = temp;
+            } else {
+                if (temp < z->idle_min) {
+                    z->idle_min = temp;
+                }
+                if (temp > setpoints[zone] + c->overshoot &&
+                    temp >= z->idle_min + c->runaway_rise) {
+                    fault |= HEATER_FAULT_OVERSHOOT;
+                }
+            }
+        }
+
+        if (fault && !z->fault) {
+            z->fault_time = sup->time;
+            z->fault_temp = temp;
+        }
+        z->fault |= fault;
+    }
+
+    return HeaterSupervisor_Faults(sup);
+}
+
+/**
+ * @brief Zones with a latched fault
+ *
+ * @param sup Pointer to supervisor control structure
+ * @return uint8_t Bit n set when zone n has a latched fault
+ */
+uint8_t HeaterSupervisor_Faults(const HeaterSupervisor_t *sup)
+{
+    uint8_t mask = 0;
+
+    for (uint8_t zone = 0; zone < HEATER_SUPERVISOR_ZONES; zone++) {
+        if (sup->zone[zone].fault) {
+            mask |= 1U << zone;
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Operator acknowledge: release the zones whose fault has cleared
+ *
+ * @details Called with the TRIACs killed, so every condition is judged from
+ *          the readings alone. NO_RISE cannot be re-checked without heating:
+ *          the acknowledge releases it and the restarted watch re-trips it.
+ *
+ * @param sup       Pointer to supervisor control structure
+ * @param temps     Zone readings [°C]
+ * @param open_mask Bit n set when thermocouple n reports open
+ * @param setpoints Zone setpoints [°C]
+ * @return uint8_t  Zones still latched
+ */
+uint8_t HeaterSupervisor_Acknowledge(HeaterSupervisor_t *sup, const float *temps,
+                                     uint32_t open_mask, const float *setpoints)
+{
+    const HeaterSupervisor_Config_t *c = &sup->config;
+
+    for (uint8_t zone = 0; zone < HEATER_SUPERVISOR_ZONES; zone++) {
+        HeaterSupervisor_Zone_t *z = &sup->zone[zone];
+        float temp = temps[zone];
+
+        if (!z->fault) {
+            continue;
+        }
+        if (open_mask & (1U << zone)) {
+            continue;
+        }
+        if (temp > c->temp_limit[zone]) {
+            continue;
+        }
+        if ((z->fault & HEATER_FAULT_OVERSHOOT) && temp > setpoints[zone] + c->overshoot) {
+            continue;
+        }
+        if ((z->fault & HEATER_FAULT_STUCK) && temp == z->fault_temp) {
+            continue;
+        }
+
+        z->fault = 0;
+        z->fault_time = 0.0f;
+        z->started = 0;
+    }
+
+    return HeaterSupervisor_Faults(sup);
+}
+
+/**
+ * @brief Clear every latched fault and restart the watches
+ *
+ * @param sup Pointer to supervisor control structure
+ */
+void HeaterSupervisor_Reset(HeaterSupervisor_t *sup)
+{
+    for (uint8_t zone = 0; zone < HEATER_SUPERVISOR_ZONES; zone++) {
+        HeaterSupervisor_Zone_t *z = &sup->zone[zone];
+        z->fault = 0;
+        z->fault_time = 0.0f;
+        z->started = 0;
+    }
+}
@@ -0,0 +1,209 @@
+/**
+ * @file      heaters.c
+ * @author    Adrian Silva Palafox
+ * @brief     Barrel heater zone control implementation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Per-zone PID control step, independent of the HAL.
+ */
+
+#include "heaters.h"
+#include "ramfunc.h"
+#include <stddef.h>
+
+/**
+ * @brief Report the power actually applied back to the controllers (runs
+ *        from SRAM)
+ *
+ * @details The PIDs sit before the decoupler, so the applied commands are
+ *          mapped back through D^-1 first. With the decoupler on, a cut in one
+ *          zone changes what every PID effectively applied.
+ *
+ * @param heaters Pointer to heaters control structure
+ */
+RAMFUNC static void heaters_feed_back(Heaters_t *heaters)
+{
+    float applied[HEATERS_ZONES];
+
+    Decoupling_Restore(&heaters->decoupling, heaters->power, applied);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        PID_LimitOutput(&heaters->pid[zone], applied[zone]);
+    }
+}
+
+/**
+ * @brief Initialize the zones with zero gains and limits
+ *
+ * @param heaters Pointer to heaters control structure
+ * @param t       Control period [s]
+ */
+void Heaters_Init(Heaters_t *heaters, float t)
+{
+    heaters->T = t;
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        PID_Init(&heaters->pid[zone], 0, 0, 0, 0, 0, 0, 0, 0, t);
+        SmithPredictor_Init(&heaters->smith[zone], NULL, 0.0f, t);
+        Feedforward_Init(&heaters->feedforward[zone], t);
+        heaters->power[zone] = 0.0f;
+    }
+    Decoupling_Init(&heaters->decoupling);
+}
+
+/**
+ * @brief Configure the controller of one zone
+ *
+ * @param heaters Pointer to heaters control structure
+ * @param zone    Zone index
+ */
+void Heaters_ConfigureZone(Heaters_t *heaters, uint8_t zone,
+                           float kp, float ki, float kd, float tau,
+                           float limMin, float limMax,
+                           float limMinInt, float limMaxInt)
+{
+    if (zone >= HEATERS_ZONES) {
+        return;
+    }
+
+    PID_Init(&heaters->pid[zone], kp, ki, kd, tau,
+             limMin, limMax, limMinInt, limMaxInt, heaters->T);
+    heaters->power[zone] = 0.0f;
+}
+
+/**
+ * @brief Compensate the thermocouple lag and dead time of one zone
+ *
+ * @param heaters   Pointer to heaters control structure
+ * @param zone      Zone index
+ * @param model     Zone model, NULL to control on the bare reading
+ * @param dead_time Transport delay on top of the thermocouple lag [s]
+ */
+void Heaters_SetDeadTime(Heaters_t *heaters, uint8_t zone,
+                         const ThermalModel_Zone_t *model, float dead_time)
+{
+    if (zone >= HEATERS_ZONES) {
+        return;
+    }
+
+    SmithPredictor_Init(&heaters->smith[zone], model, dead_time, heaters->T);
+}
+
+/**
+ * @brief Add the model-based setpoint feedforward to one zone
+ *
+ * @details The setpoint history is kept, so an updated model (e.g. from the
+ *          online identification) does not cause a step in the ramp term.
+ *
+ * @param heaters Pointer to heaters control structure
+ * @param zone    Zone index
+ * @param model   Zone model, NULL to switch the feedforward off
+ * @param ambient Ambient temperature [°C]
+ */
+void Heaters_SetFeedforward(Heaters_t *heaters, uint8_t zone,
+                            const ThermalModel_Zone_t *model, float ambient)
+{
+    if (zone >= HEATERS_ZONES) {
+        return;
+    }
+
+    Feedforward_SetModel(&heaters->feedforward[zone], model, ambient);
+}
+
+/**
+ * @brief Run one control step for every zone
+ *
+ * @details power[] still holds what was applied over the period that just
+ *          ended (after Heaters_LimitPower()), which is what the predictor
+ *          model runs on. The feedforward enters the PID output ahead of its
+ *          limits, so the PID only corrects the residual error. Decoupled
+ *          commands are clamped to each zone's output limits again, and a
+ *          clamp is fed back to the controllers.
+ *
+ * @param heaters   Pointer to heaters control structure
+ * @param setpoints Zone setpoints [°C]
+ * @param temps     Zone temperatures [°C]
+ */
+RAMFUNC void Heaters_ControlStep(Heaters_t *heaters, const float *setpoints, const float *temps)
+{
+    float out[HEATERS_ZONES];
+    uint8_t cut = 0;
+
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        PID_SetFeedforward(&heaters->pid[zone],
+                           Feedforward_Update(&heaters->feedforward[zone], setpoints[zone]));
+        out[zone] = SmithPredictor_Update(&heaters->smith[zone], &heaters->pid[zone],
+                                          setpoints[zone], temps[zone], heaters->power[zone]);
+    }
+
+    Decoupling_Apply(&heaters->decoupling, out, heaters->power);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        if (heaters->power[zone] > heaters->pid[zone].limMax) {
+            heaters->power[zone] = heaters->pid[zone].limMax;
+            cut = 1;
+        } else if (heaters->power[zone] < heaters->pid[zone].limMin) {
+            heaters->power[zone] = heaters->pid[zone].limMin;
+            cut = 1;
+        }
+    }
+    if (cut) {
+        heaters_feed_back(heaters);
+    }
+}
+
+/**
+ * @brief Cap the zone outputs and feed the cut back to the controllers
+ *
+ * @details With the decoupler on, the cut reaches the controllers through
+ *          D^-1, not as the heater command itself.
+ *
+ * @param heaters Pointer to heaters control structure
+ * @param limit   Highest power of every zone [%]
+ */
+void Heaters_LimitPower(Heaters_t *heaters, const float *limit)
+{
+    uint8_t cut = 0;
+
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        if (heaters->power[zone] > limit[zone]) {
+            heaters->power[zone] = limit[zone];
+            cut = 1;
+        }
+    }
+    if (cut) {
+        heaters_feed_back(heaters);
+    }
+}
+
+/**
+ * @brief Switch every zone off and clear the controller state
+ *
+ * @details The integrators restart from zero on the next control step, so
+ *          nothing accumulated while the heaters were off kicks in.
+ *
+ * @param heaters Pointer to heaters control structure
+ */
+void Heaters_Off(Heaters_t *heaters)
+{
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        PID_Reset(&heaters->pid[zone]);
+        SmithPredictor_Reset(&heaters->smith[zone]);
+        Feedforward_Reset(&heaters->feedforward[zone]);
+        heaters->power[zone] = 0.0f;
+    }
+}
+
+/**
+ * @brief Check whether every zone is currently off
+ *
+ * @param heaters Pointer to heaters control structure
+ * @return uint8_t 1 if no zone is demanding power, 0 otherwise
+ */
+uint8_t Heaters_IsIdle(const Heaters_t *heaters)
+{
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        if (heaters->power[zone] > 0.0f) {
+            return 0;
+        }
+    }
+    return 1;
+}
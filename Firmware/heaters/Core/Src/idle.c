@@ -0,0 +1,110 @@
+/**
+ * @file      idle.c
+ * @author    Adrian Silva Palafox
+ * @brief     Sleep-on-idle implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "idle.h"
+#include <stddef.h>
+
+/**
+ * @brief Initialize the idle figures
+ *
+ * @param idle Pointer to idle control structure
+ * @param htim Control tick timer handle
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef Idle_Init(Idle_t *idle, TIM_HandleTypeDef *htim)
+{
+    uint32_t clock;
+
+    /* Validate input parameters */
+    if (idle == NULL || htim == NULL) {
+        return HAL_ERROR;
+    }
+
+    /* APB1 timers run at twice PCLK1 when the bus clock is divided */
+    clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        clock *= 2U;
+    }
+
+    idle->htim = htim;
+    idle->cycles_per_count = SystemCoreClock / (clock / (htim->Instance->PSC + 1U));
+    idle->window_start = Profiling_Cycles();
+    idle->slept = 0;
+    idle->tick_carry = 0;
+    idle->sleeps = 0;
+    idle->idle_percent = 0.0f;
+    Profiling_Reset(&idle->wake_latency);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Sleep until the next interrupt unless work is pending
+ *
+ * @param idle     Pointer to idle control structure
+ * @param pending  Work flags set from interrupt handlers
+ * @param tickless Suspend SysTick during the sleep
+ */
+void Idle_Sleep(Idle_t *idle, volatile const uint8_t *pending, uint8_t tickless)
+{
+    TIM_TypeDef *tim = idle->htim->Instance;
+    uint32_t cycles_per_ms = SystemCoreClock / 1000U;
+
+    __disable_irq();
+    if (*pending == 0 &&
+        !(SCB->ICSR & (SCB_ICSR_ISRPENDING_Msk | SCB_ICSR_PENDSTSET_Msk))) {
+        uint32_t cycles = Profiling_Cycles();
+        uint32_t systick = SysTick->VAL;
+        uint32_t count = tim->CNT;
+        uint32_t slept;
+        uint32_t counted;
+
+        if (tickless) {
+            HAL_SuspendTick();
+        }
+        __DSB();
+        __WFI();
+
+        /* Interrupts are still masked: the handler that woke the core runs below */
+        if (tickless) {
+            uint32_t period = tim->ARR + 1U;
+            slept = ((tim->CNT + period - count) % period) * idle->cycles_per_count;
+            idle->tick_carry += slept;
+            uwTick += idle->tick_carry / cycles_per_ms;
+            idle->tick_carry %= cycles_per_ms;
+            HAL_ResumeTick();
+        } else if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+            /* SysTick reloaded while asleep, it counts down from LOAD */
+            uint32_t latency = SysTick->LOAD - SysTick->VAL;
+            slept = systick + latency;
+            Profiling_Record(&idle->wake_latency, latency);
+        } else {
+            slept = systick - SysTick->VAL;
+        }
+
+        /* A cycle counter gated during the sleep is advanced by the time slept.
+         * The tickless figure is only accurate to one timer count, hence the
+         * margin before deciding the counter stopped. */
+        counted = Profiling_Cycles() - cycles;
+        if (counted < slept / 2U) {
+            DWT->CYCCNT += slept - counted;
+        }
+
+        idle->slept += slept;
+        idle->sleeps++;
+    }
+    __enable_irq();
+
+    uint32_t now = Profiling_Cycles();
+    uint32_t window = now - idle->window_start;
+    if (window >= IDLE_WINDOW_MS * cycles_per_ms) {
+        idle->idle_percent = 100.0f * (float)idle->slept / (float)window;
+        idle->slept = 0;
+        idle->window_start = now;
+    }
+}
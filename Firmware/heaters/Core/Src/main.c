@@ -21,10 +21,25 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-#include "pid.h"
+#include "heaters.h"
 #include "max6675.h"
 #include "AS5048B.h"
 #include "extrusor_process.h"
+#include "process_log.h"
+#include "param_store.h"
+#include "sensor_trace.h"
+#include "profiling.h"
+#include "material_profiles.h"
+#include "triac_fire.h"
+#include "heater_supervisor.h"
+#include "watchdog.h"
+#include "idle.h"
+#include "zero_cross.h"
+#include "power_allocator.h"
+#include "warmup_planner.h"
+#include "thermal_rls.h"
+#include "temp_estimator.h"
+#include "gain_schedule.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -34,7 +49,9 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#define CONTROL_PERIOD_S 0.250f  // TIM3 period, matches the PIDs sampling time
+#define TASK_DEADLINE_MS 1000U   // Longest task silence, covers a parameter sector erase
+#define ZONE_DEAD_TIME_S 2.0f    // Thermocouple well transport delay beyond its lag
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -52,11 +69,13 @@ TIM_HandleTypeDef htim2;
 TIM_HandleTypeDef htim3;
 
 /* USER CODE BEGIN PV */
-// PID controller related
-PIDController PID0;
-PIDController PID1;
-PIDController PID2;
-uint8_t timers_isr = 0x00;
+// Heater zones (PID controllers), TRIAC outputs and their supervisor
+Heaters_t heaters;
+TriacFire_t triacs;
+ZeroCross_t zeroCross;
+HeaterSupervisor_t supervisor;
+Watchdog_t watchdog;
+volatile uint8_t timers_isr = 0x00;  // bit0: control tick, bit1: encoder read
 
 // Sensors
 float tempReadings[3] = {0};  // Stores each sensor's temperature
@@ -64,8 +83,146 @@ float pipeSetpoints[3] = {0};
 MAX6675_Driver_t tempSensors;
 
 float angleReadings[2] = {0};
+float screwRpm = 0;
 AS5048B_Driver_t encoderSensors;
 
+// Production log
+ProcessLog_t processLog;
+
+// Raw sensor inputs of the last 42 s, frozen on a heater trip for a debugger dump
+SensorTrace_t sensorTrace;
+uint16_t controlTicks = 0;
+
+// Execution time of the control tick, the sensor reads and the PID and firing
+// update (compare with a RAMFUNC_IN_FLASH build) [cycles]
+Profiling_Stopwatch_t controlTickTime;
+Profiling_Stopwatch_t thermocoupleReadTime;
+Profiling_Stopwatch_t encoderReadTime;
+Profiling_Stopwatch_t controlStepTime;
+
+// Zero-cross edge and flywheel deadline handlers, same comparison [cycles]
+Profiling_Stopwatch_t zeroCrossEdgeTime;
+Profiling_Stopwatch_t zeroCrossDeadlineTime;
+
+// Main loop sleep between interrupts, tickless also stops SysTick meanwhile
+Idle_t idle;
+uint8_t idleTickless = 0;
+
+// Process sequence and the actuator demands it sets
+ExtrusorProcess_t extrusor;
+uint8_t heatersEnabled = 0;
+float screwTargetRpm = 0;
+float winderTargetRpm = 0;
+const ExtrusorProcess_Config_t processConfig = {
+	.band = 5.0f,
+	.run_band = 15.0f,
+	.soak_time = 600.0f,
+	.feed_time = 30.0f,
+	.purge_time = 60.0f,
+	.cool_temp = 60.0f,
+	.feed_rpm = 5.0f,
+	.screw_rpm = 30.0f,
+	.purge_rpm = 20.0f,
+	.winder_rpm = 60.0f,
+	.thread_time = 120.0f,	// No operator input for EXTRUSOR_EV_THREADED yet
+};
+
+// Heater power shared with the rest of the circuit, enforced every half-cycle
+PowerAllocator_t powerAllocator;
+const PowerAllocator_Config_t powerConfig = {
+	.loads = HEATERS_ZONES,
+	.budget = 1000.0f,
+	.rated = { 400.0f, 400.0f, 400.0f },
+	.priority = { 1, 1, 1 },
+};
+
+// Warm-up ramps so every zone reaches its setpoint together, the controllers
+// follow controlSetpoints while pipeSetpoints stay the final targets
+WarmupPlanner_t warmup;
+float controlSetpoints[3] = {0};
+const WarmupPlanner_Config_t warmupConfig = {
+	// Estimated zone parameters [J/°C, W/°C, W, s] until identified on the machine
+	.zone = {
+		{ 1500.0f, 1.2f, 400.0f, 5.0f },
+		{ 2000.0f, 1.5f, 400.0f, 5.0f },
+		{ 2500.0f, 1.5f, 400.0f, 5.0f },
+	},
+	.ambient = 25.0f,
+	.budget = 1000.0f,
+	.headroom = 0.8f,
+	.ramp_limit = 10.0f / 60.0f,
+	.band = 5.0f,
+};
+
+// Zone models identified online, they replace the estimates above once valid
+ThermalRLS_t zoneModel[3];
+
+// Filtered temperatures between and across readings, the PIDs read them
+// unless pidRawReadings is set
+TempEstimator_t tempEstimator[3];
+float tempEstimates[3] = {0};
+uint8_t pidRawReadings = 0;
+
+// Static decoupling of the zone outputs, from the estimated zone parameters and
+// wall conductance until step test gains (Decoupling_SetStep) are available
+uint8_t zoneDecoupling = 0;
+const float zoneConductance[2] = { 1.0f, 1.0f };  // [W/°C]
+
+// Smith predictor on the identified zone models and the well dead time, started
+// once a zone's model is valid and updated with it. Off by default: with a
+// mismatched model it does worse than the plain PID
+uint8_t zoneSmithPredictor = 0;
+
+// Setpoint feedforward from the identified zone models, added once a zone's
+// model is valid (the integrator limits must allow negative trim). Off by
+// default: a raw setpoint step overshoots more with it, only ramps gain
+uint8_t zoneFeedforward = 0;
+
+// Gain schedule over the material profile gains: softer integral action
+// during warm-up, firmer loops at temperature while the screw feeds pellets.
+// Off by default until the table is tuned on the machine
+uint8_t gainScheduling = 0;
+PIDGains zoneBaseGains[3];
+const GainSchedule_Table_t gainTable = {
+	.temp = { 50.0f, 150.0f, 180.0f, 250.0f },
+	.rpm = { 0.0f, 30.0f, 60.0f },
+	.scale = {
+		{ { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f } },
+		{ { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f } },
+		{ { 1.0f, 1.0f, 1.0f }, { 1.5f, 1.5f, 1.0f }, { 2.0f, 2.0f, 1.0f } },
+		{ { 1.0f, 1.0f, 1.0f }, { 1.5f, 1.5f, 1.0f }, { 2.0f, 2.0f, 1.0f } },
+	},
+};
+
+// Operator acknowledge of a heater trip (set from the debugger), handled on the next control tick
+volatile uint8_t faultAcknowledge = 0;
+
+// Operator start of a run (set from the debugger), handled on the next control tick
+volatile uint8_t processStart = 0;
+
+// Material recipe, a new request is applied on the next control tick
+uint8_t materialRequest = MATERIAL_CUSTOM;
+uint8_t materialActive = MATERIAL_COUNT;
+
+// Persistent parameters, the defaults apply until something is stored
+ParamStore_t paramStore;
+const ParamStore_Data_t paramDefaults = {
+	// Conservative gains of the built-in materials, full heater range
+	.zones = {
+		{ .kp = 8.0f, .ki = 0.02f, .tau = 1.0f, .lim_max = 100.0f, .lim_max_int = 100.0f, .temp_limit = 300.0f },
+		{ .kp = 8.0f, .ki = 0.02f, .tau = 1.0f, .lim_max = 100.0f, .lim_max_int = 100.0f, .temp_limit = 300.0f },
+		{ .kp = 8.0f, .ki = 0.02f, .tau = 1.0f, .lim_max = 100.0f, .lim_max_int = 100.0f, .temp_limit = 300.0f },
+	},
+	.material = {
+		.selected = MATERIAL_CUSTOM,
+		.ramp_rate = 10.0f,
+		.screw_rpm = 30.0f,
+		.puller_rpm = 60.0f,
+		.diameter = 1.75f,
+		.density = 1.24f,
+	},
+};
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -77,11 +234,51 @@ static void MX_TIM1_Init(void);
 static void MX_TIM2_Init(void);
 static void MX_I2C1_Init(void);
 /* USER CODE BEGIN PFP */
+static void Process_Heaters(void *ctx, uint8_t enable);
+static void Process_Screw(void *ctx, float rpm);
+static void Process_Winder(void *ctx, float rpm);
+static uint8_t Process_Stopped(void);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+// Process sequence outputs, applied by the control tick and the motor loop
+static void Process_Heaters(void *ctx, uint8_t enable)
+{
+	heatersEnabled = enable;
+	if (!enable) {
+		Heaters_Off(&heaters);
+		WarmupPlanner_Stop(&warmup);
+		TriacFire_Kill(&triacs);
+		return;
+	}
+	for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+		ThermalRLS_GetZone(&zoneModel[zone], &warmup.config.zone[zone]);
+	}
+	WarmupPlanner_Start(&warmup, pipeSetpoints, tempReadings);
+	if (!triacs.armed && !HeaterSupervisor_Faults(&supervisor)) {
+		TriacFire_Arm(&triacs);
+	}
+}
+
+static void Process_Screw(void *ctx, float rpm)
+{
+	screwTargetRpm = rpm;
+}
+
+static void Process_Winder(void *ctx, float rpm)
+{
+	winderTargetRpm = rpm;
+}
+
+// Flash erases stall the core for their whole duration: only allowed with the
+// process stopped and every TRIAC output killed
+static uint8_t Process_Stopped(void)
+{
+	return (ExtrusorProcess_IsIn(&extrusor, EXTRUSOR_IDLE) ||
+			ExtrusorProcess_IsIn(&extrusor, EXTRUSOR_FAULT)) && !triacs.armed;
+}
 
 /* USER CODE END 0 */
 
@@ -121,36 +318,72 @@ int main(void)
   MX_I2C1_Init();
   /* USER CODE BEGIN 2 */
 
-  PID_Init(&PID0,
-  		  0,    //kp
-  		  0, 	//ki
-  		  0, 	//kd
-  		  0, 	//tau
-  		  0, 	//limMIN
-  		  0, 	//limMAX
-  		  0, 	//limMinInt
-  		  0, 	//limMaxInt
-	  0.250);	// tsample
-  PID_Init(&PID1,
-		  0,    //kp
-		  0, 	//ki
-		  0, 	//kd
-		  0, 	//tau
-		  0, 	//limMIN
-		  0, 	//limMAX
-		  0, 	//limMinInt
-		  0, 	//limMaxInt
-  	  0.250);	// tsample
-  PID_Init(&PID2,
-		  0,    //kp
-		  0, 	//ki
-		  0, 	//kd
-		  0, 	//tau
-		  0, 	//limMIN
-		  0, 	//limMAX
-		  0, 	//limMinInt
-		  0, 	//limMaxInt
-  	  0.250);	// tsample
+	// Stored parameters (gains, limits, setpoints, offsets and encoder zeros)
+	ParamStore_Init(&paramStore, &paramDefaults);
+	Heaters_Init(&heaters, CONTROL_PERIOD_S);
+	for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+		const ParamStore_Zone_t *z = &paramStore.data.zones[zone];
+		Heaters_ConfigureZone(&heaters, zone,
+				z->kp, z->ki, z->kd, z->tau,
+				z->lim_min, z->lim_max,
+				z->lim_min_int, z->lim_max_int);
+		zoneBaseGains[zone] = PID_GetGains(&heaters.pid[zone]);
+		pipeSetpoints[zone] = z->setpoint;
+	}
+	if (zoneDecoupling) {
+		static ThermalModel_t barrel;  // History ring, keep it off the stack
+		for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+			barrel.zone[zone] = warmupConfig.zone[zone];
+		}
+		barrel.coupling[0] = zoneConductance[0];
+		barrel.coupling[1] = zoneConductance[1];
+		Decoupling_GainFromModel(&heaters.decoupling, &barrel);
+		Decoupling_Compute(&heaters.decoupling);
+	}
+	materialRequest = paramStore.data.material.selected;
+
+	// Heater outputs and their supervision
+	HeaterSupervisor_Config_t supervisorConfig = {
+		.stuck_time = 30.0f,
+		.runaway_power = 50.0f,
+		.runaway_band = 10.0f,
+		.runaway_rise = 2.0f,
+		.runaway_time = 60.0f,
+		.overshoot = 30.0f,
+	};
+	for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+		supervisorConfig.temp_limit[zone] = paramStore.data.zones[zone].temp_limit;
+	}
+	HeaterSupervisor_Init(&supervisor, &supervisorConfig);
+	PowerAllocator_Init(&powerAllocator, &powerConfig);
+	WarmupPlanner_Init(&warmup, &warmupConfig);
+	for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+		const ThermalRLS_Config_t rlsConfig = {
+			.dt = CONTROL_PERIOD_S,
+			.decimation = 40,  // 10 s steps
+			.delay = 1,
+			.lambda = 0.998f,
+			.p0 = 100.0f,
+			.p_max = 1000.0f,
+			.min_dy = 0.5f,
+			.min_du = 5.0f,
+			.prior = warmupConfig.zone[zone],
+			.ambient = warmupConfig.ambient,
+		};
+		ThermalRLS_Init(&zoneModel[zone], &rlsConfig);
+
+		const TempEstimator_Config_t estimatorConfig = {
+			.model = warmupConfig.zone[zone],
+			.ambient = warmupConfig.ambient,
+			.q_temp = 1e-3f,
+			.q_rate = 1e-6f,
+			.r = 0.03f,  // MAX6675 quantization and noise
+		};
+		TempEstimator_Init(&tempEstimator[zone], &estimatorConfig);
+	}
+	TriacFire_Init(&triacs, &htim2);
+	ZeroCross_Init(&zeroCross, &triacs, &htim1, ZERO_CROSS_OPTO_DELAY_US);
+	TriacFire_Kill(&triacs);  // Outputs stay off until a run is started
 
   	// Themocuples initialization
 	MAX6675_Init(&tempSensors, &hspi1);
@@ -166,6 +399,39 @@ int main(void)
 	AS5048B_AddDevice(&encoderSensors, 1, 0X41);
 	//find_dev_id_address(&encoderSensors);
 	//AS5048B_CheckDiagnostics(&encoderSensors, 0);
+	for (uint8_t encoder = 0; encoder < AS5048B_MAX_DEVICES; encoder++) {
+		AS5048B_WriteZeroPosition(&encoderSensors, encoder, paramStore.data.encoders.zero_position[encoder]);
+	}
+
+	Profiling_Init();
+	Profiling_Reset(&controlTickTime);
+	Profiling_Reset(&thermocoupleReadTime);
+	Profiling_Reset(&encoderReadTime);
+	Profiling_Reset(&controlStepTime);
+	Profiling_Reset(&zeroCrossEdgeTime);
+	Profiling_Reset(&zeroCrossDeadlineTime);
+	SensorTrace_Init(&sensorTrace);
+	ZeroCross_SetTrace(&zeroCross, &sensorTrace);
+
+	// Production log recovery (may rotate sectors, heaters are still off here)
+	ProcessLog_Init(&processLog);
+
+	// Process sequence, starts in IDLE: any reset (brown-out, watchdog) leaves the
+	// barrel cold until the operator starts a run
+	const ExtrusorProcess_Outputs_t processOutputs = {
+		.heaters = Process_Heaters,
+		.screw = Process_Screw,
+		.winder = Process_Winder,
+	};
+	ExtrusorProcess_Init(&extrusor, &processConfig, &processOutputs);
+
+	// Task supervision, started last so the boot-time flash work is not counted
+	Watchdog_Init(&watchdog);
+	Watchdog_Register(&watchdog, WATCHDOG_TASK_SENSORS, TASK_DEADLINE_MS);
+	Watchdog_Register(&watchdog, WATCHDOG_TASK_CONTROL, TASK_DEADLINE_MS);
+	Watchdog_Register(&watchdog, WATCHDOG_TASK_FIRING, TASK_DEADLINE_MS);
+	Watchdog_Register(&watchdog, WATCHDOG_TASK_ENCODERS, TASK_DEADLINE_MS);
+	Idle_Init(&idle, &htim3);
 
   /* USER CODE END 2 */
 
@@ -179,28 +445,194 @@ int main(void)
 	// Check bti0 for temperature sensing and PIDs feedback-input updates
 	if (timers_isr & 0x01) {
 		timers_isr &= ~0x01;
+		Profiling_Start(&controlTickTime);
+		uint32_t now = Profiling_Micros();
 
 		// Sample temperatures
 		for (uint8_t sensor = 0; sensor < 3; sensor++) {
 			// Individual max6675 sensor's reading
-			MAX6675_ReadTemperature(&tempSensors, sensor);
+			Profiling_Start(&thermocoupleReadTime);
+			HAL_StatusTypeDef status = MAX6675_ReadTemperature(&tempSensors, sensor);
+			Profiling_Stop(&thermocoupleReadTime);
+			if (status != HAL_BUSY) {
+				SensorTrace_Record(&sensorTrace, now, SENSOR_TRACE_MAX6675,
+						sensor, tempSensors.devices[sensor].raw_data);
+			}
 		}
+		Watchdog_CheckIn(&watchdog, WATCHDOG_TASK_SENSORS);
 		// Take each measurements and compute chamber's temperature
 		for (uint8_t sensor = 0; sensor < 3; sensor++) {
-			MAX6675_GetTemperature(&tempSensors, sensor, tempReadings + sensor);
+			float temperature;
+			TempEstimator_Predict(&tempEstimator[sensor],
+					triacs.armed ? heaters.power[sensor] : 0.0f, CONTROL_PERIOD_S);
+			if (MAX6675_GetTemperature(&tempSensors, sensor, &temperature) == HAL_OK) {
+				tempReadings[sensor] = temperature + paramStore.data.zones[sensor].tc_offset;
+				TempEstimator_Correct(&tempEstimator[sensor], tempReadings[sensor]);
+			}
+			tempEstimates[sensor] = tempEstimator[sensor].temp;
+		}
+		uint8_t faults = 0;
+		for (uint8_t sensor = 0; sensor < 3; sensor++) {
+			if (!MAX6675_IsConnected(&tempSensors, sensor)) faults |= PROCESS_LOG_FAULT_ZONE(sensor);
 		}
+
+		// Acknowledged trip: zones whose fault has cleared are released, the process
+		// leaves FAULT and the TRIACs are only re-armed by the next start
+		if (faultAcknowledge) {
+			faultAcknowledge = 0;
+			if (HeaterSupervisor_Acknowledge(&supervisor, tempReadings, faults, pipeSetpoints) == 0) {
+				SensorTrace_Resume(&sensorTrace);
+				ExtrusorProcess_Post(&extrusor, EXTRUSOR_EV_RESET);
+			}
+		}
+
+		// Operator start, the only way into RUN
+		if (processStart) {
+			processStart = 0;
+			ExtrusorProcess_Post(&extrusor, EXTRUSOR_EV_START);
+		}
+
+		// Heater supervision, a tripped zone cuts every TRIAC at once
+		uint8_t tripped = HeaterSupervisor_Check(&supervisor, tempReadings, faults,
+				heaters.power, pipeSetpoints, CONTROL_PERIOD_S);
+		if (tripped) {
+			TriacFire_Kill(&triacs);
+			SensorTrace_Freeze(&sensorTrace);
+			faults |= tripped;
+		}
+		if (zeroCross.lost) faults |= PROCESS_LOG_FAULT_MAINS;
+
+		// Material change: every zone is reconfigured before this tick's control step
+		if (materialRequest != materialActive) {
+			MaterialProfile_t custom;
+			const MaterialProfile_t *profile = MaterialProfile_Get(materialRequest);
+			if (profile == NULL) {
+				materialRequest = MATERIAL_CUSTOM;
+				MaterialProfile_GetCustom(&custom, &paramStore.data);
+				profile = &custom;
+			}
+			MaterialProfile_Apply(profile, &heaters, pipeSetpoints, &extrusor.config);
+			warmup.config.ramp_limit = profile->ramp_rate / 60.0f;
+			if (heatersEnabled) {
+				// Ramp to the new setpoints, the feedforward follows ramps, not steps
+				WarmupPlanner_Start(&warmup, pipeSetpoints, tempReadings);
+			}
+			for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+				zoneBaseGains[zone] = PID_GetGains(&heaters.pid[zone]);
+			}
+			materialActive = materialRequest;
+			if (paramStore.data.material.selected != materialActive) {
+				ParamStore_Material_t material = paramStore.data.material;
+				material.selected = materialActive;
+				ParamStore_SetMaterial(&paramStore, &material);
+			}
+		}
+
+		// Advance the process sequence
+		ExtrusorProcess_Tick(&extrusor, pipeSetpoints, tempReadings, faults, CONTROL_PERIOD_S);
+		ExtrusorProcess_Dispatch(&extrusor);
+
 		// Update PIDs
-		PID_Update(&PID0, 0, tempReadings[0]);
-		PID_Update(&PID1, 0, tempReadings[1]);
-		PID_Update(&PID2, 0, tempReadings[2]);
+		SensorTrace_Record(&sensorTrace, now, SENSOR_TRACE_CONTROL_TICK,
+				0, controlTicks++);
+		Profiling_Start(&controlStepTime);
+		if (heatersEnabled) {
+			float error[HEATERS_ZONES];
+			float granted[HEATERS_ZONES];
+			const float *controlTemps = pidRawReadings ? tempReadings : tempEstimates;
+			WarmupPlanner_Step(&warmup, pipeSetpoints, tempReadings, CONTROL_PERIOD_S, controlSetpoints);
+			if (gainScheduling) {
+				for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+					PIDGains gains = GainSchedule_Lookup(&gainTable, &zoneBaseGains[zone],
+							controlTemps[zone], screwTargetRpm);
+					PID_UpdateGainsBumpless(&heaters.pid[zone], gains.Kp, gains.Ki, gains.Kd);
+				}
+			}
+			Heaters_ControlStep(&heaters, controlSetpoints, controlTemps);
+			for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+				error[zone] = controlSetpoints[zone] - controlTemps[zone];
+			}
+			PowerAllocator_Allocate(&powerAllocator, heaters.power, error, granted);
+			Heaters_LimitPower(&heaters, granted);
+		}
+		ZeroCross_Update(&zeroCross, &triacs);
+		for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+			TriacFire_SetPower(&triacs, zone, heaters.power[zone]);
+		}
+		Profiling_Stop(&controlStepTime);
+		Watchdog_CheckIn(&watchdog, WATCHDOG_TASK_FIRING);
+
+		// Zone model identification from the power actually applied
+		for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+			ThermalModel_Zone_t identified;
+			if (!(faults & PROCESS_LOG_FAULT_ZONE(zone)) &&
+					ThermalRLS_Update(&zoneModel[zone], triacs.armed ? heaters.power[zone] : 0.0f,
+							tempReadings[zone]) &&
+					ThermalRLS_GetZone(&zoneModel[zone], &identified)) {
+				TempEstimator_SetModel(&tempEstimator[zone], &identified, zoneModel[zone].ambient);
+				if (zoneFeedforward) {
+					Heaters_SetFeedforward(&heaters, zone, &identified, zoneModel[zone].ambient);
+				}
+				if (zoneSmithPredictor &&
+						!SmithPredictor_SetModel(&heaters.smith[zone], &identified)) {
+					Heaters_SetDeadTime(&heaters, zone, &identified, ZONE_DEAD_TIME_S);
+				}
+			}
+		}
+
+		// Screw speed from the angle travelled since the previous tick
+		SensorTrace_Record(&sensorTrace, now, SENSOR_TRACE_AS5048B, 0,
+				((uint16_t)encoderSensors.devices[0].registers.angle_high << 8) |
+				encoderSensors.devices[0].registers.angle_low);
+		static float prevAngle = 0;
+		float delta = angleReadings[0] - prevAngle;
+		if (delta < -180.0f) delta += 360.0f;
+		else if (delta > 180.0f) delta -= 360.0f;
+		prevAngle = angleReadings[0];
+		screwRpm = delta / 360.0f * (60.0f / CONTROL_PERIOD_S);
+
+		// Per-minute production summary
+		ProcessLog_Sample(&processLog, tempReadings, heaters.power, screwRpm, faults, CONTROL_PERIOD_S);
+		Profiling_Stop(&controlTickTime);
+		Watchdog_CheckIn(&watchdog, WATCHDOG_TASK_CONTROL);
 	}
 
 	// HEATERS
 
 	// MOTORS
-	angleReadings[0] = AS5048B_GetAngleDegrees(&encoderSensors, 0);
-	AS5048B_UpdateRegisters(&encoderSensors, 0);
+	// Blocking I2C transfers, paced by TIM3 instead of running on every wake-up
+	if (timers_isr & 0x02) {
+		timers_isr &= ~0x02;
+		angleReadings[0] = AS5048B_GetAngleDegrees(&encoderSensors, 0);
+		Profiling_Start(&encoderReadTime);
+		AS5048B_UpdateRegisters(&encoderSensors, 0);
+		Profiling_Stop(&encoderReadTime);
+		Watchdog_CheckIn(&watchdog, WATCHDOG_TASK_ENCODERS);
+	}
+
+	// PARAMETERS
+	// One deferred record per pass, compaction (16 KB erase) only while stopped
+	ParamStore_Service(&paramStore, Process_Stopped());
+
+	// LOG
+	// Sector rotation erases 128 KB (1-2 s), done ahead of time while stopped;
+	// a run that fills the sector drops its records instead
+	if (Process_Stopped() && ProcessLog_RotateDue(&processLog)) {
+		Watchdog_Service(&watchdog);
+		ProcessLog_Rotate(&processLog);
+		Watchdog_Restart(&watchdog);
+	}
 
+	// Reload the IWDG only while every task is alive
+	Watchdog_Service(&watchdog);
+
+	// Nothing left for this pass: sleep until the next interrupt. SysTick only
+	// stays off while no parameter write is waiting for the next pass and no
+	// mains half-cycle is being timed (see idle.h).
+	uint8_t zeroCrossTiming = zeroCross.period != 0 && !zeroCross.lost;
+	Idle_Sleep(&idle, &timers_isr,
+			idleTickless && !zeroCrossTiming && !ParamStore_IsPending(&paramStore));
+  }
   /* USER CODE END 3 */
 }
 
@@ -427,6 +859,14 @@ static void MX_TIM2_Init(void)
   {
     Error_Handler();
   }
+  if (HAL_TIM_OC_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_OC_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_4) != HAL_OK)
+  {
+    Error_Handler();
+  }
   /* USER CODE BEGIN TIM2_Init 2 */
 
   /* USER CODE END TIM2_Init 2 */
@@ -537,9 +977,12 @@ static void MX_GPIO_Init(void)
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
 	if (htim == &htim3){
-		timers_isr |= 0x01;
+		timers_isr |= 0x01 | 0x02;
 	}
 }
+
+// The zero-cross EXTI and TIM1 compare interrupts are dispatched straight from
+// stm32f4xx_it.c (SRAM), without the HAL callbacks
 /* USER CODE END 4 */
 
 /**
@@ -0,0 +1,161 @@
+/**
+ * @file      material_profiles.c
+ * @author    Adrian Silva Palafox
+ * @brief     Per-material recipes implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "material_profiles.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Every zone may use its whole heater, the integrator never pulls below zero */
+#define MATERIAL_FULL_POWER     { 0.0f, 100.0f, 0.0f, 100.0f }
+
+/* Built-in materials, feed zone first */
+static const MaterialProfile_t material_profiles[MATERIAL_CUSTOM] = {
+    [MATERIAL_PLA] = {
+        .name = "PLA",
+        .setpoint = { 170.0f, 185.0f, 190.0f },
+        .ramp_rate = 10.0f,
+        .gains = { { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f } },
+        .limits = { MATERIAL_FULL_POWER, MATERIAL_FULL_POWER, MATERIAL_FULL_POWER },
+        .screw_rpm = 30.0f,
+        .puller_rpm = 60.0f,
+        .diameter = 1.75f,
+        .density = 1.24f,
+    },
+    [MATERIAL_ABS] = {
+        .name = "ABS",
+        .setpoint = { 210.0f, 225.0f, 235.0f },
+        .ramp_rate = 10.0f,
+        .gains = { { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f } },
+        .limits = { MATERIAL_FULL_POWER, MATERIAL_FULL_POWER, MATERIAL_FULL_POWER },
+        .screw_rpm = 25.0f,
+        .puller_rpm = 55.0f,
+        .diameter = 1.75f,
+        .density = 1.04f,
+    },
+    [MATERIAL_PETG] = {
+        .name = "PETG",
+        .setpoint = { 200.0f, 220.0f, 230.0f },
+        .ramp_rate = 8.0f,
+        .gains = { { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f }, { 8.0f, 0.02f, 0.0f } },
+        .limits = { MATERIAL_FULL_POWER, MATERIAL_FULL_POWER, MATERIAL_FULL_POWER },
+        .screw_rpm = 28.0f,
+        .puller_rpm = 58.0f,
+        .diameter = 1.75f,
+        .density = 1.27f,
+    },
+};
+
+/**
+ * @brief Look up a built-in material
+ *
+ * @param material Material_t
+ * @return const MaterialProfile_t* Profile, NULL if not built in
+ */
+const MaterialProfile_t *MaterialProfile_Get(uint8_t material)
+{
+    if (material >= MATERIAL_CUSTOM) {
+        return NULL;
+    }
+    return &material_profiles[material];
+}
+
+/**
+ * @brief Assemble the custom material from the stored parameters
+ *
+ * @param profile Destination
+ * @param params  Parameter store image
+ */
+void MaterialProfile_GetCustom(MaterialProfile_t *profile, const ParamStore_Data_t *params)
+{
+    const ParamStore_Material_t *m = &params->material;
+
+    memcpy(profile->name, "CUSTOM", sizeof("CUSTOM"));
+
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        profile->setpoint[zone] = params->zones[zone].setpoint;
+        profile->gains[zone].Kp = params->zones[zone].kp;
+        profile->gains[zone].Ki = params->zones[zone].ki;
+        profile->gains[zone].Kd = params->zones[zone].kd;
+        profile->limits[zone].lim_min = params->zones[zone].lim_min;
+        profile->limits[zone].lim_max = params->zones[zone].lim_max;
+        profile->limits[zone].lim_min_int = params->zones[zone].lim_min_int;
+        profile->limits[zone].lim_max_int = params->zones[zone].lim_max_int;
+    }
+    profile->ramp_rate = m->ramp_rate;
+    profile->screw_rpm = m->screw_rpm;
+    profile->puller_rpm = m->puller_rpm;
+    profile->diameter = m->diameter;
+    profile->density = m->density;
+}
+
+/**
+ * @brief Store a profile as the custom material (deferred write)
+ *
+ * @param store   Pointer to store control structure
+ * @param profile Profile to store
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef MaterialProfile_SaveCustom(ParamStore_t *store, const MaterialProfile_t *profile)
+{
+    ParamStore_Material_t material;
+
+    /* Validate input parameters */
+    if (store == NULL || profile == NULL) {
+        return HAL_ERROR;
+    }
+
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        ParamStore_Zone_t z = store->data.zones[zone];
+        z.setpoint = profile->setpoint[zone];
+        z.kp = profile->gains[zone].Kp;
+        z.ki = profile->gains[zone].Ki;
+        z.kd = profile->gains[zone].Kd;
+        z.lim_min = profile->limits[zone].lim_min;
+        z.lim_max = profile->limits[zone].lim_max;
+        z.lim_min_int = profile->limits[zone].lim_min_int;
+        z.lim_max_int = profile->limits[zone].lim_max_int;
+        if (ParamStore_SetZone(store, zone, &z) != HAL_OK) {
+            return HAL_ERROR;
+        }
+    }
+
+    material = store->data.material;
+    material.ramp_rate = profile->ramp_rate;
+    material.screw_rpm = profile->screw_rpm;
+    material.puller_rpm = profile->puller_rpm;
+    material.diameter = profile->diameter;
+    material.density = profile->density;
+    return ParamStore_SetMaterial(store, &material);
+}
+
+/**
+ * @brief Reconfigure every zone and the process speeds for a material
+ *
+ * @details The limits are set first so the bumpless gain change clamps the
+ *          integrator to the new material's range. Speeds take effect the next
+ *          time the sequence enters the phase that uses them.
+ *
+ * @param profile   Material to apply
+ * @param heaters   Heater zones
+ * @param setpoints Zone setpoints [°C]
+ * @param config    Process sequence parameters
+ */
+void MaterialProfile_Apply(const MaterialProfile_t *profile, Heaters_t *heaters,
+                           float *setpoints, ExtrusorProcess_Config_t *config)
+{
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        const MaterialProfile_Limits_t *l = &profile->limits[zone];
+        PID_SetLimits(&heaters->pid[zone], l->lim_min, l->lim_max,
+                      l->lim_min_int, l->lim_max_int);
+        PID_UpdateGainsBumpless(&heaters->pid[zone], profile->gains[zone].Kp,
+                                profile->gains[zone].Ki, profile->gains[zone].Kd);
+        setpoints[zone] = profile->setpoint[zone];
+    }
+    config->screw_rpm = profile->screw_rpm;
+    config->winder_rpm = profile->puller_rpm;
+}
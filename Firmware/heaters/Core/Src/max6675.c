@@ -69,6 +69,7 @@ HAL_StatusTypeDef MAX6675_AddDevice(MAX6675_Driver_t *driver, uint8_t device_id)
     driver->devices[device_id].raw_data = 0;
     driver->devices[device_id].temperature = 0.0f;
     driver->devices[device_id].is_connected = 0;
+    driver->devices[device_id].last_read = HAL_GetTick() - MAX6675_CONVERSION_MS;
 
     /* Increment device count */
     driver->device_count++;
@@ -87,7 +88,6 @@ HAL_StatusTypeDef MAX6675_AddDevice(MAX6675_Driver_t *driver, uint8_t device_id)
 HAL_StatusTypeDef MAX6675_ReadTemperature(MAX6675_Driver_t *driver, uint8_t device_id)
 {
     HAL_StatusTypeDef status = HAL_OK;
-    uint16_t raw_temp = 0;
     uint8_t data[2] = {0};  /* Buffer for raw data from MAX6675 */
 
     /* Validate input parameters */
@@ -95,6 +95,11 @@ HAL_StatusTypeDef MAX6675_ReadTemperature(MAX6675_Driver_t *driver, uint8_t devi
         return HAL_ERROR;
     }
 
+    /* Reading before the conversion ends would abort it, keep the last value */
+    if (HAL_GetTick() - driver->devices[device_id].last_read < MAX6675_CONVERSION_MS) {
+        return HAL_BUSY;
+    }
+
     /* Begin SPI communication sequence */
     HAL_GPIO_WritePin(
         driver->cs_ports[device_id],
@@ -111,6 +116,7 @@ HAL_StatusTypeDef MAX6675_ReadTemperature(MAX6675_Driver_t *driver, uint8_t devi
         driver->cs_pins[device_id],
         GPIO_PIN_SET
     ); /* Deassert CS */
+    driver->devices[device_id].last_read = HAL_GetTick();
 
     // NEEDED TO MAKE SURE CLOCK SETS HIGH-IDLE AND SLAVE MISO GOES HI-Z
     for (int i = 0; i < 25; i++) __NOP();
@@ -122,16 +128,37 @@ HAL_StatusTypeDef MAX6675_ReadTemperature(MAX6675_Driver_t *driver, uint8_t devi
     }
 
     /* Combine the two bytes into a 16-bit value */
-    driver->devices[device_id].raw_data = (data[1] << 8) | data[0];
+    return MAX6675_ProcessFrame(driver, device_id, (data[1] << 8) | data[0]);
+}
+
+/**
+ * @brief Decode a raw 16-bit frame into the device state
+ *
+ * @param driver    Pointer to driver control structure
+ * @param device_id Device ID (0-3) the frame belongs to
+ * @param raw       Frame as shifted out by the MAX6675 (D15 first)
+ * @return HAL_StatusTypeDef HAL_OK if the frame holds a valid reading, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef MAX6675_ProcessFrame(MAX6675_Driver_t *driver, uint8_t device_id, uint16_t raw)
+{
+    HAL_StatusTypeDef status = HAL_OK;
+    uint16_t raw_temp = 0;
+
+    /* Validate input parameters */
+    if (driver == NULL || device_id >= MAX6675_MAX_DEVICES) {
+        return HAL_ERROR;
+    }
+
+    driver->devices[device_id].raw_data = raw;
 
     /*
      * Verify device integrity by checking:
-     * 1. Thermocouple input bit (should be 0 if connected)
-     * 2. Dummy bit (should be 0 for proper operation)
-     * 3. Full zeros??? ambient's temperature is present
+     * 1. Thermocouple input bit D2 (1 when the thermocouple is open)
+     * 2. Dummy bit D15 (always 0, a 1 means MISO is floating high)
+     * 3. Full zeros??? ambient's temperature is present, MISO stuck low
      */
-    if ((((driver->devices[device_id].raw_data & MAX6675_INPUT_BIT) >> 2) ==
-        ((driver->devices[device_id].raw_data & MAX6675_DUMMY_BIT) >> 15)) &&
+    if (!(driver->devices[device_id].raw_data & MAX6675_INPUT_BIT) &&
+        !(driver->devices[device_id].raw_data & MAX6675_DUMMY_BIT) &&
         (driver->devices[device_id].raw_data != 0x0000)) {
 
         /* Extract temperature data (12-bit value shifted right by 3) */
@@ -0,0 +1,321 @@
+/**
+ * @file      param_store.c
+ * @author    Adrian Silva Palafox
+ * @brief     Persistent parameter store implementation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Append-only records over two flash sectors with compaction,
+ *            single-pass boot load and deferred, coalesced writes.
+ */
+
+#include "param_store.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private constants --------------------------------------------------------*/
+static const uint32_t store_sectors[PARAM_STORE_SECTOR_COUNT] = PARAM_STORE_SECTORS;
+static const uint32_t store_addresses[PARAM_STORE_SECTOR_COUNT] = PARAM_STORE_ADDRESSES;
+
+#define RECORD_SIZE         ((uint32_t)sizeof(ParamStore_Record_t))
+#define HEADER_SIZE         ((uint32_t)sizeof(ParamStore_SectorHeader_t))
+#define RECORD_CRC_OFFSET   offsetof(ParamStore_Record_t, key)
+#define HEADER_CRC_LEN      offsetof(ParamStore_SectorHeader_t, crc)
+
+/* Private helpers ----------------------------------------------------------*/
+/**
+ * @brief Locate the RAM image of a parameter group
+ */
+static uint8_t *store_group(ParamStore_Data_t *data, uint8_t key, uint16_t *len)
+{
+    if (key <= PARAM_KEY_ZONE2) {
+        *len = sizeof(ParamStore_Zone_t);
+        return (uint8_t *)&data->zones[key - PARAM_KEY_ZONE0];
+    }
+    if (key == PARAM_KEY_ENCODERS) {
+        *len = sizeof(ParamStore_Encoders_t);
+        return (uint8_t *)&data->encoders;
+    }
+    if (key == PARAM_KEY_MATERIAL) {
+        *len = sizeof(ParamStore_Material_t);
+        return (uint8_t *)&data->material;
+    }
+    *len = 0;
+    return NULL;
+}
+
+static uint16_t store_record_crc(const ParamStore_Record_t *rec)
+{
+    return FlashIf_Crc16((const uint8_t *)rec + RECORD_CRC_OFFSET, RECORD_SIZE - RECORD_CRC_OFFSET);
+}
+
+static const ParamStore_SectorHeader_t *store_header(uint8_t index)
+{
+    return (const ParamStore_SectorHeader_t *)store_addresses[index];
+}
+
+static uint8_t store_header_valid(uint8_t index)
+{
+    const ParamStore_SectorHeader_t *hdr = store_header(index);
+
+    return (hdr->magic == PARAM_STORE_SECTOR_MAGIC) &&
+           (hdr->crc == FlashIf_Crc16(hdr, HEADER_CRC_LEN));
+}
+
+/**
+ * @brief Append the current RAM image of a group to a sector
+ */
+static HAL_StatusTypeDef store_write_record(ParamStore_t *store, uint8_t index,
+                                            uint32_t offset, uint8_t key)
+{
+    ParamStore_Record_t rec;
+    uint16_t len;
+    const uint8_t *src = store_group(&store->data, key, &len);
+
+    if (src == NULL) {
+        return HAL_ERROR;
+    }
+
+    memset(&rec, 0xFF, sizeof(rec));
+    rec.magic = PARAM_STORE_RECORD_MAGIC;
+    rec.key = key;
+    rec.version = PARAM_STORE_VERSION;
+    rec.length = len;
+    memcpy(rec.payload, src, len);
+    rec.crc = store_record_crc(&rec);
+
+    return FlashIf_Program(store_addresses[index] + offset, &rec, RECORD_SIZE);
+}
+
+/**
+ * @brief Rewrite the whole RAM image into the spare sector and switch to it
+ */
+static HAL_StatusTypeDef store_compact(ParamStore_t *store, uint32_t generation)
+{
+    ParamStore_SectorHeader_t hdr;
+    HAL_StatusTypeDef status;
+    uint8_t target = (uint8_t)((store->active + 1) % PARAM_STORE_SECTOR_COUNT);
+    uint32_t offset = HEADER_SIZE;
+
+    if (!FlashIf_IsErased(store_addresses[target], PARAM_STORE_SECTOR_SIZE)) {
+        status = FlashIf_EraseSector(store_sectors[target]);
+        if (status != HAL_OK) {
+            return status;
+        }
+    }
+
+    for (uint8_t key = 0; key < PARAM_KEY_COUNT; key++) {
+        status = store_write_record(store, target, offset, key);
+        if (status != HAL_OK) {
+            return status;
+        }
+        offset += RECORD_SIZE;
+    }
+
+    /* The header goes last: until it is written the old sector stays active */
+    hdr.magic = PARAM_STORE_SECTOR_MAGIC;
+    hdr.generation = generation;
+    hdr.reserved = 0xFFFFFFFFU;
+    hdr.reserved2 = 0xFFFF;
+    hdr.crc = FlashIf_Crc16(&hdr, HEADER_CRC_LEN);
+    status = FlashIf_Program(store_addresses[target], &hdr, HEADER_SIZE);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    store->active = target;
+    store->generation = generation;
+    store->write_offset = offset;
+    store->dirty = 0;
+    store->usable = 1;
+    return HAL_OK;
+}
+
+/* Public API ---------------------------------------------------------------*/
+/**
+ * @brief Load the parameters in a single pass over the active sector
+ *
+ * @param store    Pointer to store control structure
+ * @param defaults Values used for groups with no valid record
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ParamStore_Init(ParamStore_t *store, const ParamStore_Data_t *defaults)
+{
+    const ParamStore_Record_t *rec;
+    uint8_t found = 0;
+    uint8_t *dst;
+    uint16_t len;
+
+    /* Validate input parameters */
+    if (store == NULL || defaults == NULL) {
+        return HAL_ERROR;
+    }
+
+    store->data = *defaults;
+    store->active = 0;
+    store->generation = 0;
+    store->dirty = 0;
+
+    /* Unusable until a complete sector is found or written: no slot is free */
+    store->usable = 0;
+    store->write_offset = PARAM_STORE_SECTOR_SIZE;
+
+    /* The newest complete sector is the active one */
+    for (uint8_t i = 0; i < PARAM_STORE_SECTOR_COUNT; i++) {
+        if (store_header_valid(i) && (!found || store_header(i)->generation > store->generation)) {
+            store->active = i;
+            store->generation = store_header(i)->generation;
+            found = 1;
+        }
+    }
+
+    /* Nothing stored yet: start a sector holding the defaults. On failure every
+     * group stays dirty so the next allowed ParamStore_Service() retries. */
+    if (!found) {
+        store->active = PARAM_STORE_SECTOR_COUNT - 1;
+        if (store_compact(store, 1) != HAL_OK) {
+            store->dirty = (1U << PARAM_KEY_COUNT) - 1U;
+            return HAL_ERROR;
+        }
+        return HAL_OK;
+    }
+
+    /* Newer records of a key override older ones, torn or foreign records are skipped */
+    store->usable = 1;
+    store->write_offset = HEADER_SIZE;
+    while (store->write_offset + RECORD_SIZE <= PARAM_STORE_SECTOR_SIZE &&
+           !FlashIf_IsErased(store_addresses[store->active] + store->write_offset, RECORD_SIZE)) {
+        rec = (const ParamStore_Record_t *)(store_addresses[store->active] + store->write_offset);
+        store->write_offset += RECORD_SIZE;
+
+        if (rec->magic != PARAM_STORE_RECORD_MAGIC || rec->version != PARAM_STORE_VERSION ||
+            rec->crc != store_record_crc(rec)) {
+            continue;
+        }
+        dst = store_group(&store->data, rec->key, &len);
+        if (dst != NULL && rec->length == len) {
+            memcpy(dst, rec->payload, len);
+        }
+    }
+
+    /* Compact now, while nothing else is running, rather than during a run */
+    if (store->write_offset >= (uint32_t)(PARAM_STORE_BOOT_COMPACT * PARAM_STORE_SECTOR_SIZE)) {
+        return store_compact(store, store->generation + 1);
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Update the parameters of one zone (deferred write)
+ *
+ * @param store  Pointer to store control structure
+ * @param zone   Zone index
+ * @param params New zone parameters
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ParamStore_SetZone(ParamStore_t *store, uint8_t zone, const ParamStore_Zone_t *params)
+{
+    /* Validate input parameters */
+    if (store == NULL || params == NULL || zone >= PARAM_STORE_ZONES) {
+        return HAL_ERROR;
+    }
+
+    store->data.zones[zone] = *params;
+    store->dirty |= 1U << (PARAM_KEY_ZONE0 + zone);
+    return HAL_OK;
+}
+
+/**
+ * @brief Update the zero position of one encoder (deferred write)
+ *
+ * @param store    Pointer to store control structure
+ * @param encoder  Encoder index
+ * @param position 14-bit zero position
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ParamStore_SetEncoderZero(ParamStore_t *store, uint8_t encoder, uint16_t position)
+{
+    /* Validate input parameters */
+    if (store == NULL || encoder >= AS5048B_MAX_DEVICES) {
+        return HAL_ERROR;
+    }
+
+    store->data.encoders.zero_position[encoder] = position & 0x3FFF;
+    store->dirty |= 1U << PARAM_KEY_ENCODERS;
+    return HAL_OK;
+}
+
+/**
+ * @brief Update the material selection and custom material (deferred write)
+ *
+ * @param store    Pointer to store control structure
+ * @param material New material parameters
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ParamStore_SetMaterial(ParamStore_t *store, const ParamStore_Material_t *material)
+{
+    /* Validate input parameters */
+    if (store == NULL || material == NULL) {
+        return HAL_ERROR;
+    }
+
+    store->data.material = *material;
+    store->dirty |= 1U << PARAM_KEY_MATERIAL;
+    return HAL_OK;
+}
+
+/**
+ * @brief Write pending changes, at most one record per call
+ *
+ * @param store       Pointer to store control structure
+ * @param allow_erase 1 if a compaction may stall the CPU now
+ * @return HAL_StatusTypeDef HAL_OK, HAL_BUSY when compaction is deferred, HAL_ERROR
+ */
+HAL_StatusTypeDef ParamStore_Service(ParamStore_t *store, uint8_t allow_erase)
+{
+    HAL_StatusTypeDef status;
+    uint8_t key = 0;
+
+    /* Validate input parameters */
+    if (store == NULL) {
+        return HAL_ERROR;
+    }
+
+    if (store->dirty == 0) {
+        return HAL_OK;
+    }
+
+    /* Sector full or never formatted: the compaction writes every group at once */
+    if (!store->usable || store->write_offset + RECORD_SIZE > PARAM_STORE_SECTOR_SIZE) {
+        if (!allow_erase) {
+            return HAL_BUSY;
+        }
+        return store_compact(store, store->generation + 1);
+    }
+
+    while (!(store->dirty & (1U << key))) {
+        key++;
+    }
+
+    status = store_write_record(store, store->active, store->write_offset, key);
+
+    /* The slot is consumed even on failure, flash words are never programmed twice */
+    store->write_offset += RECORD_SIZE;
+    if (status == HAL_OK) {
+        store->dirty &= ~(1U << key);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check whether changes are waiting to be written
+ *
+ * @param store Pointer to store control structure
+ * @return uint8_t 1 if a group is dirty, 0 otherwise
+ */
+uint8_t ParamStore_IsPending(const ParamStore_t *store)
+{
+    return (store != NULL) && (store->dirty != 0);
+}
@@ -19,6 +19,7 @@
 
 // Include the header file for the PID implementation
 #include "pid.h"
+#include "ramfunc.h"
 
 // Function to initialize the PID controller
 void PID_Init(PIDController* pid, float kp, float ki, float kd,
@@ -58,6 +59,9 @@ void PID_Init(PIDController* pid, float kp, float ki, float kd,
     // Initialize previous measurement (for derivative calculation)
     pid->prevMeasurement = 0.0f;
 
+    // No feedforward until one is set
+    pid->feedforward = 0.0f;
+
     // Initialize controller output
     pid->out = 0.0f;
 }
@@ -69,11 +73,12 @@ void PID_Reset(PIDController* pid)
     pid->prevError = 0.0f;       // Reset previous error
     pid->differentiator = 0.0f;  // Reset differentiator
     pid->prevMeasurement = 0.0f; // Reset previous measurement
+    pid->feedforward = 0.0f;     // Reset feedforward
     pid->out = 0.0f;             // Reset output
 }
 
-// Function that updates the PID controller each time it is called
-float PID_Update(PIDController* pid, float setpoint, float measurement)
+// Function that updates the PID controller each time it is called (runs from SRAM)
+RAMFUNC float PID_Update(PIDController* pid, float setpoint, float measurement)
 {
     // Calculate error (difference between setpoint and measurement)
     float error = setpoint - measurement;
@@ -99,8 +104,8 @@ float PID_Update(PIDController* pid, float setpoint, float measurement)
                          (2.0f * pid->tau - pid->T) * pid->differentiator) /
                          (2.0f * pid->tau + pid->T);
 
-    // Calculate total controller output (Sum of proportional, integral, and derivative)
-    pid->out = proportional + pid->integrator + pid->differentiator;
+    // Calculate total controller output (Sum of proportional, integral, derivative and feedforward)
+    pid->out = proportional + pid->integrator + pid->differentiator + pid->feedforward;
 
     // Apply limits to the output (controller output must be within defined limits)
     if (pid->out > pid->limMax)
@@ -120,6 +125,66 @@ float PID_Update(PIDController* pid, float setpoint, float measurement)
     return pid->out;
 }
 
+// Function to report the output actually applied when something after the controller changed it (runs from SRAM)
+RAMFUNC void PID_LimitOutput(PIDController* pid, float applied)
+{
+    float excess = pid->out - applied;
+
+    if (excess == 0.0f)
+    {
+        return; // Applied as computed
+    }
+
+    // Move the integrator by what could not be applied, in either direction,
+    // within its own limits: the proportional term alone may exceed the output
+    // limit during warm-up, the integrator limits bound the give-back
+    pid->integrator -= excess;
+    if (pid->integrator > pid->limMaxInt)
+    {
+        pid->integrator = pid->limMaxInt;
+    }
+    else if (pid->integrator < pid->limMinInt)
+    {
+        pid->integrator = pid->limMinInt;
+    }
+
+    pid->out = applied; // Output actually applied
+}
+
+// Function to set the feedforward term, limited together with the feedback terms (runs from SRAM)
+RAMFUNC void PID_SetFeedforward(PIDController* pid, float feedforward)
+{
+    pid->feedforward = feedforward;
+}
+
+// Function to replace the limits at runtime, the state is brought inside the new ones
+void PID_SetLimits(PIDController* pid, float limMin, float limMax, float limMinInt, float limMaxInt)
+{
+    pid->limMin = limMin;
+    pid->limMax = limMax;
+    pid->limMinInt = limMinInt;
+    pid->limMaxInt = limMaxInt;
+
+    // An integrator outside the new limits would take several ticks to come back
+    if (pid->integrator > limMaxInt)
+    {
+        pid->integrator = limMaxInt;
+    }
+    else if (pid->integrator < limMinInt)
+    {
+        pid->integrator = limMinInt;
+    }
+
+    if (pid->out > limMax)
+    {
+        pid->out = limMax;
+    }
+    else if (pid->out < limMin)
+    {
+        pid->out = limMin;
+    }
+}
+
 // Function to update Kp, Ki, and Kd gains at runtime
 void PID_UpdateGains(PIDController* pid, float kp, float ki, float kd)
 {
@@ -128,6 +193,32 @@ void PID_UpdateGains(PIDController* pid, float kp, float ki, float kd)
     pid->Kd = kd; // Update derivative gain
 }
 
+// Function to update the gains while the controller runs, keeping its output continuous
+void PID_UpdateGainsBumpless(PIDController* pid, float kp, float ki, float kd)
+{
+    // The proportional term moves by (kp - Kp) * error: the integrator takes the difference
+    pid->integrator -= (kp - pid->Kp) * pid->prevError;
+    if (pid->integrator > pid->limMaxInt)
+    {
+        pid->integrator = pid->limMaxInt;
+    }
+    else if (pid->integrator < pid->limMinInt)
+    {
+        pid->integrator = pid->limMinInt;
+    }
+
+    // The derivative state is proportional to Kd, rescale it
+    if (pid->Kd != 0.0f)
+    {
+        pid->differentiator *= kd / pid->Kd;
+    }
+
+    // The integrator already holds Ki * error accumulated, Ki changes without a step
+    pid->Kp = kp;
+    pid->Ki = ki;
+    pid->Kd = kd;
+}
+
 // Functions to get Kp, Ki, and Kd gains individually
 float PID_GetKp(const PIDController* pid)
 {
@@ -0,0 +1,148 @@
+/**
+ * @file      power_allocator.c
+ * @author    Adrian Silva Palafox
+ * @brief     Shared power budget implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "power_allocator.h"
+
+/**
+ * @brief Water-fill the remaining budget over the loads of one priority level
+ *
+ * @details Loads saturate in order of demand / weight: each one that fits
+ *          under the current level gets its whole demand and leaves the rest
+ *          to share the remainder; the others get level * weight.
+ *
+ * @param member    Load indices of the level
+ * @param count     Number of loads in the level
+ * @param demand    Demand of each load [W]
+ * @param weight    Weight of each load
+ * @param remaining Budget left [W]
+ * @param grant     Granted power of each load [W]
+ */
+static void allocator_fill(uint8_t *member, uint8_t count, const float *demand,
+                           const float *weight, float remaining, float *grant)
+{
+    float weights = 0.0f;
+
+    /* Sort by saturation level, a handful of loads at most */
+    for (uint8_t i = 0; i < count; i++) {
+        for (uint8_t j = i + 1; j < count; j++) {
+            if (demand[member[j]] * weight[member[i]] < demand[member[i]] * weight[member[j]]) {
+                uint8_t tmp = member[i];
+                member[i] = member[j];
+                member[j] = tmp;
+            }
+        }
+        weights += weight[member[i]];
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t n = member[i];
+        float level = remaining / weights;
+
+        if (demand[n] <= level * weight[n]) {
+            grant[n] = demand[n];
+            remaining -= demand[n];
+            weights -= weight[n];
+        } else {
+            for (uint8_t k = i; k < count; k++) {
+                grant[member[k]] = level * weight[member[k]];
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Initialize the allocator
+ *
+ * @param pa     Pointer to allocator control structure
+ * @param config Loads and budget
+ */
+void PowerAllocator_Init(PowerAllocator_t *pa, const PowerAllocator_Config_t *config)
+{
+    pa->config = *config;
+    if (pa->config.loads > POWER_ALLOCATOR_MAX_LOADS) {
+        pa->config.loads = POWER_ALLOCATOR_MAX_LOADS;
+    }
+    pa->total = 0.0f;
+    pa->limited = 0;
+}
+
+/**
+ * @brief Share the budget among the requests
+ *
+ * @param pa      Pointer to allocator control structure
+ * @param request Requested power of each load [%]
+ * @param error   Control error of each load [°C]
+ * @param granted Power granted to each load [%]
+ * @return float  Total power granted [W]
+ */
+float PowerAllocator_Allocate(PowerAllocator_t *pa, const float *request,
+                              const float *error, float *granted)
+{
+    const PowerAllocator_Config_t *c = &pa->config;
+    float demand[POWER_ALLOCATOR_MAX_LOADS];
+    float weight[POWER_ALLOCATOR_MAX_LOADS];
+    float grant[POWER_ALLOCATOR_MAX_LOADS];
+    float remaining = c->budget;
+    uint8_t served = 0;
+    uint8_t all = (uint8_t)((1U << c->loads) - 1U);
+
+    for (uint8_t n = 0; n < c->loads; n++) {
+        float percent = request[n];
+        if (percent < 0.0f) {
+            percent = 0.0f;
+        } else if (percent > 100.0f) {
+            percent = 100.0f;
+        }
+        demand[n] = percent * 0.01f * c->rated[n];
+        weight[n] = (error[n] > POWER_ALLOCATOR_MIN_WEIGHT) ? error[n] : POWER_ALLOCATOR_MIN_WEIGHT;
+        grant[n] = 0.0f;
+    }
+
+    /* Highest priority level first, until the budget runs out */
+    while (served != all && remaining > 0.0f) {
+        uint8_t member[POWER_ALLOCATOR_MAX_LOADS];
+        uint8_t count = 0;
+        uint8_t top = 0;
+        float total = 0.0f;
+
+        for (uint8_t n = 0; n < c->loads; n++) {
+            if (!(served & (1U << n)) && c->priority[n] >= top) {
+                top = c->priority[n];
+            }
+        }
+        for (uint8_t n = 0; n < c->loads; n++) {
+            if (!(served & (1U << n)) && c->priority[n] == top) {
+                member[count++] = n;
+                served |= 1U << n;
+                total += demand[n];
+            }
+        }
+
+        if (total <= remaining) {
+            for (uint8_t i = 0; i < count; i++) {
+                grant[member[i]] = demand[member[i]];
+            }
+            remaining -= total;
+        } else {
+            allocator_fill(member, count, demand, weight, remaining, grant);
+            remaining = 0.0f;
+        }
+    }
+
+    pa->limited = 0;
+    for (uint8_t n = 0; n < c->loads; n++) {
+        if (grant[n] < demand[n]) {
+            pa->limited |= 1U << n;
+        }
+        granted[n] = (c->rated[n] > 0.0f) ? grant[n] * 100.0f / c->rated[n] : 0.0f;
+    }
+    pa->total = c->budget - remaining;
+
+    return pa->total;
+}
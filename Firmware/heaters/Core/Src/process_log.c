@@ -0,0 +1,328 @@
+/**
+ * @file      process_log.c
+ * @author    Adrian Silva Palafox
+ * @brief     Flash-backed circular process log implementation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Log-structured storage of per-minute process summaries with
+ *            round-robin sector rotation and power-loss tolerant appends.
+ */
+
+#include "process_log.h"
+#include <stddef.h>
+
+/* Private constants --------------------------------------------------------*/
+static const uint32_t log_sectors[PROCESS_LOG_SECTOR_COUNT] = PROCESS_LOG_SECTORS;
+static const uint32_t log_addresses[PROCESS_LOG_SECTOR_COUNT] = PROCESS_LOG_ADDRESSES;
+
+#define RECORD_SIZE         ((uint32_t)sizeof(ProcessLog_Record_t))
+#define HEADER_SIZE         ((uint32_t)sizeof(ProcessLog_SectorHeader_t))
+#define RECORD_CRC_OFFSET   offsetof(ProcessLog_Record_t, sequence)
+#define HEADER_CRC_LEN      offsetof(ProcessLog_SectorHeader_t, crc)
+
+/* Private helpers ----------------------------------------------------------*/
+static const ProcessLog_SectorHeader_t *log_header(uint8_t index)
+{
+    return (const ProcessLog_SectorHeader_t *)log_addresses[index];
+}
+
+static uint8_t log_header_valid(uint8_t index)
+{
+    const ProcessLog_SectorHeader_t *hdr = log_header(index);
+
+    return (hdr->magic == PROCESS_LOG_SECTOR_MAGIC) &&
+           (hdr->crc == FlashIf_Crc16(hdr, HEADER_CRC_LEN));
+}
+
+static uint8_t log_record_valid(const ProcessLog_Record_t *rec)
+{
+    return (rec->magic == PROCESS_LOG_RECORD_MAGIC) &&
+           (rec->crc == FlashIf_Crc16((const uint8_t *)rec + RECORD_CRC_OFFSET,
+                                      RECORD_SIZE - RECORD_CRC_OFFSET));
+}
+
+static uint8_t log_track_sequence(const ProcessLog_Record_t *rec, void *ctx)
+{
+    uint32_t *next = (uint32_t *)ctx;
+
+    if (rec->sequence + 1 > *next) {
+        *next = rec->sequence + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Erase a sector and stamp it with a new header
+ */
+static HAL_StatusTypeDef log_format(ProcessLog_t *log, uint8_t index,
+                                    uint32_t generation, uint32_t erase_count)
+{
+    ProcessLog_SectorHeader_t hdr;
+    HAL_StatusTypeDef status;
+
+    /* Keep the erase counter of a sector that already carried one */
+    if (log_header_valid(index)) {
+        erase_count = log_header(index)->erase_count;
+    }
+
+    if (!FlashIf_IsErased(log_addresses[index], PROCESS_LOG_SECTOR_SIZE)) {
+        status = FlashIf_EraseSector(log_sectors[index]);
+        if (status != HAL_OK) {
+            return status;
+        }
+        erase_count++;
+    }
+
+    hdr.magic = PROCESS_LOG_SECTOR_MAGIC;
+    hdr.generation = generation;
+    hdr.erase_count = erase_count;
+    hdr.reserved = 0xFFFF;
+    hdr.crc = FlashIf_Crc16(&hdr, HEADER_CRC_LEN);
+
+    status = FlashIf_Program(log_addresses[index], &hdr, HEADER_SIZE);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    log->active = index;
+    log->generation = generation;
+    log->erase_count = erase_count;
+    log->write_offset = HEADER_SIZE;
+    return HAL_OK;
+}
+
+/* Public API ---------------------------------------------------------------*/
+/**
+ * @brief Recover the log state from flash
+ *
+ * @param log Pointer to log control structure
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ProcessLog_Init(ProcessLog_t *log)
+{
+    uint8_t found = 0;
+
+    /* Validate input parameters */
+    if (log == NULL) {
+        return HAL_ERROR;
+    }
+
+    *log = (ProcessLog_t){0};
+
+    /* The newest valid sector is the active one */
+    for (uint8_t i = 0; i < PROCESS_LOG_SECTOR_COUNT; i++) {
+        if (log_header_valid(i) && (!found || log_header(i)->generation > log->generation)) {
+            log->active = i;
+            log->generation = log_header(i)->generation;
+            log->erase_count = log_header(i)->erase_count;
+            found = 1;
+        }
+    }
+
+    if (!found) {
+        return log_format(log, 0, 1, 0);
+    }
+
+    /*
+     * Find the first untouched slot. Torn records are not erased, so they are
+     * stepped over here and rejected by their CRC when the log is read.
+     */
+    log->write_offset = HEADER_SIZE;
+    while (log->write_offset + RECORD_SIZE <= PROCESS_LOG_SECTOR_SIZE &&
+           !FlashIf_IsErased(log_addresses[log->active] + log->write_offset, RECORD_SIZE)) {
+        log->write_offset += RECORD_SIZE;
+    }
+
+    /* Continue numbering after the newest record in any sector */
+    ProcessLog_Stream(log, log_track_sequence, &log->sequence);
+
+    /* Rotate now, while the heaters are off, rather than in the middle of a run */
+    if (ProcessLog_RotateDue(log)) {
+        return ProcessLog_Rotate(log);
+    }
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Check whether the active sector is due for rotation
+ *
+ * @param log Pointer to log control structure
+ * @return uint8_t 1 if due, 0 otherwise
+ */
+uint8_t ProcessLog_RotateDue(const ProcessLog_t *log)
+{
+    return (log != NULL) &&
+           (log->write_offset >= (uint32_t)(PROCESS_LOG_ROTATE_FILL * PROCESS_LOG_SECTOR_SIZE));
+}
+
+/**
+ * @brief Move to the next sector in the ring, erasing its oldest data
+ *
+ * @param log Pointer to log control structure
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ProcessLog_Rotate(ProcessLog_t *log)
+{
+    uint8_t next;
+
+    /* Validate input parameters */
+    if (log == NULL) {
+        return HAL_ERROR;
+    }
+
+    next = (uint8_t)((log->active + 1) % PROCESS_LOG_SECTOR_COUNT);
+    return log_format(log, next, log->generation + 1, log->erase_count);
+}
+
+/**
+ * @brief Accumulate one control-tick sample into the current summary
+ *
+ * @param log       Pointer to log control structure
+ * @param temps     Zone temperatures [°C]
+ * @param power     Zone heater power [%]
+ * @param screw_rpm Screw speed [RPM]
+ * @param faults    Fault bits
+ * @param dt        Time since the previous sample [s]
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ProcessLog_Sample(ProcessLog_t *log, const float *temps,
+                                    const float *power, float screw_rpm,
+                                    uint8_t faults, float dt)
+{
+    ProcessLog_Record_t rec;
+    float avg;
+
+    /* Validate input parameters */
+    if (log == NULL || temps == NULL || power == NULL) {
+        return HAL_ERROR;
+    }
+
+    for (uint8_t z = 0; z < PROCESS_LOG_ZONES; z++) {
+        log->temp_sum[z] += temps[z];
+        log->power_sum[z] += power[z];
+        if (log->samples == 0 || temps[z] > log->temp_max[z]) {
+            log->temp_max[z] = temps[z];
+        }
+    }
+    log->rpm_sum += screw_rpm;
+    log->faults |= faults;
+    log->samples++;
+    log->elapsed += dt;
+
+    if (log->elapsed < PROCESS_LOG_PERIOD_S) {
+        return HAL_OK;
+    }
+
+    /* Pack the summary into fixed-point fields */
+    log->uptime_min++;
+    rec.uptime_min = log->uptime_min;
+    for (uint8_t z = 0; z < PROCESS_LOG_ZONES; z++) {
+        rec.temp_avg[z] = (int16_t)(4.0f * log->temp_sum[z] / log->samples);
+        rec.temp_max[z] = (int16_t)(4.0f * log->temp_max[z]);
+        avg = log->power_sum[z] / log->samples;
+        rec.power_avg[z] = (uint8_t)(avg < 0.0f ? 0.0f : (avg > 100.0f ? 100.0f : avg));
+    }
+    rec.faults = log->faults;
+    avg = 10.0f * log->rpm_sum / log->samples;
+    rec.throughput = (uint16_t)(avg < 0.0f ? 0.0f : (avg > 65535.0f ? 65535.0f : avg));
+    rec.reserved = 0xFFFF;
+
+    /* Restart the accumulators */
+    for (uint8_t z = 0; z < PROCESS_LOG_ZONES; z++) {
+        log->temp_sum[z] = 0.0f;
+        log->temp_max[z] = 0.0f;
+        log->power_sum[z] = 0.0f;
+    }
+    log->rpm_sum = 0.0f;
+    log->faults = 0;
+    log->samples = 0;
+    log->elapsed -= PROCESS_LOG_PERIOD_S;
+
+    return ProcessLog_Append(log, &rec);
+}
+
+/**
+ * @brief Append a record to the log
+ *
+ * @param log    Pointer to log control structure
+ * @param record Record to store (magic, sequence and crc are filled in)
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ProcessLog_Append(ProcessLog_t *log, ProcessLog_Record_t *record)
+{
+    HAL_StatusTypeDef status;
+
+    /* Validate input parameters */
+    if (log == NULL || record == NULL) {
+        return HAL_ERROR;
+    }
+
+    /* No erase here: it would stall the firing interrupts for seconds mid-run */
+    if (log->write_offset + RECORD_SIZE > PROCESS_LOG_SECTOR_SIZE) {
+        log->dropped++;
+        return HAL_BUSY;
+    }
+
+    record->magic = PROCESS_LOG_RECORD_MAGIC;
+    record->sequence = log->sequence;
+    record->crc = FlashIf_Crc16((const uint8_t *)record + RECORD_CRC_OFFSET,
+                                RECORD_SIZE - RECORD_CRC_OFFSET);
+
+    status = FlashIf_Program(log_addresses[log->active] + log->write_offset, record, RECORD_SIZE);
+
+    /* A failed slot is left behind either way, never program it twice */
+    log->write_offset += RECORD_SIZE;
+    if (status == HAL_OK) {
+        log->sequence++;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Stream every valid record from oldest to newest
+ *
+ * @param log      Pointer to log control structure
+ * @param callback Called once per record
+ * @param ctx      User pointer passed to the callback
+ * @return uint32_t Number of records delivered
+ */
+uint32_t ProcessLog_Stream(const ProcessLog_t *log, ProcessLog_Callback_t callback, void *ctx)
+{
+    const ProcessLog_Record_t *rec;
+    uint32_t count = 0;
+    uint32_t end;
+    uint8_t index;
+
+    /* Validate input parameters */
+    if (log == NULL || callback == NULL) {
+        return 0;
+    }
+
+    /* Walk the ring starting right after the active sector, which is the oldest */
+    for (uint8_t k = 1; k <= PROCESS_LOG_SECTOR_COUNT; k++) {
+        index = (uint8_t)((log->active + k) % PROCESS_LOG_SECTOR_COUNT);
+        if (!log_header_valid(index) || log_header(index)->generation > log->generation) {
+            continue;
+        }
+
+        end = (index == log->active) ? log->write_offset : PROCESS_LOG_SECTOR_SIZE;
+        for (uint32_t offset = HEADER_SIZE; offset + RECORD_SIZE <= end; offset += RECORD_SIZE) {
+            rec = (const ProcessLog_Record_t *)(log_addresses[index] + offset);
+            if (rec->magic == 0xFFFF && index != log->active) {
+                break; /* Rest of a retired sector was never written */
+            }
+            if (!log_record_valid(rec)) {
+                continue;
+            }
+            count++;
+            if (callback(rec, ctx) != 0) {
+                return count;
+            }
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file      profiling.c
+ * @author    Adrian Silva Palafox
+ * @brief     Cycle-accurate timing implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "profiling.h"
+#include "ramfunc.h"
+
+/* Microsecond time base state */
+static uint32_t last_cycles;
+static uint32_t pending_cycles;
+static uint32_t micros;
+
+/**
+ * @brief Enable the DWT cycle counter
+ */
+void Profiling_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    last_cycles = 0;
+    pending_cycles = 0;
+    micros = 0;
+}
+
+/**
+ * @brief Time since Profiling_Init()
+ *
+ * @return uint32_t Elapsed time [us]
+ */
+uint32_t Profiling_Micros(void)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+
+    /* Unsigned subtraction absorbs one counter wrap */
+    pending_cycles += now - last_cycles;
+    last_cycles = now;
+
+    micros += pending_cycles / cycles_per_us;
+    pending_cycles %= cycles_per_us;
+
+    return micros;
+}
+
+/**
+ * @brief Clear the figures of a stopwatch
+ *
+ * @param sw Pointer to stopwatch
+ */
+void Profiling_Reset(Profiling_Stopwatch_t *sw)
+{
+    sw->start = 0;
+    sw->last = 0;
+    sw->min = UINT32_MAX;
+    sw->max = 0;
+    sw->total = 0;
+    sw->count = 0;
+}
+
+/**
+ * @brief Mark the end of a measured section and update the figures (runs
+ *        from SRAM, the zero-cross handlers are timed with it)
+ *
+ * @param sw Pointer to stopwatch
+ * @return uint32_t Duration of this run [cycles]
+ */
+RAMFUNC uint32_t Profiling_Stop(Profiling_Stopwatch_t *sw)
+{
+    uint32_t cycles = DWT->CYCCNT - sw->start;
+
+    Profiling_Record(sw, cycles);
+    return cycles;
+}
+
+/**
+ * @brief Add a duration measured elsewhere to the figures of a stopwatch
+ *        (runs from SRAM)
+ *
+ * @param sw     Pointer to stopwatch
+ * @param cycles Duration [cycles]
+ */
+RAMFUNC void Profiling_Record(Profiling_Stopwatch_t *sw, uint32_t cycles)
+{
+    sw->last = cycles;
+    if (cycles < sw->min) {
+        sw->min = cycles;
+    }
+    if (cycles > sw->max) {
+        sw->max = cycles;
+    }
+    sw->total += cycles;
+    sw->count++;
+}
+
+/**
+ * @brief Convert a cycle count to microseconds at the current core clock
+ *
+ * @param cycles Core clock cycles
+ * @return uint32_t Duration [us]
+ */
+uint32_t Profiling_CyclesToMicros(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000U);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file      sensor_trace.c
+ * @author    Adrian Silva Palafox
+ * @brief     Flight recorder of raw sensor data implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "sensor_trace.h"
+
+#define TRACE_MASK  (SENSOR_TRACE_DEPTH - 1U)
+
+/**
+ * @brief Clear the trace and enable recording
+ *
+ * @param trace Pointer to trace control structure
+ */
+void SensorTrace_Init(SensorTrace_t *trace)
+{
+    trace->head = 0;
+    trace->tail = 0;
+    trace->enabled = 1;
+}
+
+/**
+ * @brief Append one record, overwriting the oldest when full
+ *
+ * @param trace   Pointer to trace control structure
+ * @param time    Capture time [us]
+ * @param type    SensorTrace_Type_t
+ * @param channel Device or encoder index
+ * @param value   Raw data
+ */
+void SensorTrace_Record(SensorTrace_t *trace, uint32_t time, uint8_t type,
+                        uint8_t channel, uint16_t value)
+{
+    SensorTrace_Record_t *rec;
+
+    if (!trace->enabled) {
+        return;
+    }
+
+    rec = &trace->records[trace->head & TRACE_MASK];
+    rec->time = time;
+    rec->type = type;
+    rec->channel = channel;
+    rec->value = value;
+    trace->head++;
+
+    /* Drop the oldest record when the reader falls a full buffer behind */
+    if (trace->head - trace->tail > SENSOR_TRACE_DEPTH) {
+        trace->tail = trace->head - SENSOR_TRACE_DEPTH;
+    }
+}
+
+/**
+ * @brief Stop recording, the records kept stay readable
+ *
+ * @param trace Pointer to trace control structure
+ */
+void SensorTrace_Freeze(SensorTrace_t *trace)
+{
+    trace->enabled = 0;
+}
+
+/**
+ * @brief Record again after SensorTrace_Freeze()
+ *
+ * @param trace Pointer to trace control structure
+ */
+void SensorTrace_Resume(SensorTrace_t *trace)
+{
+    trace->enabled = 1;
+}
+
+/**
+ * @brief Take the oldest record out of the trace
+ *
+ * @param trace  Pointer to trace control structure
+ * @param record Destination
+ * @return uint8_t 1 if a record was returned, 0 if the trace is empty
+ */
+uint8_t SensorTrace_Next(SensorTrace_t *trace, SensorTrace_Record_t *record)
+{
+    if (trace->tail == trace->head) {
+        return 0;
+    }
+
+    *record = trace->records[trace->tail & TRACE_MASK];
+    trace->tail++;
+    return 1;
+}
+
+/**
+ * @brief Number of records available to read
+ *
+ * @param trace Pointer to trace control structure
+ * @return uint32_t Record count
+ */
+uint32_t SensorTrace_Count(const SensorTrace_t *trace)
+{
+    return trace->head - trace->tail;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file      smith_predictor.c
+ * @author    Adrian Silva Palafox
+ * @brief     Smith predictor implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "smith_predictor.h"
+#include "ramfunc.h"
+#include <stddef.h>
+
+/**
+ * @brief Set the zone model and dead time
+ *
+ * @param sp        Pointer to predictor control structure
+ * @param model     Zone model, NULL to switch the predictor off
+ * @param dead_time Transport delay on top of the thermocouple lag [s]
+ * @param t         Control period [s]
+ */
+void SmithPredictor_Init(SmithPredictor_t *sp, const ThermalModel_Zone_t *model,
+                         float dead_time, float t)
+{
+    uint32_t delay = (t > 0.0f && dead_time > 0.0f) ? (uint32_t)(dead_time / t + 0.5f) : 0U;
+
+    if (model != NULL) {
+        sp->model = *model;
+    } else {
+        sp->model.heat_capacity = 0.0f;
+    }
+    sp->T = t;
+    sp->delay = (uint16_t)((delay > SMITH_PREDICTOR_MAX_DELAY) ? SMITH_PREDICTOR_MAX_DELAY : delay);
+    SmithPredictor_Reset(sp);
+}
+
+/**
+ * @brief Replace the model of a running predictor, keeping its state
+ *
+ * @param sp    Pointer to predictor control structure
+ * @param model New zone model
+ * @return uint8_t 1 if replaced, 0 if the predictor is off or the model has
+ *                 no heat capacity
+ */
+uint8_t SmithPredictor_SetModel(SmithPredictor_t *sp, const ThermalModel_Zone_t *model)
+{
+    if (sp->model.heat_capacity <= 0.0f || model == NULL || model->heat_capacity <= 0.0f) {
+        return 0;
+    }
+
+    sp->model = *model;
+    return 1;
+}
+
+/**
+ * @brief Clear the model state
+ *
+ * @param sp Pointer to predictor control structure
+ */
+void SmithPredictor_Reset(SmithPredictor_t *sp)
+{
+    sp->undelayed = 0.0f;
+    sp->lagged = 0.0f;
+    sp->delayed = 0.0f;
+    for (uint16_t i = 0; i <= SMITH_PREDICTOR_MAX_DELAY; i++) {
+        sp->history[i] = 0.0f;
+    }
+    sp->head = 0;
+}
+
+/**
+ * @brief One PID update through the predictor (runs from SRAM)
+ *
+ * @param sp          Pointer to predictor control structure
+ * @param pid         Zone controller
+ * @param setpoint    Setpoint [°C]
+ * @param measurement Thermocouple reading [°C]
+ * @param applied     Power applied over the previous period [%]
+ * @return float      Controller output [%]
+ */
+RAMFUNC float SmithPredictor_Update(SmithPredictor_t *sp, PIDController *pid, float setpoint,
+                                    float measurement, float applied)
+{
+    const ThermalModel_Zone_t *m = &sp->model;
+    float lag;
+
+    if (m->heat_capacity <= 0.0f) {
+        return PID_Update(pid, setpoint, measurement);
+    }
+
+    /* Advance the model over the period that just ended */
+    sp->undelayed += sp->T * (m->heater_power * applied * 0.01f - m->loss * sp->undelayed) /
+                     m->heat_capacity;
+    lag = (m->tc_tau > sp->T) ? sp->T / m->tc_tau : 1.0f;
+    sp->lagged += lag * (sp->undelayed - sp->lagged);
+
+    sp->head = (uint16_t)((sp->head + 1U) % (SMITH_PREDICTOR_MAX_DELAY + 1U));
+    sp->history[sp->head] = sp->lagged;
+    sp->delayed = sp->history[(sp->head + SMITH_PREDICTOR_MAX_DELAY + 1U - sp->delay) %
+                              (SMITH_PREDICTOR_MAX_DELAY + 1U)];
+
+    return PID_Update(pid, setpoint, measurement + sp->undelayed - sp->delayed);
+}
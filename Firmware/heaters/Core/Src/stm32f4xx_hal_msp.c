@@ -297,13 +297,15 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef* htim)
     __HAL_RCC_GPIOA_CLK_ENABLE();
     /**TIM2 GPIO Configuration
     PA0-WKUP     ------> TIM2_CH1
+    PA2     ------> TIM2_CH3
+    PA3     ------> TIM2_CH4
     */
-    GPIO_InitStruct.Pin = fire_Pin;
+    GPIO_InitStruct.Pin = fire_Pin|fire_1_Pin|fire_2_Pin;
     GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
     GPIO_InitStruct.Pull = GPIO_NOPULL;
     GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
     GPIO_InitStruct.Alternate = GPIO_AF1_TIM2;
-    HAL_GPIO_Init(fire_GPIO_Port, &GPIO_InitStruct);
+    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
     /* USER CODE BEGIN TIM2_MspPostInit 1 */
 
@@ -352,8 +354,10 @@ void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef* htim_base)
     /**TIM2 GPIO Configuration
     PA0-WKUP     ------> TIM2_CH1
     PA1     ------> TIM2_CH2
+    PA2     ------> TIM2_CH3
+    PA3     ------> TIM2_CH4
     */
-    HAL_GPIO_DeInit(GPIOA, fire_Pin|zero_crossig_Pin);
+    HAL_GPIO_DeInit(GPIOA, fire_Pin|zero_crossig_Pin|fire_1_Pin|fire_2_Pin);
 
     /* USER CODE BEGIN TIM2_MspDeInit 1 */
 
@@ -22,6 +22,9 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "profiling.h"
+#include "ramfunc.h"
+#include "zero_cross.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -57,6 +60,10 @@
 /* External variables --------------------------------------------------------*/
 extern TIM_HandleTypeDef htim3;
 /* USER CODE BEGIN EV */
+extern TIM_HandleTypeDef htim1;
+extern ZeroCross_t zeroCross;
+extern Profiling_Stopwatch_t zeroCrossEdgeTime;
+extern Profiling_Stopwatch_t zeroCrossDeadlineTime;
 
 /* USER CODE END EV */
 
@@ -213,5 +220,53 @@ void TIM3_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/* Zero-cross handlers, kept here because PA0/PA1 are TIM2 pins in the .ioc:
+ * their EXTI lines are configured by ZeroCross_Init(), not by CubeMX.
+ * They run from SRAM and clear their flags themselves instead of going through
+ * HAL_GPIO_EXTI_IRQHandler()/HAL_TIM_IRQHandler() and the callbacks, so
+ * nothing between the vector and the zero-cross code is fetched from flash. */
+
+/**
+  * @brief This function handles EXTI line0 interrupt (zone 0 gate edges).
+  */
+RAMFUNC void EXTI0_IRQHandler(void)
+{
+  EXTI->PR = fire_Pin;
+  ZeroCross_FireISR(&zeroCross);
+}
+
+/**
+  * @brief This function handles EXTI line1 interrupt (zero-cross detector edges).
+  */
+RAMFUNC void EXTI1_IRQHandler(void)
+{
+  EXTI->PR = zero_crossig_Pin;
+  Profiling_Start(&zeroCrossEdgeTime);
+  ZeroCross_EdgeISR(&zeroCross);
+  Profiling_Stop(&zeroCrossEdgeTime);
+}
+
+/**
+  * @brief This function handles TIM1 capture compare interrupt: flywheel
+  *        deadline (channel 1) and acceptance window (channel 2).
+  */
+RAMFUNC void TIM1_CC_IRQHandler(void)
+{
+  TIM_TypeDef *tim = htim1.Instance;
+  uint32_t flags = tim->SR & tim->DIER;
+
+  if (flags & TIM_SR_CC1IF)
+  {
+    tim->SR = ~TIM_SR_CC1IF;
+    Profiling_Start(&zeroCrossDeadlineTime);
+    ZeroCross_DeadlineISR(&zeroCross);
+    Profiling_Stop(&zeroCrossDeadlineTime);
+  }
+  if (flags & TIM_SR_CC2IF)
+  {
+    tim->SR = ~TIM_SR_CC2IF;
+    ZeroCross_WindowISR(&zeroCross);
+  }
+}
 
 /* USER CODE END 1 */
@@ -0,0 +1,174 @@
+/**
+ * @file      temp_estimator.c
+ * @author    Adrian Silva Palafox
+ * @brief     Zone temperature Kalman filter implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "temp_estimator.h"
+
+/**
+ * @brief State indices
+ */
+#define X_BARREL    0
+#define X_TC        1
+#define X_BIAS      2
+
+/**
+ * @brief Thermocouple lag step factor
+ *
+ * @param est Pointer to filter control structure
+ * @param dt  Step [s]
+ * @return float dt / tc_tau, 1 without lag
+ */
+static float estimator_lag(const TempEstimator_t *est, float dt)
+{
+    float tau = est->config.model.tc_tau;
+
+    return (tau > dt) ? dt / tau : 1.0f;
+}
+
+/**
+ * @brief Thermocouple heating rate at the current estimate
+ *
+ * @param est Pointer to filter control structure
+ * @return float Rate [°C/s]
+ */
+static float estimator_rate(const TempEstimator_t *est)
+{
+    const ThermalModel_Zone_t *m = &est->config.model;
+
+    if (m->tc_tau > 0.0f) {
+        return (est->x[X_BARREL] - est->x[X_TC]) / m->tc_tau;
+    }
+    return (m->heater_power * est->power * 0.01f -
+            m->loss * (est->x[X_BARREL] - est->config.ambient)) / m->heat_capacity +
+           est->x[X_BIAS];
+}
+
+/**
+ * @brief Initialize the filter, the first reading sets the temperatures
+ *
+ * @param est    Pointer to filter control structure
+ * @param config Filter parameters
+ */
+void TempEstimator_Init(TempEstimator_t *est, const TempEstimator_Config_t *config)
+{
+    est->config = *config;
+    est->x[X_BARREL] = config->ambient;
+    est->x[X_TC] = config->ambient;
+    est->x[X_BIAS] = 0.0f;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            est->p[i][j] = 0.0f;
+        }
+    }
+    est->p[X_BARREL][X_BARREL] = config->r;
+    est->p[X_TC][X_TC] = config->r;
+    est->temp = config->ambient;
+    est->rate = 0.0f;
+    est->power = 0.0f;
+    est->innovation = 0.0f;
+    est->primed = 0;
+}
+
+/**
+ * @brief Replace the zone model
+ *
+ * @param est     Pointer to filter control structure
+ * @param model   Zone parameters
+ * @param ambient Ambient temperature [°C]
+ */
+void TempEstimator_SetModel(TempEstimator_t *est, const ThermalModel_Zone_t *model, float ambient)
+{
+    est->config.model = *model;
+    est->config.ambient = ambient;
+}
+
+/**
+ * @brief Advance the estimate
+ *
+ * @param est   Pointer to filter control structure
+ * @param power Heater power applied over the step [%]
+ * @param dt    Step [s]
+ */
+void TempEstimator_Predict(TempEstimator_t *est, float power, float dt)
+{
+    const ThermalModel_Zone_t *m = &est->config.model;
+    float lag = estimator_lag(est, dt);
+    float f[3][3] = {
+        { 1.0f - dt * m->loss / m->heat_capacity, 0.0f, dt },
+        { lag, 1.0f - lag, 0.0f },
+        { 0.0f, 0.0f, 1.0f },
+    };
+    float fp[3][3];
+    float barrel = est->x[X_BARREL];
+
+    est->power = power;
+    est->x[X_BARREL] += dt * ((m->heater_power * power * 0.01f -
+                               m->loss * (barrel - est->config.ambient)) / m->heat_capacity +
+                              est->x[X_BIAS]);
+    est->x[X_TC] += lag * (barrel - est->x[X_TC]);
+
+    /* P = F P F' + Q dt */
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            fp[i][j] = f[i][0] * est->p[0][j] + f[i][1] * est->p[1][j] + f[i][2] * est->p[2][j];
+        }
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = i; j < 3; j++) {
+            float p = fp[i][0] * f[j][0] + fp[i][1] * f[j][1] + fp[i][2] * f[j][2];
+            est->p[i][j] = p;
+            est->p[j][i] = p;
+        }
+    }
+    est->p[X_BARREL][X_BARREL] += est->config.q_temp * dt;
+    est->p[X_BIAS][X_BIAS] += est->config.q_rate * dt;
+
+    est->temp = est->x[X_TC];
+    est->rate = estimator_rate(est);
+}
+
+/**
+ * @brief Fuse a fresh reading
+ *
+ * @param est         Pointer to filter control structure
+ * @param measurement Thermocouple reading [°C]
+ */
+void TempEstimator_Correct(TempEstimator_t *est, float measurement)
+{
+    float k[3];
+    float row[3];
+    float s;
+
+    if (!est->primed) {
+        est->x[X_BARREL] = measurement;
+        est->x[X_TC] = measurement;
+        est->temp = measurement;
+        est->primed = 1;
+        return;
+    }
+
+    /* H = [0, 1, 0] */
+    est->innovation = measurement - est->x[X_TC];
+    s = est->p[X_TC][X_TC] + est->config.r;
+    for (uint8_t i = 0; i < 3; i++) {
+        row[i] = est->p[X_TC][i];
+        k[i] = row[i] / s;
+        est->x[i] += k[i] * est->innovation;
+    }
+
+    /* P = (I - K H) P */
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = i; j < 3; j++) {
+            float p = est->p[i][j] - k[i] * row[j];
+            est->p[i][j] = p;
+            est->p[j][i] = p;
+        }
+    }
+
+    est->temp = est->x[X_TC];
+    est->rate = estimator_rate(est);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file      thermal_model.c
+ * @author    Adrian Silva Palafox
+ * @brief     Lumped-parameter barrel thermal model implementation
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Explicit Euler integration with bounded sub-steps. The reading
+ *            dead time is a ring of thermocouple temperatures, one entry per
+ *            THERMAL_MODEL_DELAY_STEP, read back with linear interpolation.
+ */
+
+#include "thermal_model.h"
+
+/**
+ * @brief Set every temperature to ambient and clear the disturbances
+ *
+ * @param model   Pointer to model structure
+ * @param ambient Ambient temperature [°C]
+ */
+void ThermalModel_Init(ThermalModel_t *model, float ambient)
+{
+    model->ambient = ambient;
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model->temp[z] = ambient;
+        model->tc_temp[z] = ambient;
+        model->disturbance[z] = 0.0f;
+    }
+    for (uint32_t i = 0; i < THERMAL_MODEL_DELAY_LEN; i++) {
+        for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+            model->history[i][z] = ambient;
+        }
+    }
+    model->head = 0;
+    model->since = 0.0f;
+}
+
+/**
+ * @brief Advance the model
+ *
+ * @param model   Pointer to model structure
+ * @param command Heater commands [%]
+ * @param dt      Time step [s]
+ */
+void ThermalModel_Step(ThermalModel_t *model, const float *command, float dt)
+{
+    double flow[THERMAL_MODEL_ZONES];
+    float h;
+    float u;
+
+    while (dt > 0.0f) {
+        h = (dt > THERMAL_MODEL_MAX_STEP) ? THERMAL_MODEL_MAX_STEP : dt;
+        dt -= h;
+
+        /* Heater input, ambient loss and external heat */
+        for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+            u = command[z];
+            u = (u < 0.0f) ? 0.0f : ((u > 100.0f) ? 100.0f : u);
+            flow[z] = model->zone[z].heater_power * u * 0.01f -
+                      model->zone[z].loss * (model->temp[z] - model->ambient) +
+                      model->disturbance[z];
+        }
+
+        /* Conduction between neighbouring zones */
+        for (uint8_t z = 0; z < THERMAL_MODEL_ZONES - 1; z++) {
+            double q = model->coupling[z] * (model->temp[z] - model->temp[z + 1]);
+            flow[z] -= q;
+            flow[z + 1] += q;
+        }
+
+        for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+            model->temp[z] += h * flow[z] / model->zone[z].heat_capacity;
+            if (model->zone[z].tc_tau > 0.0f) {
+                model->tc_temp[z] += h * (model->temp[z] - model->tc_temp[z]) / model->zone[z].tc_tau;
+            } else {
+                model->tc_temp[z] = model->temp[z];
+            }
+        }
+
+        /* Reading dead time history */
+        model->since += h;
+        if (model->since >= THERMAL_MODEL_DELAY_STEP) {
+            model->since -= THERMAL_MODEL_DELAY_STEP;
+            model->head = (model->head + 1U) % THERMAL_MODEL_DELAY_LEN;
+            for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+                model->history[model->head][z] = (float)model->tc_temp[z];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Thermocouple temperature as the MAX6675 would report it
+ *
+ * @param model Pointer to model structure
+ * @param zone  Zone index
+ * @return float Quantized temperature [°C]
+ */
+float ThermalModel_ReadSensor(const ThermalModel_t *model, uint8_t zone)
+{
+    float t = (float)model->tc_temp[zone];
+    float dead = model->dead_time[zone];
+
+    /* Between the two entries around now - dead_time; the newest entry is
+     * model->since old */
+    if (dead > 0.0f) {
+        float age = (float)((dead - model->since) / THERMAL_MODEL_DELAY_STEP);
+        uint32_t back;
+        float frac;
+        float newer;
+        float older;
+
+        if (age < 0.0f) {
+            /* Within the last step: between the newest entry and now */
+            frac = (float)(dead / model->since);
+            older = model->history[model->head][zone];
+            t = t + frac * (older - t);
+        } else {
+            if (age > (float)(THERMAL_MODEL_DELAY_LEN - 2U)) {
+                age = (float)(THERMAL_MODEL_DELAY_LEN - 2U);
+            }
+            back = (uint32_t)age;
+            frac = age - (float)back;
+            newer = model->history[(model->head + THERMAL_MODEL_DELAY_LEN - back) %
+                                   THERMAL_MODEL_DELAY_LEN][zone];
+            older = model->history[(model->head + THERMAL_MODEL_DELAY_LEN - back - 1U) %
+                                   THERMAL_MODEL_DELAY_LEN][zone];
+            t = newer + frac * (older - newer);
+        }
+    }
+
+    /* The converter truncates to whole counts and cannot report below 0 °C */
+    if (t < 0.0f) {
+        return 0.0f;
+    }
+    return (float)(uint32_t)(t / THERMAL_MODEL_QUANTUM) * THERMAL_MODEL_QUANTUM;
+}
+
+/**
+ * @brief Open-loop time constant of one zone, ignoring coupling
+ *
+ * @param model Pointer to model structure
+ * @param zone  Zone index
+ * @return float Time constant [s]
+ */
+float ThermalModel_TimeConstant(const ThermalModel_t *model, uint8_t zone)
+{
+    return model->zone[zone].heat_capacity / model->zone[zone].loss;
+}
+
+/**
+ * @brief Steady-state rise per percent of command, ignoring coupling
+ *
+ * @param model Pointer to model structure
+ * @param zone  Zone index
+ * @return float Gain [°C / %]
+ */
+float ThermalModel_Gain(const ThermalModel_t *model, uint8_t zone)
+{
+    return model->zone[zone].heater_power * 0.01f / model->zone[zone].loss;
+}
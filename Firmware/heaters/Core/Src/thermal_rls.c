@@ -0,0 +1,206 @@
+/**
+ * @file      thermal_rls.c
+ * @author    Adrian Silva Palafox
+ * @brief     Online zone model identification implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "thermal_rls.h"
+#include <math.h>
+
+/**
+ * @brief Scale of temperatures and powers inside the estimator
+ */
+#define RLS_SCALE   0.01f
+
+/**
+ * @brief Recompute the live model from the parameter vector
+ *
+ * @param rls Pointer to estimator control structure
+ */
+static void rls_publish(ThermalRLS_t *rls)
+{
+    float a = rls->theta[0];
+    float b = rls->theta[1];
+    float ts = rls->config.dt * rls->config.decimation;
+
+    if (a <= 0.0f || a >= 1.0f || b <= 0.0f) {
+        rls->valid = 0;
+        return;
+    }
+
+    rls->tau = -ts / logf(a);
+    rls->gain = b / (1.0f - a);
+    rls->ambient = rls->theta[2] / (RLS_SCALE * (1.0f - a));
+    rls->valid = (rls->updates >= THERMAL_RLS_MIN_UPDATES);
+}
+
+/**
+ * @brief Initialize the estimator from its prior model
+ *
+ * @param rls    Pointer to estimator control structure
+ * @param config Estimator parameters
+ */
+void ThermalRLS_Init(ThermalRLS_t *rls, const ThermalRLS_Config_t *config)
+{
+    rls->config = *config;
+    if (rls->config.delay > THERMAL_RLS_MAX_DELAY) {
+        rls->config.delay = THERMAL_RLS_MAX_DELAY;
+    }
+    if (rls->config.decimation == 0) {
+        rls->config.decimation = 1;
+    }
+    ThermalRLS_Reset(rls);
+}
+
+/**
+ * @brief Restart from the prior model
+ *
+ * @param rls Pointer to estimator control structure
+ */
+void ThermalRLS_Reset(ThermalRLS_t *rls)
+{
+    const ThermalRLS_Config_t *c = &rls->config;
+    const ThermalModel_Zone_t *z = &c->prior;
+    float ts = c->dt * c->decimation;
+    float a = expf(-ts * z->loss / z->heat_capacity);
+
+    /* Prior: a = exp(-Ts h / C), K = P / (100 h) */
+    rls->theta[0] = a;
+    rls->theta[1] = (1.0f - a) * z->heater_power / (100.0f * z->loss);
+    rls->theta[2] = (1.0f - a) * c->ambient * RLS_SCALE;
+
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = 0; j < 3; j++) {
+            rls->p[i][j] = (i == j) ? c->p0 : 0.0f;
+        }
+    }
+    for (uint8_t i = 0; i <= THERMAL_RLS_MAX_DELAY; i++) {
+        rls->u_hist[i] = 0.0f;
+    }
+    rls->head = 0;
+    rls->filled = 0;
+    rls->y_prev = 0.0f;
+    rls->u_sum = 0.0f;
+    rls->y_sum = 0.0f;
+    rls->count = 0;
+    rls->updates = 0;
+    rls->residual = 0.0f;
+    rls_publish(rls);
+}
+
+/**
+ * @brief Feed one control tick of data
+ *
+ * @param rls   Pointer to estimator control structure
+ * @param power Heater power applied since the previous call [%]
+ * @param temp  Zone temperature [°C]
+ * @return uint8_t 1 when an RLS step ran on this call
+ */
+uint8_t ThermalRLS_Update(ThermalRLS_t *rls, float power, float temp)
+{
+    const ThermalRLS_Config_t *c = &rls->config;
+    float phi[3], pphi[3], k[3];
+    float y, u, den, err, trace;
+
+    rls->u_sum += power;
+    rls->y_sum += temp;
+    if (++rls->count < c->decimation) {
+        return 0;
+    }
+    y = rls->y_sum * RLS_SCALE / c->decimation;
+    u = rls->u_sum * RLS_SCALE / c->decimation;
+    rls->u_sum = 0.0f;
+    rls->y_sum = 0.0f;
+    rls->count = 0;
+
+    /* The input that acts on y[k] is d + 1 steps old: wait for it */
+    if (rls->filled <= c->delay) {
+        rls->filled++;
+        rls->head = (uint8_t)((rls->head + 1U) % (THERMAL_RLS_MAX_DELAY + 1U));
+        rls->u_hist[rls->head] = u;
+        rls->y_prev = y;
+        return 0;
+    }
+
+    /* Nothing moving: skip, forgetting would only erode the estimate */
+    if (fabsf(y - rls->y_prev) < c->min_dy * RLS_SCALE &&
+        fabsf(u - rls->u_hist[rls->head]) < c->min_du * RLS_SCALE) {
+        rls->head = (uint8_t)((rls->head + 1U) % (THERMAL_RLS_MAX_DELAY + 1U));
+        rls->u_hist[rls->head] = u;
+        rls->y_prev = y;
+        return 0;
+    }
+
+    phi[0] = rls->y_prev;
+    phi[1] = rls->u_hist[(rls->head + THERMAL_RLS_MAX_DELAY + 1U - c->delay) % (THERMAL_RLS_MAX_DELAY + 1U)];
+    phi[2] = 1.0f;
+
+    /* Gain k = P phi / (lambda + phi' P phi) */
+    den = c->lambda;
+    for (uint8_t i = 0; i < 3; i++) {
+        pphi[i] = rls->p[i][0] * phi[0] + rls->p[i][1] * phi[1] + rls->p[i][2] * phi[2];
+        den += phi[i] * pphi[i];
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+        k[i] = pphi[i] / den;
+    }
+
+    err = y - (rls->theta[0] * phi[0] + rls->theta[1] * phi[1] + rls->theta[2] * phi[2]);
+    for (uint8_t i = 0; i < 3; i++) {
+        rls->theta[i] += k[i] * err;
+    }
+
+    /* P = (P - k phi' P) / lambda, kept symmetric, trace capped */
+    trace = 0.0f;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = i; j < 3; j++) {
+            float p = (rls->p[i][j] - k[i] * pphi[j]) / c->lambda;
+            rls->p[i][j] = p;
+            rls->p[j][i] = p;
+        }
+        trace += rls->p[i][i];
+    }
+    if (trace > c->p_max) {
+        float scale = c->p_max / trace;
+        for (uint8_t i = 0; i < 3; i++) {
+            for (uint8_t j = 0; j < 3; j++) {
+                rls->p[i][j] *= scale;
+            }
+        }
+    }
+
+    rls->head = (uint8_t)((rls->head + 1U) % (THERMAL_RLS_MAX_DELAY + 1U));
+    rls->u_hist[rls->head] = u;
+    rls->y_prev = y;
+    rls->residual = err / RLS_SCALE;
+    rls->updates++;
+    rls_publish(rls);
+
+    return 1;
+}
+
+/**
+ * @brief Live estimate as physical zone parameters
+ *
+ * @param rls  Pointer to estimator control structure
+ * @param zone Filled with C, h and the known P and thermocouple lag
+ * @return uint8_t 1 if the estimate is valid
+ */
+uint8_t ThermalRLS_GetZone(const ThermalRLS_t *rls, ThermalModel_Zone_t *zone)
+{
+    float h;
+
+    if (!rls->valid) {
+        return 0;
+    }
+
+    h = rls->config.prior.heater_power / (100.0f * rls->gain);
+    zone->heat_capacity = h * rls->tau;
+    zone->loss = h;
+    zone->heater_power = rls->config.prior.heater_power;
+    zone->tc_tau = rls->config.prior.tc_tau;
+
+    return 1;
+}
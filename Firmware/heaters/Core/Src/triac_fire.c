@@ -0,0 +1,189 @@
+/**
+ * @file      triac_fire.c
+ * @author    Adrian Silva Palafox
+ * @brief     Phase-angle TRIAC firing implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "triac_fire.h"
+#include "ramfunc.h"
+#include <math.h>
+#include <stddef.h>
+
+#define PI_F    3.14159265f
+
+static const uint32_t fire_channels[TRIAC_FIRE_ZONES] = {
+    TIM_CHANNEL_1, TIM_CHANNEL_3, TIM_CHANNEL_4
+};
+
+/**
+ * @brief Fill the power-to-delay table
+ *
+ * @details The energy delivered by a resistive load fired at angle a of the
+ *          half-cycle is P(a) = 1 - a/pi + sin(2a)/(2pi). P is monotonic, so
+ *          each percent is inverted by bisection.
+ */
+static void fire_build_table(TriacFire_t *fire)
+{
+    fire->delay[0] = 0;
+    for (uint8_t percent = 1; percent <= 100; percent++) {
+        float target = percent * 0.01f;
+        float lo = 0.0f;
+        float hi = PI_F;
+        uint32_t us;
+
+        for (uint8_t i = 0; i < 24; i++) {
+            float a = 0.5f * (lo + hi);
+            float p = 1.0f - a / PI_F + sinf(2.0f * a) / (2.0f * PI_F);
+            if (p > target) {
+                lo = a;
+            } else {
+                hi = a;
+            }
+        }
+
+        us = (uint32_t)(0.5f * (lo + hi) / PI_F * TRIAC_FIRE_HALF_CYCLE_US);
+        if (us < TRIAC_FIRE_MIN_DELAY_US) {
+            us = TRIAC_FIRE_MIN_DELAY_US;
+        } else if (us > TRIAC_FIRE_MAX_DELAY_US) {
+            us = TRIAC_FIRE_MAX_DELAY_US;
+        }
+        fire->delay[percent] = (uint16_t)us;
+    }
+}
+
+/**
+ * @brief Configure the output channels, build the delay table and arm
+ *
+ * @param fire Pointer to firing control structure
+ * @param htim Timer handle
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef TriacFire_Init(TriacFire_t *fire, TIM_HandleTypeDef *htim)
+{
+    TIM_OC_InitTypeDef oc = {0};
+
+    /* Validate input parameters */
+    if (fire == NULL || htim == NULL) {
+        return HAL_ERROR;
+    }
+
+    fire->htim = htim;
+    fire->armed = 0;
+    fire->off = __HAL_TIM_GET_AUTORELOAD(htim) + 1U;
+    fire->compensation = 0;
+    fire_build_table(fire);
+
+    /* Gate active from CCRx to the end of the period, CCRx > ARR never fires */
+    oc.OCMode = TIM_OCMODE_PWM2;
+    oc.Pulse = fire->off;
+    oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+    oc.OCFastMode = TIM_OCFAST_DISABLE;
+    for (uint8_t zone = 0; zone < TRIAC_FIRE_ZONES; zone++) {
+        if (HAL_TIM_PWM_ConfigChannel(htim, &oc, fire_channels[zone]) != HAL_OK ||
+            HAL_TIM_PWM_Start(htim, fire_channels[zone]) != HAL_OK) {
+            TriacFire_Kill(fire);
+            return HAL_ERROR;
+        }
+    }
+
+    fire->ccmr1 = htim->Instance->CCMR1;
+    fire->ccmr2 = htim->Instance->CCMR2;
+    fire->smcr = htim->Instance->SMCR;
+    fire->armed = 1;
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Set the power of one zone from the next half-cycle on
+ *
+ * @param fire    Pointer to firing control structure
+ * @param zone    Zone index
+ * @param percent Power [%]
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+RAMFUNC HAL_StatusTypeDef TriacFire_SetPower(TriacFire_t *fire, uint8_t zone, float percent)
+{
+    uint32_t compare;
+
+    /* Validate input parameters */
+    if (fire == NULL || zone >= TRIAC_FIRE_ZONES || !fire->armed) {
+        return HAL_ERROR;
+    }
+
+    if (percent < 0.5f) {
+        compare = fire->off;
+    } else {
+        int32_t delay = (percent >= 100.0f) ? fire->delay[100]
+                                            : fire->delay[(uint8_t)(percent + 0.5f)];
+        /* Delay from the timer start, still inside the timer period */
+        delay -= fire->compensation;
+        if (delay < 1) {
+            delay = 1;
+        } else if (delay > (int32_t)fire->off - 1) {
+            delay = (int32_t)fire->off - 1;
+        }
+        compare = (uint32_t)delay;
+    }
+
+    __HAL_TIM_SET_COMPARE(fire->htim, fire_channels[zone], compare);
+    return HAL_OK;
+}
+
+/**
+ * @brief Set the timer start offset subtracted from every firing delay
+ *
+ * @details Takes effect on the next TriacFire_SetPower() of each zone.
+ *
+ * @param fire      Pointer to firing control structure
+ * @param offset_us Timer start after the true zero crossing [us]
+ */
+void TriacFire_SetCompensation(TriacFire_t *fire, float offset_us)
+{
+    fire->compensation = (int32_t)(offset_us + (offset_us < 0.0f ? -0.5f : 0.5f));
+}
+
+/**
+ * @brief Stop firing every zone immediately
+ *
+ * @details Forcing the output compare mode to inactive acts on the output at
+ *          once, without waiting for a compare or update event. The channel 2
+ *          bits of CCMR1 hold the zero-cross input and are left untouched.
+ *
+ * @param fire Pointer to firing control structure
+ */
+void TriacFire_Kill(TriacFire_t *fire)
+{
+    TIM_TypeDef *tim = fire->htim->Instance;
+
+    /* First, so the zero-cross window interrupt no longer re-enables the trigger */
+    fire->armed = 0;
+    tim->CCMR1 = (tim->CCMR1 & ~TIM_CCMR1_OC1M) | TIM_CCMR1_OC1M_2;
+    tim->CCMR2 = (tim->CCMR2 & ~(TIM_CCMR2_OC3M | TIM_CCMR2_OC4M)) |
+                 TIM_CCMR2_OC3M_2 | TIM_CCMR2_OC4M_2;
+    tim->SMCR &= ~TIM_SMCR_SMS;
+    tim->CR1 &= ~TIM_CR1_CEN;
+}
+
+/**
+ * @brief Re-enable firing after TriacFire_Kill(), every zone off
+ *
+ * @param fire Pointer to firing control structure
+ */
+void TriacFire_Arm(TriacFire_t *fire)
+{
+    TIM_TypeDef *tim = fire->htim->Instance;
+
+    /* Load "off" into the active compare registers before restoring the modes */
+    tim->CCR1 = fire->off;
+    tim->CCR3 = fire->off;
+    tim->CCR4 = fire->off;
+    tim->EGR = TIM_EGR_UG;
+
+    tim->CCMR1 = fire->ccmr1;
+    tim->CCMR2 = fire->ccmr2;
+    tim->SMCR = fire->smcr;
+    fire->armed = 1;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file      warmup_planner.c
+ * @author    Adrian Silva Palafox
+ * @brief     Staggered warm-up implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "warmup_planner.h"
+
+/**
+ * @brief Shortest common ramp duration every zone and the budget can follow
+ *
+ * @param planner Pointer to planner control structure (targets and start set)
+ * @return float  Ramp duration [s], 0 when nothing has to rise or the targets
+ *                cannot be held with the power available
+ */
+static float planner_duration(const WarmupPlanner_t *planner)
+{
+    const WarmupPlanner_Config_t *c = &planner->config;
+    float duration = 0.0f;
+    float energy = 0.0f;
+    float hold = 0.0f;
+    float available;
+
+    for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+        const ThermalModel_Zone_t *z = &c->zone[zone];
+        float rise = planner->target[zone] - planner->start[zone];
+        float holding;
+
+        if (rise <= 0.0f) {
+            continue;
+        }
+
+        /* Mean loss over the ramp: the zone trails the ramp a little at the
+           top, where the loss is highest, and catches up in the band */
+        holding = z->loss * (0.5f * (planner->start[zone] + planner->target[zone]) - c->ambient);
+        available = c->headroom * z->heater_power - holding;
+        if (available <= 0.0f) {
+            return 0.0f;
+        }
+        if (z->heat_capacity * rise / available > duration) {
+            duration = z->heat_capacity * rise / available;
+        }
+        if (c->ramp_limit > 0.0f && rise / c->ramp_limit > duration) {
+            duration = rise / c->ramp_limit;
+        }
+        energy += z->heat_capacity * rise;
+        hold += holding;
+    }
+
+    if (energy > 0.0f) {
+        available = c->headroom * c->budget - hold;
+        if (available <= 0.0f) {
+            return 0.0f;
+        }
+        if (energy / available > duration) {
+            duration = energy / available;
+        }
+    }
+
+    return duration;
+}
+
+/**
+ * @brief Initialize the planner with no plan running
+ *
+ * @param planner Pointer to planner control structure
+ * @param config  Planner parameters
+ */
+void WarmupPlanner_Init(WarmupPlanner_t *planner, const WarmupPlanner_Config_t *config)
+{
+    planner->config = *config;
+    for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+        planner->target[zone] = 0.0f;
+        planner->start[zone] = 0.0f;
+    }
+    planner->elapsed = 0.0f;
+    planner->expected = 0.0f;
+    planner->actual = -1.0f;
+    planner->active = 0;
+}
+
+/**
+ * @brief Plan the ramps from the current temperatures
+ *
+ * @param planner Pointer to planner control structure
+ * @param targets Final setpoints [°C]
+ * @param temps   Zone temperatures [°C]
+ */
+void WarmupPlanner_Start(WarmupPlanner_t *planner, const float *targets, const float *temps)
+{
+    for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+        planner->target[zone] = targets[zone];
+        planner->start[zone] = temps[zone];
+    }
+    planner->elapsed = 0.0f;
+    planner->expected = planner_duration(planner);
+    planner->actual = -1.0f;
+    planner->active = 1;
+}
+
+/**
+ * @brief Advance the plan and produce the controller setpoints
+ *
+ * @param planner   Pointer to planner control structure
+ * @param targets   Final setpoints [°C]
+ * @param temps     Zone temperatures [°C]
+ * @param dt        Time since the previous step [s]
+ * @param setpoints Setpoints for the controllers [°C]
+ */
+void WarmupPlanner_Step(WarmupPlanner_t *planner, const float *targets, const float *temps,
+                        float dt, float *setpoints)
+{
+    uint8_t ready = 1;
+    float progress;
+
+    if (!planner->active) {
+        for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+            setpoints[zone] = targets[zone];
+        }
+        return;
+    }
+
+    /* New targets (material change) are planned from where the zones are now */
+    for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+        if (targets[zone] != planner->target[zone]) {
+            WarmupPlanner_Start(planner, targets, temps);
+            break;
+        }
+    }
+
+    planner->elapsed += dt;
+    progress = (planner->elapsed < planner->expected) ? planner->elapsed / planner->expected : 1.0f;
+
+    for (uint8_t zone = 0; zone < WARMUP_PLANNER_ZONES; zone++) {
+        float rise = targets[zone] - planner->start[zone];
+        float error = targets[zone] - temps[zone];
+
+        setpoints[zone] = (rise > 0.0f) ? planner->start[zone] + rise * progress : targets[zone];
+        if (error > planner->config.band || error < -planner->config.band) {
+            ready = 0;
+        }
+    }
+
+    /* Ready once every zone is in band, the ramps keep running until then */
+    if (ready && planner->actual < 0.0f) {
+        planner->actual = planner->elapsed;
+    }
+    if (planner->actual >= 0.0f && progress >= 1.0f) {
+        planner->active = 0;
+    }
+}
+
+/**
+ * @brief Drop the running plan
+ *
+ * @param planner Pointer to planner control structure
+ */
+void WarmupPlanner_Stop(WarmupPlanner_t *planner)
+{
+    planner->active = 0;
+}
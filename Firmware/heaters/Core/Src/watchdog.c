@@ -0,0 +1,208 @@
+/**
+ * @file      watchdog.c
+ * @author    Adrian Silva Palafox
+ * @brief     Independent watchdog with per-task liveness tracking implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "watchdog.h"
+#include <stddef.h>
+
+/* IWDG key register values */
+#define IWDG_KEY_RELOAD     0xAAAAU
+#define IWDG_KEY_ACCESS     0x5555U
+#define IWDG_KEY_START      0xCCCCU
+
+/* LSI / 64: one reload count every 2 ms */
+#define IWDG_PRESCALER_64   0x4U
+#define IWDG_MS_PER_COUNT   2U
+
+/* Survives the watchdog reset, not cleared by the startup code */
+static Watchdog_Record_t watchdog_record __attribute__((section(".noinit")));
+/* Copy of the record of the previous run, the live one is overwritten */
+static Watchdog_Record_t watchdog_failure;
+static uint8_t watchdog_reset;
+
+/* Private functions --------------------------------------------------------*/
+/**
+ * @brief Name the overdue task of a run that hung before Watchdog_Service()
+ *
+ * @details The loop stopped after the last recorded check-in: the registered
+ *          task waiting the longest at that point is the one that hung.
+ */
+static void watchdog_find_stall(Watchdog_Record_t *record)
+{
+    uint32_t worst = 0;
+
+    record->overdue = 0;
+    for (uint8_t task = 0; task < WATCHDOG_TASKS; task++) {
+        uint32_t waited = record->tick - record->last[task];
+        if ((record->registered & (1U << task)) && (record->task == WATCHDOG_TASKS || waited > worst)) {
+            record->task = task;
+            record->overdue = waited;
+            worst = waited;
+        }
+    }
+}
+
+/**
+ * @brief Read the previous reset cause and start the IWDG
+ *
+ * @param wd Pointer to watchdog control structure
+ */
+void Watchdog_Init(Watchdog_t *wd)
+{
+    uint32_t csr = RCC->CSR;
+
+    /* RAM contents are random after a power-up */
+    if (csr & (RCC_CSR_PORRSTF | RCC_CSR_BORRSTF)) {
+        watchdog_record.magic = 0;
+        watchdog_record.resets = 0;
+    }
+
+    watchdog_reset = (csr & RCC_CSR_IWDGRSTF) && (watchdog_record.magic == WATCHDOG_RECORD_MAGIC);
+    if (watchdog_reset) {
+        watchdog_record.resets++;
+        watchdog_failure = watchdog_record;
+        if (watchdog_failure.task >= WATCHDOG_TASKS) {
+            watchdog_find_stall(&watchdog_failure);
+        }
+    }
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    /* Live record of this run */
+    watchdog_record.magic = WATCHDOG_RECORD_MAGIC;
+    watchdog_record.task = WATCHDOG_TASKS;
+    watchdog_record.overdue = 0;
+    watchdog_record.tick = HAL_GetTick();
+    watchdog_record.last_task = WATCHDOG_TASKS;
+    watchdog_record.registered = 0;
+    for (uint8_t task = 0; task < WATCHDOG_TASKS; task++) {
+        wd->deadline[task] = 0;
+        wd->last[task] = 0;
+        watchdog_record.last[task] = 0;
+    }
+    wd->registered = 0;
+    wd->stalled = 0;
+
+    /* Keep the watchdog quiet while the core is halted by the debugger */
+    DBGMCU->APB1FZ |= DBGMCU_APB1_FZ_DBG_IWDG_STOP;
+
+    IWDG->KR = IWDG_KEY_START;
+    IWDG->KR = IWDG_KEY_ACCESS;
+    IWDG->PR = IWDG_PRESCALER_64;
+    IWDG->RLR = WATCHDOG_TIMEOUT_MS / IWDG_MS_PER_COUNT - 1U;
+    while (IWDG->SR != 0) {
+    }
+    IWDG->KR = IWDG_KEY_RELOAD;
+}
+
+/**
+ * @brief Supervise a task
+ *
+ * @param wd          Pointer to watchdog control structure
+ * @param task        Watchdog_Task_t
+ * @param deadline_ms Longest time allowed between check-ins [ms]
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef Watchdog_Register(Watchdog_t *wd, uint8_t task, uint32_t deadline_ms)
+{
+    /* Validate input parameters */
+    if (wd == NULL || task >= WATCHDOG_TASKS || deadline_ms == 0) {
+        return HAL_ERROR;
+    }
+
+    wd->deadline[task] = deadline_ms;
+    wd->last[task] = HAL_GetTick();
+    wd->registered |= 1U << task;
+    watchdog_record.last[task] = wd->last[task];
+    watchdog_record.registered = wd->registered;
+    return HAL_OK;
+}
+
+/**
+ * @brief Report that a task has run
+ *
+ * @details The .noinit record follows every check-in, a hang anywhere in the
+ *          loop leaves it pointing at the tasks that stopped checking in.
+ *
+ * @param wd   Pointer to watchdog control structure
+ * @param task Watchdog_Task_t
+ */
+void Watchdog_CheckIn(Watchdog_t *wd, uint8_t task)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (task < WATCHDOG_TASKS) {
+        wd->last[task] = now;
+        if (!wd->stalled) {
+            watchdog_record.last[task] = now;
+            watchdog_record.last_task = task;
+            watchdog_record.tick = now;
+        }
+    }
+}
+
+/**
+ * @brief Reload the IWDG if every registered task is alive
+ *
+ * @details Once a task has been found overdue the kicks stay withheld, even if
+ *          it comes back, so the stall always ends in a reset.
+ *
+ * @param wd Pointer to watchdog control structure
+ * @return HAL_StatusTypeDef HAL_OK if reloaded, HAL_TIMEOUT otherwise
+ */
+HAL_StatusTypeDef Watchdog_Service(Watchdog_t *wd)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (wd->stalled) {
+        return HAL_TIMEOUT;
+    }
+
+    for (uint8_t task = 0; task < WATCHDOG_TASKS; task++) {
+        uint32_t elapsed = now - wd->last[task];
+        if ((wd->registered & (1U << task)) && elapsed > wd->deadline[task]) {
+            watchdog_record.task = task;
+            watchdog_record.overdue = elapsed;
+            watchdog_record.tick = now;
+            wd->stalled = 1;
+            return HAL_TIMEOUT;
+        }
+    }
+
+    IWDG->KR = IWDG_KEY_RELOAD;
+    return HAL_OK;
+}
+
+/**
+ * @brief Restart every deadline after a deliberate stall
+ *
+ * @param wd Pointer to watchdog control structure
+ */
+void Watchdog_Restart(Watchdog_t *wd)
+{
+    uint32_t now = HAL_GetTick();
+
+    if (wd->stalled) {
+        return;
+    }
+
+    for (uint8_t task = 0; task < WATCHDOG_TASKS; task++) {
+        wd->last[task] = now;
+        watchdog_record.last[task] = now;
+    }
+    watchdog_record.tick = now;
+    IWDG->KR = IWDG_KEY_RELOAD;
+}
+
+/**
+ * @brief Failure that caused the last reset
+ *
+ * @return const Watchdog_Record_t* Record, NULL if not a watchdog reset
+ */
+const Watchdog_Record_t *Watchdog_LastFailure(void)
+{
+    return watchdog_reset ? &watchdog_failure : NULL;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file      zero_cross.c
+ * @author    Adrian Silva Palafox
+ * @brief     Zero-cross detector timing implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "zero_cross.h"
+#include "ramfunc.h"
+#include <stddef.h>
+
+/**
+ * @brief Delay added by the TI2 input filter [us]
+ *
+ * @details The filter passes an edge after N consecutive equal samples taken
+ *          at fSAMPLING (reference manual, TIMx_CCMR1 ICxF).
+ */
+static float zc_filter_delay(const TIM_TypeDef *tim, uint32_t clock)
+{
+    static const uint8_t divider[16] = { 1, 1, 1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 16, 32, 32, 32 };
+    static const uint8_t samples[16] = { 0, 2, 4, 8, 6, 8, 6, 8, 6, 8, 5, 6, 8, 5, 6, 8 };
+    uint32_t icf = (tim->CCMR1 & TIM_CCMR1_IC2F) >> TIM_CCMR1_IC2F_Pos;
+    uint32_t period = divider[icf];
+
+    /* ICF 1..3 sample at the timer clock, the others at fDTS / divider */
+    if (icf >= 4) {
+        period <<= (tim->CR1 & TIM_CR1_CKD) >> TIM_CR1_CKD_Pos;
+    }
+    return samples[icf] * period * 1e6f / (float)clock;
+}
+
+/**
+ * @brief Track the half-cycle period from an accepted edge
+ *
+ * @details Intervals away from the period (a missing edge in between, or the
+ *          first edge after a while) do not update it.
+ */
+RAMFUNC static void zc_track(ZeroCross_t *zc, uint32_t interval)
+{
+    uint32_t period = zc->period ? zc->period : TRIAC_FIRE_HALF_CYCLE_US * zc->cycles_per_us;
+    uint32_t tolerance = period / 20U;
+
+    if (interval < period - tolerance || interval > period + tolerance) {
+        return;
+    }
+
+    if (zc->period == 0) {
+        zc->period = interval;
+    } else {
+        zc->period += (int32_t)(interval - zc->period) / 8;
+    }
+    zc->htim_fly->Instance->CCR1 = zc->period / zc->cycles_per_us + ZERO_CROSS_WINDOW_US;
+    zc->htim_fly->Instance->CCR2 = zc->period / zc->cycles_per_us - ZERO_CROSS_WINDOW_US;
+}
+
+/**
+ * @brief Let the detector start the firing timer again (window open)
+ */
+RAMFUNC static void zc_gate_open(ZeroCross_t *zc)
+{
+    TIM_TypeDef *tim = zc->htim->Instance;
+
+    if (zc->fire->armed) {
+        tim->SMCR = (tim->SMCR & ~TIM_SMCR_SMS) | (zc->fire->smcr & TIM_SMCR_SMS);
+    }
+}
+
+/**
+ * @brief Ignore the detector until the next window (a running timer keeps
+ *        running)
+ */
+RAMFUNC static void zc_gate_close(ZeroCross_t *zc)
+{
+    zc->htim->Instance->SMCR &= ~TIM_SMCR_SMS;
+}
+
+/**
+ * @brief Derive the filter delay, set up the flywheel and enable the edge
+ *        interrupts
+ *
+ * @param zc         Pointer to zero-cross control structure
+ * @param fire       Firing control
+ * @param htim_fly   Flywheel timer handle
+ * @param opto_delay Detector propagation delay [us]
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ZeroCross_Init(ZeroCross_t *zc, TriacFire_t *fire,
+                                 TIM_HandleTypeDef *htim_fly, float opto_delay)
+{
+    TIM_HandleTypeDef *htim;
+    TIM_TypeDef *fly;
+    uint32_t clock;
+    uint32_t fly_clock;
+
+    /* Validate input parameters */
+    if (zc == NULL || fire == NULL || fire->htim == NULL || htim_fly == NULL) {
+        return HAL_ERROR;
+    }
+    htim = fire->htim;
+
+    /* Timers run at twice the bus clock when the bus clock is divided */
+    clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        clock *= 2U;
+    }
+    fly_clock = HAL_RCC_GetPCLK2Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_CFGR_PPRE2_DIV1) {
+        fly_clock *= 2U;
+    }
+
+    zc->fire = fire;
+    zc->htim = htim;
+    zc->htim_fly = htim_fly;
+    zc->cycles_per_us = SystemCoreClock / 1000000U;
+    zc->opto_delay = opto_delay;
+    zc->filter_delay = zc_filter_delay(htim->Instance, clock);
+    zc->width = 0.0f;
+    zc->compensation = opto_delay + zc->filter_delay;
+    zc->error = 0.0f;
+    Profiling_Reset(&zc->pulse);
+    Profiling_Reset(&zc->latency);
+    zc->trace = NULL;
+    zc->traced_edges = 0;
+    zc->traced_flywheel = 0;
+    zc->rise = 0;
+    zc->in_pulse = 0;
+    zc->new_width = 0;
+    zc->new_fire = 0;
+    zc->period = 0;
+    zc->edges = 0;
+    zc->missed = 0;
+    zc->flywheel = 0;
+    zc->rejected = 0;
+    zc->lost = 0;
+
+    /* TIM2 signals every start of the firing timer on its TRGO */
+    htim->Instance->CR2 = (htim->Instance->CR2 & ~TIM_CR2_MMS) | TIM_CR2_MMS_0;
+
+    /* TIM1 counts microseconds since that start (slave reset on ITR1 = TIM2) */
+    fly = htim_fly->Instance;
+    fly->CR1 = 0;
+    fly->PSC = fly_clock / 1000000U - 1U;
+    fly->ARR = 0xFFFF;
+    fly->CCMR1 = 0;
+    fly->CCR1 = TRIAC_FIRE_HALF_CYCLE_US + ZERO_CROSS_WINDOW_US;
+    fly->CCR2 = TRIAC_FIRE_HALF_CYCLE_US - ZERO_CROSS_WINDOW_US;
+    fly->SMCR = TIM_TS_ITR1 | TIM_SLAVEMODE_RESET;
+    fly->EGR = TIM_EGR_UG;
+    fly->SR = 0;
+    fly->DIER = TIM_DIER_CC1IE | TIM_DIER_CC2IE;
+    fly->CR1 = TIM_CR1_CEN;
+    HAL_NVIC_SetPriority(TIM1_CC_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(TIM1_CC_IRQn);
+
+    /* The pins keep their timer function, the EXTI lines only watch them */
+    SYSCFG->EXTICR[0] &= ~(SYSCFG_EXTICR1_EXTI0 | SYSCFG_EXTICR1_EXTI1);
+    EXTI->RTSR |= fire_Pin | zero_crossig_Pin;
+    EXTI->FTSR |= zero_crossig_Pin;
+    EXTI->PR = fire_Pin | zero_crossig_Pin;
+    EXTI->IMR |= fire_Pin | zero_crossig_Pin;
+
+    HAL_NVIC_SetPriority(EXTI0_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+    HAL_NVIC_SetPriority(EXTI1_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI1_IRQn);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief Detector edge interrupt (runs from SRAM)
+ *
+ * @param zc Pointer to zero-cross control structure
+ */
+RAMFUNC void ZeroCross_EdgeISR(ZeroCross_t *zc)
+{
+    TIM_TypeDef *tim = zc->htim->Instance;
+    uint32_t now = Profiling_Cycles();
+
+    if (!(zero_crossig_GPIO_Port->IDR & zero_crossig_Pin)) {
+        /* Only the end of an accepted pulse gives its width */
+        if (zc->in_pulse) {
+            zc->edge_width = now - zc->rise;
+            zc->new_width = 1;
+            zc->in_pulse = 0;
+        }
+        return;
+    }
+
+    /* The firing timer was already running: it ignored this edge, so do we */
+    if ((tim->CR1 & TIM_CR1_CEN) && tim->CNT > ZERO_CROSS_EDGE_SLACK_US) {
+        zc->rejected++;
+        return;
+    }
+
+    /* Locked: before the window the gate kept the timer stopped, ignore it too */
+    if (zc->period != 0 && !zc->lost &&
+        now - zc->rise < zc->period - ZERO_CROSS_WINDOW_US * zc->cycles_per_us) {
+        zc->rejected++;
+        return;
+    }
+
+    /* The first edge has no previous one to measure from */
+    if (zc->edges != 0) {
+        zc_track(zc, now - zc->rise);
+    }
+    zc->rise = now;
+    zc->in_pulse = 1;
+    zc->edges++;
+    zc->missed = 0;
+    zc->lost = 0;
+    if (zc->period != 0) {
+        zc_gate_close(zc);
+    }
+}
+
+/**
+ * @brief Zone 0 gate edge interrupt (runs from SRAM)
+ *
+ * @param zc Pointer to zero-cross control structure
+ */
+RAMFUNC void ZeroCross_FireISR(ZeroCross_t *zc)
+{
+    zc->fire_time = Profiling_Cycles();
+    zc->fire_rise = zc->rise;
+    zc->fire_compare = zc->htim->Instance->CCR1;
+    zc->new_fire = 1;
+}
+
+/**
+ * @brief Flywheel deadline interrupt (runs from SRAM)
+ *
+ * @details TIM1 was not reset by a start of the firing timer within one period
+ *          plus the window: start it now, as far into the half-cycle as the
+ *          predicted edge would have put it.
+ *
+ * @param zc Pointer to zero-cross control structure
+ */
+RAMFUNC void ZeroCross_DeadlineISR(ZeroCross_t *zc)
+{
+    TIM_TypeDef *tim = zc->htim->Instance;
+    TIM_TypeDef *fly = zc->htim_fly->Instance;
+    uint32_t late;
+
+    /* Not locked yet, given up, firing killed, or the edge has just come */
+    if (zc->period == 0 || zc->lost || !zc->fire->armed || (tim->CR1 & TIM_CR1_CEN)) {
+        return;
+    }
+
+    /* Given up: any edge may start the timer again */
+    if (++zc->missed > ZERO_CROSS_LOST_LIMIT) {
+        zc->lost = 1;
+        zc_gate_open(zc);
+        return;
+    }
+
+    late = fly->CNT - zc->period / zc->cycles_per_us;
+    tim->CNT = late;
+    tim->CR1 |= TIM_CR1_CEN;
+    /* The start has reset TIM1, keep it on the predicted edge as well */
+    fly->CNT = late;
+    zc->flywheel++;
+    zc_gate_close(zc);
+}
+
+/**
+ * @brief Acceptance window interrupt (runs from SRAM)
+ *
+ * @details ZERO_CROSS_WINDOW_US before the predicted edge: the detector may
+ *          start the firing timer again. Until lock the window never closes.
+ *
+ * @param zc Pointer to zero-cross control structure
+ */
+RAMFUNC void ZeroCross_WindowISR(ZeroCross_t *zc)
+{
+    zc_gate_open(zc);
+}
+
+/**
+ * @brief Record the edge counts in a sensor trace from now on
+ *
+ * @param zc    Pointer to zero-cross control structure
+ * @param trace Trace to write to, NULL to stop
+ */
+void ZeroCross_SetTrace(ZeroCross_t *zc, SensorTrace_t *trace)
+{
+    zc->traced_edges = zc->edges;
+    zc->traced_flywheel = zc->flywheel;
+    zc->trace = trace;
+}
+
+/**
+ * @brief Process the latest samples and update the firing compensation
+ *
+ * @param zc   Pointer to zero-cross control structure
+ * @param fire Firing control structure to compensate
+ */
+void ZeroCross_Update(ZeroCross_t *zc, TriacFire_t *fire)
+{
+    float cycles_per_us = (float)zc->cycles_per_us;
+    uint32_t width, fire_rise, fire_time, fire_compare, edges, flywheel;
+    uint8_t new_width, new_fire;
+
+    __disable_irq();
+    edges = zc->edges;
+    flywheel = zc->flywheel;
+    width = zc->edge_width;
+    fire_rise = zc->fire_rise;
+    fire_time = zc->fire_time;
+    fire_compare = zc->fire_compare;
+    new_width = zc->new_width;
+    new_fire = zc->new_fire;
+    zc->new_width = 0;
+    zc->new_fire = 0;
+    __enable_irq();
+
+    if (new_width) {
+        float w = width / cycles_per_us;
+        if (w >= ZERO_CROSS_MIN_WIDTH_US && w <= ZERO_CROSS_MAX_WIDTH_US) {
+            Profiling_Record(&zc->pulse, width);
+            if (zc->width == 0.0f) {
+                zc->width = w;
+            } else {
+                zc->width += ZERO_CROSS_WIDTH_ALPHA * (w - zc->width);
+            }
+        }
+    }
+
+    /* Gate edge against the centre of the pulse that started its half-cycle */
+    if (new_fire && zc->width > 0.0f) {
+        uint32_t half = (uint32_t)(0.5f * zc->width * cycles_per_us);
+        uint32_t elapsed = fire_time - fire_rise;
+        if (elapsed > half && elapsed < (uint32_t)(TRIAC_FIRE_HALF_CYCLE_US * cycles_per_us)) {
+            uint32_t latency = elapsed - half;
+            Profiling_Record(&zc->latency, latency);
+            zc->error = latency / cycles_per_us + zc->opto_delay -
+                        ((float)fire_compare + zc->compensation);
+        }
+    }
+
+    zc->compensation = zc->opto_delay + zc->filter_delay - 0.5f * zc->width;
+    TriacFire_SetCompensation(fire, zc->compensation);
+
+    /* Half-cycles since the previous tick: real edges, flywheel starts */
+    if (zc->trace != NULL) {
+        uint32_t fly = flywheel - zc->traced_flywheel;
+        SensorTrace_Record(zc->trace, Profiling_Micros(), SENSOR_TRACE_ZERO_CROSS,
+                           (uint8_t)((fly > 0xFFU) ? 0xFFU : fly),
+                           (uint16_t)(edges - zc->traced_edges));
+        zc->traced_edges = edges;
+        zc->traced_flywheel = flywheel;
+    }
+}
@@ -6,39 +6,105 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Core/Src/AS5048B.c \
+../Core/Src/control_metrics.c \
+../Core/Src/decoupling.c \
 ../Core/Src/extrusor_process.c \
+../Core/Src/feedforward.c \
+../Core/Src/flash_if.c \
+../Core/Src/gain_schedule.c \
+../Core/Src/heater_supervisor.c \
+../Core/Src/heaters.c \
+../Core/Src/idle.c \
 ../Core/Src/main.c \
+../Core/Src/material_profiles.c \
 ../Core/Src/max6675.c \
+../Core/Src/param_store.c \
 ../Core/Src/pid.c \
+../Core/Src/power_allocator.c \
+../Core/Src/process_log.c \
+../Core/Src/profiling.c \
+../Core/Src/sensor_trace.c \
+../Core/Src/smith_predictor.c \
 ../Core/Src/stm32f4xx_hal_msp.c \
 ../Core/Src/stm32f4xx_it.c \
 ../Core/Src/syscalls.c \
 ../Core/Src/sysmem.c \
-../Core/Src/system_stm32f4xx.c 
+../Core/Src/system_stm32f4xx.c \
+../Core/Src/temp_estimator.c \
+../Core/Src/thermal_model.c \
+../Core/Src/thermal_rls.c \
+../Core/Src/triac_fire.c \
+../Core/Src/warmup_planner.c \
+../Core/Src/watchdog.c \
+../Core/Src/zero_cross.c 
 
 OBJS += \
 ./Core/Src/AS5048B.o \
+./Core/Src/control_metrics.o \
+./Core/Src/decoupling.o \
 ./Core/Src/extrusor_process.o \
+./Core/Src/feedforward.o \
+./Core/Src/flash_if.o \
+./Core/Src/gain_schedule.o \
+./Core/Src/heater_supervisor.o \
+./Core/Src/heaters.o \
+./Core/Src/idle.o \
 ./Core/Src/main.o \
+./Core/Src/material_profiles.o \
 ./Core/Src/max6675.o \
+./Core/Src/param_store.o \
 ./Core/Src/pid.o \
+./Core/Src/power_allocator.o \
+./Core/Src/process_log.o \
+./Core/Src/profiling.o \
+./Core/Src/sensor_trace.o \
+./Core/Src/smith_predictor.o \
 ./Core/Src/stm32f4xx_hal_msp.o \
 ./Core/Src/stm32f4xx_it.o \
 ./Core/Src/syscalls.o \
 ./Core/Src/sysmem.o \
-./Core/Src/system_stm32f4xx.o 
+./Core/Src/system_stm32f4xx.o \
+./Core/Src/temp_estimator.o \
+./Core/Src/thermal_model.o \
+./Core/Src/thermal_rls.o \
+./Core/Src/triac_fire.o \
+./Core/Src/warmup_planner.o \
+./Core/Src/watchdog.o \
+./Core/Src/zero_cross.o 
 
 C_DEPS += \
 ./Core/Src/AS5048B.d \
+./Core/Src/control_metrics.d \
+./Core/Src/decoupling.d \
 ./Core/Src/extrusor_process.d \
+./Core/Src/feedforward.d \
+./Core/Src/flash_if.d \
+./Core/Src/gain_schedule.d \
+./Core/Src/heater_supervisor.d \
+./Core/Src/heaters.d \
+./Core/Src/idle.d \
 ./Core/Src/main.d \
+./Core/Src/material_profiles.d \
 ./Core/Src/max6675.d \
+./Core/Src/param_store.d \
 ./Core/Src/pid.d \
+./Core/Src/power_allocator.d \
+./Core/Src/process_log.d \
+./Core/Src/profiling.d \
+./Core/Src/sensor_trace.d \
+./Core/Src/smith_predictor.d \
 ./Core/Src/stm32f4xx_hal_msp.d \
 ./Core/Src/stm32f4xx_it.d \
 ./Core/Src/syscalls.d \
 ./Core/Src/sysmem.d \
-./Core/Src/system_stm32f4xx.d 
+./Core/Src/system_stm32f4xx.d \
+./Core/Src/temp_estimator.d \
+./Core/Src/thermal_model.d \
+./Core/Src/thermal_rls.d \
+./Core/Src/triac_fire.d \
+./Core/Src/warmup_planner.d \
+./Core/Src/watchdog.d \
+./Core/Src/zero_cross.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -48,7 +114,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/AS5048B.cyclo ./Core/Src/AS5048B.d ./Core/Src/AS5048B.o ./Core/Src/AS5048B.su ./Core/Src/extrusor_process.cyclo ./Core/Src/extrusor_process.d ./Core/Src/extrusor_process.o ./Core/Src/extrusor_process.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/max6675.cyclo ./Core/Src/max6675.d ./Core/Src/max6675.o ./Core/Src/max6675.su ./Core/Src/pid.cyclo ./Core/Src/pid.d ./Core/Src/pid.o ./Core/Src/pid.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su
+	-$(RM) ./Core/Src/AS5048B.cyclo ./Core/Src/AS5048B.d ./Core/Src/AS5048B.o ./Core/Src/AS5048B.su ./Core/Src/control_metrics.cyclo ./Core/Src/control_metrics.d ./Core/Src/control_metrics.o ./Core/Src/control_metrics.su ./Core/Src/decoupling.cyclo ./Core/Src/decoupling.d ./Core/Src/decoupling.o ./Core/Src/decoupling.su ./Core/Src/extrusor_process.cyclo ./Core/Src/extrusor_process.d ./Core/Src/extrusor_process.o ./Core/Src/extrusor_process.su ./Core/Src/feedforward.cyclo ./Core/Src/feedforward.d ./Core/Src/feedforward.o ./Core/Src/feedforward.su ./Core/Src/flash_if.cyclo ./Core/Src/flash_if.d ./Core/Src/flash_if.o ./Core/Src/flash_if.su ./Core/Src/gain_schedule.cyclo ./Core/Src/gain_schedule.d ./Core/Src/gain_schedule.o ./Core/Src/gain_schedule.su ./Core/Src/heater_supervisor.cyclo ./Core/Src/heater_supervisor.d ./Core/Src/heater_supervisor.o ./Core/Src/heater_supervisor.su ./Core/Src/heaters.cyclo ./Core/Src/heaters.d ./Core/Src/heaters.o ./Core/Src/heaters.su ./Core/Src/idle.cyclo ./Core/Src/idle.d ./Core/Src/idle.o ./Core/Src/idle.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/material_profiles.cyclo ./Core/Src/material_profiles.d ./Core/Src/material_profiles.o ./Core/Src/material_profiles.su ./Core/Src/max6675.cyclo ./Core/Src/max6675.d ./Core/Src/max6675.o ./Core/Src/max6675.su ./Core/Src/param_store.cyclo ./Core/Src/param_store.d ./Core/Src/param_store.o ./Core/Src/param_store.su ./Core/Src/pid.cyclo ./Core/Src/pid.d ./Core/Src/pid.o ./Core/Src/pid.su ./Core/Src/power_allocator.cyclo ./Core/Src/power_allocator.d ./Core/Src/power_allocator.o ./Core/Src/power_allocator.su ./Core/Src/process_log.cyclo ./Core/Src/process_log.d ./Core/Src/process_log.o ./Core/Src/process_log.su ./Core/Src/profiling.cyclo ./Core/Src/profiling.d ./Core/Src/profiling.o ./Core/Src/profiling.su ./Core/Src/sensor_trace.cyclo ./Core/Src/sensor_trace.d ./Core/Src/sensor_trace.o ./Core/Src/sensor_trace.su ./Core/Src/smith_predictor.cyclo ./Core/Src/smith_predictor.d ./Core/Src/smith_predictor.o ./Core/Src/smith_predictor.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su ./Core/Src/temp_estimator.cyclo ./Core/Src/temp_estimator.d ./Core/Src/temp_estimator.o ./Core/Src/temp_estimator.su ./Core/Src/thermal_model.cyclo ./Core/Src/thermal_model.d ./Core/Src/thermal_model.o ./Core/Src/thermal_model.su ./Core/Src/thermal_rls.cyclo ./Core/Src/thermal_rls.d ./Core/Src/thermal_rls.o ./Core/Src/thermal_rls.su ./Core/Src/triac_fire.cyclo ./Core/Src/triac_fire.d ./Core/Src/triac_fire.o ./Core/Src/triac_fire.su ./Core/Src/warmup_planner.cyclo ./Core/Src/warmup_planner.d ./Core/Src/warmup_planner.o ./Core/Src/warmup_planner.su ./Core/Src/watchdog.cyclo ./Core/Src/watchdog.d ./Core/Src/watchdog.o ./Core/Src/watchdog.su ./Core/Src/zero_cross.cyclo ./Core/Src/zero_cross.d ./Core/Src/zero_cross.o ./Core/Src/zero_cross.su
 
 .PHONY: clean-Core-2f-Src
 
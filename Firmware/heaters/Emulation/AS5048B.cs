@@ -0,0 +1,148 @@
+//
+// AS5048B.cs
+// AS5048B magnetic rotary encoder on I2C
+//
+// Same register model as Host/Models/as5048b_model.c: the register pointer
+// is set by the first byte of a write and auto-increments on reads and
+// writes. Only 0x03, 0x15, 0x16 and 0x17 are writable. The read-only
+// registers are computed from the magnet state:
+//
+//   0xFA AGC, 0xFB diagnostics (OCF, COF, COMP low, COMP high)
+//   0xFC/0xFD magnitude, 0xFE/0xFF angle, bits 13..6 then 5..0
+//
+// The angle output is the magnet angle minus the zero position in
+// 0x16/0x17. The interface has no CRC.
+//
+using System;
+using Antmicro.Renode.Logging;
+using Antmicro.Renode.Peripherals.I2C;
+
+namespace Antmicro.Renode.Peripherals.Sensors
+{
+    public class AS5048B : II2CPeripheral
+    {
+        public AS5048B()
+        {
+            Reset();
+        }
+
+        public void Reset()
+        {
+            registers = new byte[256];
+            pointer = 0;
+            angle = 0;
+            Field = 1;
+        }
+
+        public void Write(byte[] data)
+        {
+            if(data.Length == 0)
+            {
+                return;
+            }
+            pointer = data[0];
+            for(var i = 1; i < data.Length; i++)
+            {
+                var reg = pointer++;
+                if(reg == ProgramControl || reg == SlaveAddress || reg == ZeroHigh || reg == ZeroLow)
+                {
+                    registers[reg] = data[i];
+                }
+                else
+                {
+                    this.Log(LogLevel.Warning, "Write to read-only register 0x{0:X2}", reg);
+                }
+            }
+        }
+
+        public byte[] Read(int count = 1)
+        {
+            var result = new byte[count];
+            for(var i = 0; i < count; i++)
+            {
+                result[i] = ReadRegister(pointer++);
+            }
+            return result;
+        }
+
+        public void FinishTransmission()
+        {
+        }
+
+        // Magnet angle [deg]
+        public decimal Angle
+        {
+            get => angle * 360m / 16384m;
+            set => angle = (ushort)((int)Math.Round(value / 360m * 16384m) & 0x3FFF);
+        }
+
+        // Field strength relative to nominal. The AGC compensates 1/4 to 4
+        // times nominal, outside that range the COMP flags are raised and the
+        // magnitude follows the field; below 5 % the CORDIC overflows.
+        public double Field
+        {
+            get => field;
+            set
+            {
+                var agc = 128 - 64 * Math.Log(Math.Max(value, 1e-6), 2);
+                var magnitude = (double)NominalMagnitude;
+
+                field = value;
+                diagnostics = DiagOcf;
+                if(agc > 255)
+                {
+                    agc = 255;
+                    magnitude *= value * 4;
+                    diagnostics |= DiagCompHigh;
+                }
+                else if(agc < 0)
+                {
+                    agc = 0;
+                    magnitude *= value / 4;
+                    diagnostics |= DiagCompLow;
+                }
+                if(value < 0.05)
+                {
+                    diagnostics |= DiagCof;
+                }
+                gain = (byte)agc;
+                this.magnitude = (ushort)Math.Min(16383, magnitude);
+            }
+        }
+
+        private byte ReadRegister(byte reg)
+        {
+            var zero = (registers[ZeroHigh] << 6) | (registers[ZeroLow] & 0x3F);
+            var output = (angle - zero) & 0x3FFF;
+
+            switch(reg)
+            {
+            case 0xFA: return gain;
+            case 0xFB: return diagnostics;
+            case 0xFC: return (byte)(magnitude >> 6);
+            case 0xFD: return (byte)(magnitude & 0x3F);
+            case 0xFE: return (byte)(output >> 6);
+            case 0xFF: return (byte)(output & 0x3F);
+            default: return registers[reg];
+            }
+        }
+
+        private byte[] registers;
+        private byte pointer;
+        private ushort angle;
+        private ushort magnitude;
+        private byte gain;
+        private byte diagnostics;
+        private double field;
+
+        private const byte ProgramControl = 0x03;
+        private const byte SlaveAddress = 0x15;
+        private const byte ZeroHigh = 0x16;
+        private const byte ZeroLow = 0x17;
+        private const byte DiagOcf = 0x01;
+        private const byte DiagCof = 0x02;
+        private const byte DiagCompLow = 0x04;
+        private const byte DiagCompHigh = 0x08;
+        private const ushort NominalMagnitude = 4000;
+    }
+}
@@ -0,0 +1,235 @@
+//
+// Max6675Spi.cs
+// SPI1 of the heater board with its four MAX6675 thermocouple converters
+//
+// Register model of the STM32F4 SPI controller as the firmware configures it
+// (master, two-line receive-only, 16-bit frames, software NSS), with the
+// converters behind it. Setting SPE clocks one frame from the converter
+// whose chip select is low; reading DR returns it. The converter frames
+// follow the MAX6675 datasheet, as in Host/Models/max6675_model.c:
+//
+//   D14..D3  temperature in 0.25 C steps, truncated, 0..1023.75 C
+//   D2       set when the thermocouple input is open
+//   D15..D0  dummy, device ID and tri-state bits read 0
+//
+// A conversion takes 220 ms after chip select goes high. Pulling it low
+// earlier aborts the conversion and the converter sends its previous result
+// again. With no chip select or more than one low MISO floats high (0xFFFF).
+//
+using System;
+using System.Linq;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Core.Structure.Registers;
+using Antmicro.Renode.Logging;
+using Antmicro.Renode.Peripherals.Bus;
+using Antmicro.Renode.Time;
+
+namespace Antmicro.Renode.Peripherals.Sensors
+{
+    public class Max6675Spi : BasicDoubleWordPeripheral, IKnownSize, IGPIOReceiver
+    {
+        public Max6675Spi(IMachine machine, int devices = 4, decimal temperature = 25) : base(machine)
+        {
+            converters = new Converter[devices];
+            for(var i = 0; i < devices; i++)
+            {
+                converters[i] = new Converter { Temperature = temperature };
+            }
+            DefineRegisters();
+            Reset();
+        }
+
+        public override void Reset()
+        {
+            base.Reset();
+            rxPending = false;
+            frame = 0xFFFF;
+            foreach(var c in converters)
+            {
+                c.Selected = false;
+                c.Fault = Fault.Ok;
+                c.Result = Frame(c.Temperature, Fault.Ok);
+                c.Start = TimeInterval.Empty;
+                c.Frames = 0;
+                c.Aborted = 0;
+            }
+        }
+
+        // Chip select inputs, active low
+        public void OnGPIO(int number, bool value)
+        {
+            if(number < 0 || number >= converters.Length)
+            {
+                this.Log(LogLevel.Warning, "Chip select {0} out of range", number);
+                return;
+            }
+            var c = converters[number];
+            var now = machine.LocalTimeSource.ElapsedVirtualTime;
+
+            if(!value && !c.Selected)
+            {
+                if((now - c.Start).TotalMilliseconds >= ConversionMs)
+                {
+                    c.Result = Frame(c.Temperature, c.Fault);
+                }
+                else
+                {
+                    c.Aborted++;
+                }
+            }
+            else if(value && c.Selected)
+            {
+                // The next conversion starts on the rising edge
+                c.Start = now;
+            }
+            c.Selected = !value;
+        }
+
+        public void SetTemperature(int device, decimal temperature)
+        {
+            converters[device].Temperature = temperature;
+        }
+
+        public void SetFault(int device, Fault fault)
+        {
+            converters[device].Fault = fault;
+        }
+
+        public ulong Frames(int device)
+        {
+            return converters[device].Frames;
+        }
+
+        public ulong Aborted(int device)
+        {
+            return converters[device].Aborted;
+        }
+
+        public long Size => 0x400;
+
+        public enum Fault
+        {
+            Ok,
+            Open,
+            MisoHigh,
+            MisoLow
+        }
+
+        private static ushort Frame(decimal temperature, Fault fault)
+        {
+            switch(fault)
+            {
+            case Fault.MisoHigh:
+                return 0xFFFF;
+            case Fault.MisoLow:
+                return 0x0000;
+            }
+            var counts = (int)Math.Max(0, Math.Min(4095, Math.Floor(temperature / 0.25m)));
+            var code = (ushort)(counts << 3);
+            if(fault == Fault.Open)
+            {
+                code |= 0x0004;
+            }
+            return code;
+        }
+
+        private void ClockFrame()
+        {
+            var selected = converters.Where(c => c.Selected).ToArray();
+            if(selected.Length == 1)
+            {
+                frame = selected[0].Result;
+                selected[0].Frames++;
+            }
+            else
+            {
+                frame = 0xFFFF;
+            }
+            rxPending = true;
+        }
+
+        private void DefineRegisters()
+        {
+            Registers.Control1.Define(this)
+                .WithFlag(0, name: "CPHA")
+                .WithFlag(1, name: "CPOL")
+                .WithFlag(2, name: "MSTR")
+                .WithValueField(3, 3, name: "BR")
+                .WithFlag(6, out enabled, name: "SPE", writeCallback: (previous, value) =>
+                {
+                    // Receive-only master: enabling the controller clocks a frame
+                    if(value && !previous && receiveOnly.Value)
+                    {
+                        ClockFrame();
+                    }
+                })
+                .WithFlag(7, name: "LSBFIRST")
+                .WithFlag(8, name: "SSI")
+                .WithFlag(9, name: "SSM")
+                .WithFlag(10, out receiveOnly, name: "RXONLY")
+                .WithFlag(11, name: "DFF")
+                .WithTag("CRC", 12, 4)
+                .WithReservedBits(16, 16);
+
+            Registers.Control2.Define(this)
+                .WithValueField(0, 8, name: "CR2")
+                .WithReservedBits(8, 24);
+
+            Registers.Status.Define(this)
+                .WithFlag(0, FieldMode.Read, valueProviderCallback: _ => rxPending, name: "RXNE")
+                .WithFlag(1, FieldMode.Read, valueProviderCallback: _ => true, name: "TXE")
+                .WithReservedBits(2, 5)
+                .WithFlag(7, FieldMode.Read, valueProviderCallback: _ => false, name: "BSY")
+                .WithReservedBits(8, 24);
+
+            Registers.Data.Define(this)
+                .WithValueField(0, 16, name: "DR",
+                    valueProviderCallback: _ =>
+                    {
+                        rxPending = false;
+                        return frame;
+                    },
+                    writeCallback: (_, __) =>
+                    {
+                        // Full duplex: every write clocks a frame
+                        if(enabled.Value)
+                        {
+                            ClockFrame();
+                        }
+                    })
+                .WithReservedBits(16, 16);
+
+            Registers.CrcPolynomial.Define(this, 0x7)
+                .WithValueField(0, 16, name: "CRCPOLY")
+                .WithReservedBits(16, 16);
+        }
+
+        private readonly Converter[] converters;
+        private IFlagRegisterField enabled;
+        private IFlagRegisterField receiveOnly;
+        private bool rxPending;
+        private ushort frame;
+
+        private const double ConversionMs = 220;
+
+        private class Converter
+        {
+            public decimal Temperature;
+            public Fault Fault;
+            public bool Selected;
+            public ushort Result;
+            public TimeInterval Start;
+            public ulong Frames;
+            public ulong Aborted;
+        }
+
+        private enum Registers
+        {
+            Control1 = 0x00,
+            Control2 = 0x04,
+            Status = 0x08,
+            Data = 0x0C,
+            CrcPolynomial = 0x10,
+        }
+    }
+}
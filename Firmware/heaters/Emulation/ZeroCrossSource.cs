@@ -0,0 +1,69 @@
+//
+// ZeroCrossSource.cs
+// Zero-cross detector of the heater board
+//
+// Drives a pulse centred on every mains zero crossing: high for
+// pulseWidthUs, one pulse per half-cycle. Disabling it stops the pulses,
+// as a lost mains connection or a failed detector would.
+//
+using System;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Time;
+
+namespace Antmicro.Renode.Peripherals.Miscellaneous
+{
+    public class ZeroCrossSource : IPeripheral, IGPIOSender
+    {
+        public ZeroCrossSource(IMachine machine, decimal mainsFrequency = 60, ulong pulseWidthUs = 400)
+        {
+            halfCycleUs = (ulong)Math.Round(500000m / mainsFrequency);
+            widthUs = Math.Min(pulseWidthUs, halfCycleUs / 2);
+            IRQ = new GPIO();
+            timer = new LimitTimer(machine.ClockSource, 1000000, this, "zeroCross",
+                                   limit: halfCycleUs - widthUs, direction: Direction.Descending,
+                                   enabled: false, eventEnabled: true, autoUpdate: true);
+            timer.LimitReached += Toggle;
+            Reset();
+        }
+
+        public void Reset()
+        {
+            IRQ.Unset();
+            timer.Limit = halfCycleUs - widthUs;
+            timer.Enabled = true;
+        }
+
+        public bool Enabled
+        {
+            get => timer.Enabled;
+            set
+            {
+                timer.Enabled = value;
+                if(!value)
+                {
+                    IRQ.Unset();
+                }
+            }
+        }
+
+        public GPIO IRQ { get; }
+
+        private void Toggle()
+        {
+            if(IRQ.IsSet)
+            {
+                IRQ.Unset();
+                timer.Limit = halfCycleUs - widthUs;
+            }
+            else
+            {
+                IRQ.Set();
+                timer.Limit = widthUs;
+            }
+        }
+
+        private readonly LimitTimer timer;
+        private readonly ulong halfCycleUs;
+        private readonly ulong widthUs;
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file      as5048b_model.c
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the AS5048B magnetic encoders on I2C1
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "as5048b_model.h"
+#include <math.h>
+#include <string.h>
+
+/* Private functions --------------------------------------------------------*/
+static As5048bModel_Device_t *as5048b_model_find(As5048bModel_t *model, uint16_t address)
+{
+    for (uint8_t i = 0; i < AS5048B_MAX_DEVICES; i++) {
+        /* The HAL takes the 8-bit form of the address */
+        if (model->device[i].address != 0U && (model->device[i].address << 1) == address) {
+            return &model->device[i];
+        }
+    }
+    return NULL;    /* NACK */
+}
+
+static uint8_t as5048b_model_register(const As5048bModel_Device_t *dev, uint8_t reg)
+{
+    uint16_t zero = (uint16_t)((dev->reg[REG_ZERO_POS_HIGH] << 6) | (dev->reg[REG_ZERO_POS_LOW] & 0x3FU));
+    uint16_t angle = (uint16_t)((dev->angle - zero) & 0x3FFFU);
+
+    switch (reg) {
+    case REG_AGC:            return dev->agc;
+    case REG_DIAG:           return dev->diag;
+    case REG_MAGNITUDE_HIGH: return (uint8_t)(dev->magnitude >> 6);
+    case REG_MAGNITUDE_LOW:  return (uint8_t)(dev->magnitude & 0x3FU);
+    case REG_ANGLE_HIGH:     return (uint8_t)(angle >> 6);
+    case REG_ANGLE_LOW:      return (uint8_t)(angle & 0x3FU);
+    default:                 return dev->reg[reg];
+    }
+}
+
+static HAL_StatusTypeDef as5048b_model_read(void *ctx, uint16_t address, uint16_t reg,
+                                            uint8_t *data, uint16_t size)
+{
+    As5048bModel_Device_t *dev = as5048b_model_find((As5048bModel_t *)ctx, address);
+
+    if (dev == NULL) return HAL_ERROR;
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = as5048b_model_register(dev, (uint8_t)(reg + i));
+    }
+    dev->reads++;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef as5048b_model_write(void *ctx, uint16_t address, uint16_t reg,
+                                             const uint8_t *data, uint16_t size)
+{
+    As5048bModel_Device_t *dev = as5048b_model_find((As5048bModel_t *)ctx, address);
+
+    if (dev == NULL) return HAL_ERROR;
+    for (uint16_t i = 0; i < size; i++) {
+        uint8_t r = (uint8_t)(reg + i);
+
+        /* Only the programming, address and zero registers are writable */
+        if (r == REG_PROG_CTRL || r == REG_I2C_ADDR || r == REG_ZERO_POS_HIGH || r == REG_ZERO_POS_LOW) {
+            dev->reg[r] = data[i];
+        }
+    }
+    dev->writes++;
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef as5048b_model_ready(void *ctx, uint16_t address)
+{
+    return (as5048b_model_find((As5048bModel_t *)ctx, address) != NULL) ? HAL_OK : HAL_ERROR;
+}
+
+/* Public functions ---------------------------------------------------------*/
+void As5048bModel_Attach(As5048bModel_t *model, const uint8_t *addresses)
+{
+    memset(model, 0, sizeof(*model));
+    for (uint8_t i = 0; i < AS5048B_MAX_DEVICES; i++) {
+        model->device[i].address = addresses[i];
+        As5048bModel_SetField(&model->device[i], 1.0f);
+    }
+    model->bus.read = as5048b_model_read;
+    model->bus.write = as5048b_model_write;
+    model->bus.ready = as5048b_model_ready;
+    model->bus.ctx = model;
+    HalStub_SetI2c(&model->bus);
+}
+
+void As5048bModel_SetField(As5048bModel_Device_t *dev, float field)
+{
+    /* 64 AGC steps per halving of the field, 128 at nominal */
+    float agc = 128.0f - 64.0f * log2f(field > 1e-6f ? field : 1e-6f);
+    float magnitude = (float)AS5048B_MODEL_MAGNITUDE;
+
+    dev->diag = AS5048B_MODEL_DIAG_OCF;
+    if (agc > 255.0f) {
+        agc = 255.0f;
+        magnitude *= field * 4.0f;
+        dev->diag |= AS5048B_MODEL_DIAG_COMP_HIGH;
+    } else if (agc < 0.0f) {
+        agc = 0.0f;
+        magnitude *= field / 4.0f;
+        dev->diag |= AS5048B_MODEL_DIAG_COMP_LOW;
+    }
+    if (field < 0.05f) {
+        dev->diag |= AS5048B_MODEL_DIAG_COF;
+    }
+    dev->agc = (uint8_t)agc;
+    dev->magnitude = (uint16_t)((magnitude > 16383.0f) ? 16383.0f : magnitude);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file      as5048b_model.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the AS5048B magnetic encoders on I2C1
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Register-level model behind the stub HAL I2C transfers. Each
+ *            device answers its 7-bit address, auto-increments the register
+ *            pointer on reads and writes, and computes the read-only
+ *            registers from its state:
+ *
+ *              - 0xFA AGC, 0xFB diagnostics (OCF, COF, COMP low/high)
+ *              - 0xFC/0xFD magnitude, 0xFE/0xFF angle, bits 13..6 then 5..0
+ *
+ *            The angle output is the magnet angle minus the zero position in
+ *            0x16/0x17, as on the part. Only the volatile registers are
+ *            modelled, an OTP burn (0x03) is stored but has no effect.
+ *
+ * @note      Host builds only. The AS5048B I2C interface has no CRC, so
+ *            there is no frame check to model.
+ */
+
+#ifndef HOST_AS5048B_MODEL_H_
+#define HOST_AS5048B_MODEL_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "AS5048B.h"
+#include "hal_stub.h"
+
+/* Configuration Constants --------------------------------------------------*/
+#define AS5048B_MODEL_DIAG_OCF       0x01U   /**< Offset compensation finished */
+#define AS5048B_MODEL_DIAG_COF       0x02U   /**< CORDIC overflow, angle invalid */
+#define AS5048B_MODEL_DIAG_COMP_LOW  0x04U   /**< Field too strong, AGC at minimum */
+#define AS5048B_MODEL_DIAG_COMP_HIGH 0x08U   /**< Field too weak, AGC at maximum */
+#define AS5048B_MODEL_MAGNITUDE      4000U   /**< Magnitude at nominal field */
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief One modelled encoder
+ */
+typedef struct {
+    uint8_t  address;       /**< 7-bit I2C address, 0 when absent */
+    uint16_t angle;         /**< Magnet angle, 14 bits */
+    uint16_t magnitude;     /**< CORDIC magnitude, 14 bits */
+    uint8_t  agc;           /**< Automatic gain control, 0..255 */
+    uint8_t  diag;          /**< Diagnostic flags */
+    uint8_t  reg[256];      /**< Writable registers */
+    uint32_t reads;         /**< Register read transfers */
+    uint32_t writes;        /**< Register write transfers */
+} As5048bModel_Device_t;
+
+/**
+ * @brief Encoders sharing the bus
+ */
+typedef struct {
+    As5048bModel_Device_t device[AS5048B_MAX_DEVICES];
+    HalStub_I2c_t bus;      /**< Handlers registered with the stub HAL */
+} As5048bModel_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Place one encoder per address on the bus, magnet centred (mid
+ *          AGC, compensation finished), and register the model as the I2C
+ *          handler
+ * @param   model       Pointer to model structure
+ * @param   addresses   7-bit addresses, AS5048B_MAX_DEVICES entries, 0 for
+ *                      an empty slot
+ */
+void As5048bModel_Attach(As5048bModel_t *model, const uint8_t *addresses);
+
+/**
+ * @brief   Move the magnet of one encoder to a new distance
+ * @details The AGC compensates field strengths from 1/4 to 4 times nominal
+ *          and keeps the magnitude at AS5048B_MODEL_MAGNITUDE. Outside that
+ *          range the AGC saturates, the matching COMP flag is raised and the
+ *          magnitude follows the field. Below 5 % of nominal the CORDIC
+ *          overflows.
+ * @param   dev         Encoder
+ * @param   field       Field strength relative to nominal (1.0)
+ */
+void As5048bModel_SetField(As5048bModel_Device_t *dev, float field);
+
+#endif /* HOST_AS5048B_MODEL_H_ */
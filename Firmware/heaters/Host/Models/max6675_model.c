@@ -0,0 +1,86 @@
+/**
+ * @file      max6675_model.c
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the MAX6675 thermocouple converters on SPI1
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "max6675_model.h"
+#include "hal_stub.h"
+
+/* Private functions --------------------------------------------------------*/
+static HAL_StatusTypeDef max6675_model_rx(void *ctx, uint8_t *data, uint16_t size)
+{
+    Max6675Model_t *model = (Max6675Model_t *)ctx;
+    GPIO_TypeDef *ports[] = MAX6675_CS_PORTS;
+    const uint16_t pins[] = MAX6675_CS_PINS;
+    Max6675Model_Device_t *selected = NULL;
+    uint8_t asserted = 0;
+    uint16_t frame = 0xFFFFU;
+
+    for (uint8_t i = 0; i < MAX6675_MAX_DEVICES; i++) {
+        if ((ports[i]->ODR & pins[i]) == 0U) {
+            selected = &model->device[i];
+            asserted++;
+        }
+    }
+
+    if (asserted == 1U) {
+        if (HAL_GetTick() - selected->start >= MAX6675_CONVERSION_MS) {
+            selected->result = Max6675Model_Frame(selected->temperature, selected->fault);
+        } else {
+            selected->aborted++;
+        }
+        frame = selected->result;
+        /* The next conversion starts when CS goes high again, right after */
+        selected->start = HAL_GetTick();
+        selected->frames++;
+    }
+
+    /* 16-bit data frame: one half-word per unit of size, little-endian */
+    for (uint16_t i = 0; i < size; i++) {
+        data[2U * i] = (uint8_t)(frame & 0xFFU);
+        data[2U * i + 1U] = (uint8_t)(frame >> 8);
+    }
+    return HAL_OK;
+}
+
+/* Public functions ---------------------------------------------------------*/
+void Max6675Model_Attach(Max6675Model_t *model, float temperature)
+{
+    for (uint8_t i = 0; i < MAX6675_MAX_DEVICES; i++) {
+        Max6675Model_Device_t *dev = &model->device[i];
+
+        dev->temperature = temperature;
+        dev->fault = MAX6675_MODEL_OK;
+        dev->result = Max6675Model_Frame(temperature, MAX6675_MODEL_OK);
+        dev->start = HAL_GetTick() - MAX6675_CONVERSION_MS;
+        dev->frames = 0;
+        dev->aborted = 0;
+    }
+    HalStub_SetSpi(max6675_model_rx, model);
+}
+
+uint16_t Max6675Model_Frame(float temperature, Max6675Model_Fault_t fault)
+{
+    float counts = temperature / MAX6675_TEMP_FACTOR;
+    uint16_t code;
+
+    switch (fault) {
+    case MAX6675_MODEL_MISO_HIGH:
+        return 0xFFFFU;
+    case MAX6675_MODEL_MISO_LOW:
+        return 0x0000U;
+    default:
+        break;
+    }
+
+    /* The converter truncates to whole counts */
+    counts = (counts < 0.0f) ? 0.0f : (counts > 4095.0f) ? 4095.0f : counts;
+    code = (uint16_t)((uint16_t)counts << 3);
+    if (fault == MAX6675_MODEL_OPEN) {
+        code |= MAX6675_INPUT_BIT;
+    }
+    return code;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file      max6675_model.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the MAX6675 thermocouple converters on SPI1
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Answers the 16-bit frames of HAL_SPI_Receive() for the device
+ *            whose chip select (CS_0..CS_3) is low in the GPIO ODR:
+ *
+ *              - D14..D3: temperature in 0.25 °C steps, 0..1023.75 °C
+ *              - D2: set when the thermocouple input is open
+ *              - D15, D1, D0: dummy, device ID and tri-state, always 0
+ *
+ *            A conversion takes MAX6675_CONVERSION_MS after chip select goes
+ *            high. Reading before that aborts it and the device answers the
+ *            previous result again, as the part does. With no chip select or
+ *            more than one low, MISO floats high and the frame is 0xFFFF.
+ *
+ * @note      Host builds only.
+ */
+
+#ifndef HOST_MAX6675_MODEL_H_
+#define HOST_MAX6675_MODEL_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "max6675.h"
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Fault injected on one device
+ */
+typedef enum {
+    MAX6675_MODEL_OK = 0,       /**< Thermocouple connected */
+    MAX6675_MODEL_OPEN,         /**< Thermocouple open, D2 set */
+    MAX6675_MODEL_MISO_HIGH,    /**< Device missing, MISO pulled high */
+    MAX6675_MODEL_MISO_LOW      /**< MISO shorted to ground */
+} Max6675Model_Fault_t;
+
+/**
+ * @brief One modelled converter
+ */
+typedef struct {
+    float    temperature;           /**< Hot junction temperature [°C] */
+    Max6675Model_Fault_t fault;     /**< Injected fault */
+    uint16_t result;                /**< Last completed conversion */
+    uint32_t start;                 /**< Tick the running conversion started */
+    uint32_t frames;                /**< Frames read */
+    uint32_t aborted;               /**< Conversions aborted by an early read */
+} Max6675Model_Device_t;
+
+/**
+ * @brief Converters sharing the bus
+ */
+typedef struct {
+    Max6675Model_Device_t device[MAX6675_MAX_DEVICES];
+} Max6675Model_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Reset every device to a completed conversion of its temperature
+ *          and register the model as the SPI handler
+ * @param   model       Pointer to model structure
+ * @param   temperature Initial temperature of every device [°C]
+ */
+void Max6675Model_Attach(Max6675Model_t *model, float temperature);
+
+/**
+ * @brief   Frame a device sends for a temperature and fault
+ * @param   temperature Hot junction temperature [°C]
+ * @param   fault       Injected fault
+ * @return  uint16_t    Frame, MSB first on the wire
+ */
+uint16_t Max6675Model_Frame(float temperature, Max6675Model_Fault_t fault);
+
+#endif /* HOST_MAX6675_MODEL_H_ */
@@ -0,0 +1,182 @@
+/**
+ * @file      zero_cross_model.c
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the zero-cross detector and firing timers
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "zero_cross_model.h"
+#include "hal_stub.h"
+#include <stddef.h>
+
+/**
+ * @brief Detector pulse level of the true mains signal
+ */
+static uint8_t model_pulse(const ZeroCrossModel_t *model, uint32_t t)
+{
+    uint32_t k = (t + model->half_cycle / 2U) / model->half_cycle;
+    uint32_t centre = k * model->half_cycle;
+    uint32_t distance = (t > centre) ? t - centre : centre - t;
+
+    if (k == 0 || distance >= model->width / 2U) {
+        return 0;
+    }
+    /* Pulse index k - 1 is centred on k half-cycles */
+    return (k - 1U < model->drop_first || k - 1U >= model->drop_first + model->drop_count);
+}
+
+/**
+ * @brief Detector output: true pulses and injected glitches
+ */
+static uint8_t model_glitch(const ZeroCrossModel_t *model, uint32_t t)
+{
+    for (uint32_t i = 0; i < model->glitches; i++) {
+        if (t >= model->glitch[i].start && t < model->glitch[i].start + model->glitch[i].width) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Compare a firing timer start with the nearest true rising edge
+ *
+ * @param start Model time the timer count 0 corresponds to [us]
+ */
+static void model_started(ZeroCrossModel_t *model, int32_t start)
+{
+    int32_t half = (int32_t)model->half_cycle;
+    int32_t k = (start + (int32_t)model->width / 2 + half / 2) / half;
+    int32_t error = start - (k * half - (int32_t)model->width / 2);
+
+    if (error < 0) {
+        error = -error;
+    }
+    model->starts++;
+    if (error > ZERO_CROSS_MODEL_PHASE_US) {
+        model->misfires++;
+    }
+    if (error > model->worst_phase) {
+        model->worst_phase = error;
+    }
+}
+
+/**
+ * @brief Start a model at time 0 with the detector low
+ *
+ * @param model      Pointer to model structure
+ * @param zc         Zero-cross timing
+ * @param half_cycle Mains half-cycle [us]
+ * @param width      Detector pulse width [us]
+ */
+void ZeroCrossModel_Init(ZeroCrossModel_t *model, ZeroCross_t *zc,
+                         uint32_t half_cycle, uint32_t width)
+{
+    model->zc = zc;
+    model->half_cycle = half_cycle;
+    model->width = width;
+    model->time = 0;
+    model->level = 0;
+    model->glitches = 0;
+    model->drop_first = 0;
+    model->drop_count = 0;
+    model->starts = 0;
+    model->glitch_starts = 0;
+    model->misfires = 0;
+    model->worst_phase = 0;
+    HalStub_SetInput(zero_crossig_GPIO_Port, zero_crossig_Pin, GPIO_PIN_RESET);
+}
+
+/**
+ * @brief Inject a glitch on the detector output
+ *
+ * @param model Pointer to model structure
+ * @param start Model time of the rising edge [us]
+ * @param width High time [us]
+ * @return HAL_StatusTypeDef HAL_OK if successful, HAL_ERROR otherwise
+ */
+HAL_StatusTypeDef ZeroCrossModel_AddGlitch(ZeroCrossModel_t *model, uint32_t start, uint32_t width)
+{
+    if (model->glitches >= ZERO_CROSS_MODEL_GLITCHES) {
+        return HAL_ERROR;
+    }
+    model->glitch[model->glitches].start = start;
+    model->glitch[model->glitches].width = width;
+    model->glitches++;
+    return HAL_OK;
+}
+
+/**
+ * @brief Suppress the detector pulses of consecutive half-cycles
+ *
+ * @param model Pointer to model structure
+ * @param first First pulse index to drop
+ * @param count Number of pulses to drop
+ */
+void ZeroCrossModel_Drop(ZeroCrossModel_t *model, uint32_t first, uint32_t count)
+{
+    model->drop_first = first;
+    model->drop_count = count;
+}
+
+/**
+ * @brief Run the model
+ *
+ * @param model    Pointer to model structure
+ * @param duration Time to run [us]
+ */
+void ZeroCrossModel_Run(ZeroCrossModel_t *model, uint32_t duration)
+{
+    ZeroCross_t *zc = model->zc;
+    TIM_TypeDef *tim = zc->htim->Instance;
+    TIM_TypeDef *fly = zc->htim_fly->Instance;
+    uint32_t end = model->time + duration;
+
+    for (; model->time < end; model->time++) {
+        uint32_t t = model->time;
+        uint8_t pulse = model_pulse(model, t);
+        uint8_t level = pulse || model_glitch(model, t);
+
+        /* Detector edge: hardware trigger first, then the EXTI handler */
+        if (level != model->level) {
+            model->level = level;
+            HalStub_SetInput(zero_crossig_GPIO_Port, zero_crossig_Pin,
+                             level ? GPIO_PIN_SET : GPIO_PIN_RESET);
+            if (level && (tim->SMCR & TIM_SMCR_SMS) == TIM_SLAVEMODE_TRIGGER &&
+                !(tim->CR1 & TIM_CR1_CEN)) {
+                tim->CR1 |= TIM_CR1_CEN;
+                tim->CNT = 0;
+                fly->CNT = 0;
+                model_started(model, (int32_t)t);
+                if (!pulse) {
+                    model->glitch_starts++;
+                }
+            }
+            ZeroCross_EdgeISR(zc);
+        }
+
+        /* Firing timer in one-pulse mode */
+        if (tim->CR1 & TIM_CR1_CEN) {
+            if (++tim->CNT > tim->ARR) {
+                tim->CNT = 0;
+                tim->CR1 &= ~TIM_CR1_CEN;
+            }
+        }
+
+        /* Flywheel timer compare events */
+        fly->CNT = (fly->CNT + 1U) & 0xFFFFU;
+        if ((fly->DIER & TIM_DIER_CC2IE) && fly->CNT == fly->CCR2) {
+            ZeroCross_WindowISR(zc);
+        }
+        if ((fly->DIER & TIM_DIER_CC1IE) && fly->CNT == fly->CCR1) {
+            uint32_t running = tim->CR1 & TIM_CR1_CEN;
+            ZeroCross_DeadlineISR(zc);
+            if (!running && (tim->CR1 & TIM_CR1_CEN)) {
+                model_started(model, (int32_t)t - (int32_t)tim->CNT);
+            }
+        }
+
+        DWT->CYCCNT += zc->cycles_per_us;
+    }
+}
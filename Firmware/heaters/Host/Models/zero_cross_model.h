@@ -0,0 +1,113 @@
+/**
+ * @file      zero_cross_model.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host model of the zero-cross detector and the firing timers, with
+ *            glitch injection
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Steps the board one microsecond at a time:
+ *
+ *              - the detector (PA1) outputs a pulse of the given width centred
+ *                on every mains zero crossing, plus the injected glitches, and
+ *                drops the pulses of the half-cycles asked for
+ *              - a rising edge starts TIM2 when its slave mode is trigger and
+ *                it is stopped, which resets TIM1 (TRGO), as the hardware does
+ *              - every detector edge runs ZeroCross_EdgeISR() (EXTI1)
+ *              - TIM2 counts to ARR and stops (one-pulse mode), TIM1 counts
+ *                freely and runs ZeroCross_WindowISR() and
+ *                ZeroCross_DeadlineISR() on its compare 2 and 1 events
+ *              - the DWT cycle counter advances with the model time
+ *
+ *            Every start of TIM2, by the detector or by the flywheel, is
+ *            compared with the true rising edge of the half-cycle it belongs
+ *            to. A start more than ZERO_CROSS_MODEL_PHASE_US away would fire
+ *            the TRIACs at the wrong phase.
+ *
+ *            Pulse k (k = 0, 1, ...) is centred on (k + 1) * half_cycle.
+ *
+ * @note      Host builds only. The TI2 input filter and the interrupt entry
+ *            latency are not modelled, every edge is seen at once.
+ */
+
+#ifndef HOST_ZERO_CROSS_MODEL_H_
+#define HOST_ZERO_CROSS_MODEL_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "zero_cross.h"
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Most glitches injected in one run
+ */
+#define ZERO_CROSS_MODEL_GLITCHES   64U
+
+/**
+ * @brief Largest timer start error still firing at the right phase [us]
+ */
+#define ZERO_CROSS_MODEL_PHASE_US   50
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Injected detector glitch
+ */
+typedef struct {
+    uint32_t start;     /**< Model time of the rising edge [us] */
+    uint32_t width;     /**< High time [us] */
+} ZeroCrossModel_Glitch_t;
+
+/**
+ * @brief Detector and timers model
+ */
+typedef struct {
+    ZeroCross_t *zc;            /**< Zero-cross timing under test */
+    uint32_t half_cycle;        /**< Mains half-cycle [us] */
+    uint32_t width;             /**< Detector pulse width [us] */
+    uint32_t time;              /**< Model time [us] */
+    uint8_t  level;             /**< Detector output */
+    ZeroCrossModel_Glitch_t glitch[ZERO_CROSS_MODEL_GLITCHES];
+    uint32_t glitches;          /**< Glitches injected */
+    uint32_t drop_first;        /**< First half-cycle without a pulse */
+    uint32_t drop_count;        /**< Half-cycles without a pulse */
+    uint32_t starts;            /**< TIM2 starts */
+    uint32_t glitch_starts;     /**< TIM2 started in hardware by a glitch */
+    uint32_t misfires;          /**< Starts away from the true edge */
+    int32_t  worst_phase;       /**< Largest start error [us] */
+} ZeroCrossModel_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Start a model at time 0 with the detector low
+ * @param   model       Pointer to model structure
+ * @param   zc          Zero-cross timing, ZeroCross_Init() done
+ * @param   half_cycle  Mains half-cycle [us]
+ * @param   width       Detector pulse width [us]
+ */
+void ZeroCrossModel_Init(ZeroCrossModel_t *model, ZeroCross_t *zc,
+                         uint32_t half_cycle, uint32_t width);
+
+/**
+ * @brief   Inject a glitch on the detector output
+ * @param   model       Pointer to model structure
+ * @param   start       Model time of the rising edge [us]
+ * @param   width       High time [us]
+ * @return  HAL_StatusTypeDef   HAL status (HAL_OK, HAL_ERROR when full)
+ */
+HAL_StatusTypeDef ZeroCrossModel_AddGlitch(ZeroCrossModel_t *model, uint32_t start, uint32_t width);
+
+/**
+ * @brief   Suppress the detector pulses of consecutive half-cycles
+ * @param   model       Pointer to model structure
+ * @param   first       First pulse index to drop
+ * @param   count       Number of pulses to drop
+ */
+void ZeroCrossModel_Drop(ZeroCrossModel_t *model, uint32_t first, uint32_t count);
+
+/**
+ * @brief   Run the model
+ * @param   model       Pointer to model structure
+ * @param   duration    Time to run [us]
+ */
+void ZeroCrossModel_Run(ZeroCrossModel_t *model, uint32_t duration);
+
+#endif /* HOST_ZERO_CROSS_MODEL_H_ */
@@ -0,0 +1,138 @@
+/**
+ * @file      hal_stub.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host-side controls of the stub HAL
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   What the tests and tools drive from outside the firmware
+ *            modules:
+ *
+ *              - Time: uwTick and the DWT cycle counter only move through
+ *                HalStub_Advance() (and the flash erase stall), so every run
+ *                is deterministic.
+ *              - Flash: 512 KB mapped at 0x08000000, erased to 0xFF at start.
+ *                Programming can only clear bits, as on the part, and the
+ *                area is read-only outside HAL_FLASH_Program() and
+ *                HAL_FLASHEx_Erase(). A sector erase advances the time by its
+ *                typical duration. HalStub_FlashPowerLoss() cuts the supply
+ *                after a number of programmed words: the next word is torn
+ *                and every later program or erase fails until it is cleared.
+ *              - Buses: SPI receives and I2C transfers go to the device model
+ *                callbacks registered here (Host/Models), HAL_ERROR without
+ *                one. GPIO writes land in ODR so a model can see its chip
+ *                select.
+ *
+ * @note      Host builds only.
+ */
+
+#ifndef HOST_HAL_STUB_H_
+#define HOST_HAL_STUB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief SPI receive handler of a device model
+ */
+typedef HAL_StatusTypeDef (*HalStub_SpiRx_t)(void *ctx, uint8_t *data, uint16_t size);
+
+/**
+ * @brief I2C register access handlers of a device model
+ */
+typedef struct {
+    HAL_StatusTypeDef (*read)(void *ctx, uint16_t address, uint16_t reg, uint8_t *data, uint16_t size);
+    HAL_StatusTypeDef (*write)(void *ctx, uint16_t address, uint16_t reg, const uint8_t *data, uint16_t size);
+    HAL_StatusTypeDef (*ready)(void *ctx, uint16_t address);
+    void *ctx;
+} HalStub_I2c_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Reset time, peripherals and bus handlers to power-on values
+ * @details The flash contents are kept (see HalStub_FlashWipe()), and RCC->CSR
+ *          reports a power-on reset.
+ */
+void HalStub_Reset(void);
+
+/**
+ * @brief   Advance uwTick and, when enabled, the DWT cycle counter
+ * @param   ms          Time to add [ms]
+ */
+void HalStub_Advance(uint32_t ms);
+
+/**
+ * @brief   Function run by __WFI(), e.g. to raise the next interrupt flag
+ * @param   hook        Handler, NULL for none
+ */
+void HalStub_SetWfiHook(void (*hook)(void));
+
+/**
+ * @brief   Erase the whole emulated flash and clear its counters
+ */
+void HalStub_FlashWipe(void);
+
+/**
+ * @brief   Cut the flash supply after a number of programmed words
+ * @param   words       Words still programmed correctly, -1 to restore power
+ */
+void HalStub_FlashPowerLoss(int32_t words);
+
+/**
+ * @brief   Sector erases since the last wipe
+ * @param   sector      FLASH_SECTOR_x
+ * @return  uint32_t    Erase count
+ */
+uint32_t HalStub_FlashErases(uint32_t sector);
+
+/**
+ * @brief   Words programmed since the last wipe
+ * @return  uint32_t    Program count
+ */
+uint32_t HalStub_FlashPrograms(void);
+
+/**
+ * @brief   Typical erase time of a sector (datasheet, x32 parallelism)
+ * @param   sector      FLASH_SECTOR_x
+ * @return  uint32_t    Erase time [ms]
+ */
+uint32_t HalStub_FlashEraseMs(uint32_t sector);
+
+/**
+ * @brief   Route HAL_SPI_Receive() to a device model
+ * @param   rx          Receive handler, NULL to detach
+ * @param   ctx         Passed to the handler
+ */
+void HalStub_SetSpi(HalStub_SpiRx_t rx, void *ctx);
+
+/**
+ * @brief   Route the I2C calls to a device model
+ * @param   bus         Handlers, NULL to detach
+ */
+void HalStub_SetI2c(const HalStub_I2c_t *bus);
+
+/**
+ * @brief   Drive an input pin
+ * @param   port        GPIO port
+ * @param   pin         GPIO_PIN_x
+ * @param   state       Level
+ */
+void HalStub_SetInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+
+/**
+ * @brief   Check whether an interrupt has been enabled in the NVIC
+ * @param   irq         Interrupt number
+ * @return  uint8_t     1 if enabled
+ */
+uint8_t HalStub_IrqEnabled(IRQn_Type irq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_HAL_STUB_H_ */
@@ -0,0 +1,16 @@
+/**
+ * @file      stm32f4xx.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host stand-in for the CMSIS device header
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @note      Host builds only, everything lives in the stub stm32f4xx_hal.h.
+ */
+
+#ifndef HOST_STM32F4XX_H_
+#define HOST_STM32F4XX_H_
+
+#include "stm32f4xx_hal.h"
+
+#endif /* HOST_STM32F4XX_H_ */
@@ -0,0 +1,340 @@
+/**
+ * @file      stm32f4xx_hal.h
+ * @author    Adrian Silva Palafox
+ * @brief     Host stand-in for the STM32F4 HAL and CMSIS device header
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Just enough of the HAL types, register blocks and calls used by
+ *            the Core modules to build them for the host. Peripherals are
+ *            plain structs in RAM; the internal flash is an emulated block
+ *            mapped at its STM32F411 address so the storage modules can read
+ *            it through pointers as on the target. Register bit values match
+ *            the reference manual. hal_stub.h has the host-side controls.
+ *
+ * @note      Host builds only, selected by the include path of Host/CMakeLists.txt.
+ */
+
+#ifndef HOST_STM32F4XX_HAL_H_
+#define HOST_STM32F4XX_HAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/* Core ----------------------------------------------------------------------*/
+#define __IO    volatile
+#define __I     volatile const
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    SysTick_IRQn = -1,
+    EXTI0_IRQn = 6,
+    EXTI1_IRQn = 7,
+    TIM1_CC_IRQn = 27,
+    TIM2_IRQn = 28,
+    TIM3_IRQn = 29,
+    HOST_IRQS = 32
+} IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+extern __IO uint32_t uwTick;
+
+void HalStub_Wfi(void);
+
+#define __disable_irq()     ((void)0)
+#define __enable_irq()      ((void)0)
+#define __DSB()             ((void)0)
+#define __NOP()             ((void)0)
+#define __WFI()             HalStub_Wfi()
+
+/* Register blocks -----------------------------------------------------------*/
+typedef struct {
+    __IO uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR,
+                  RCR, CCR1, CCR2, CCR3, CCR4, BDTR, DCR, DMAR, OR;
+} TIM_TypeDef;
+
+typedef struct {
+    __IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2];
+} GPIO_TypeDef;
+
+typedef struct {
+    __IO uint32_t KR, PR, RLR, SR;
+} IWDG_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR, PLLCFGR, CFGR, CIR, AHB1RSTR, AHB2RSTR, APB1RSTR, APB2RSTR,
+                  AHB1ENR, AHB2ENR, APB1ENR, APB2ENR, BDCR, CSR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t ACR, KEYR, OPTKEYR, SR, CR, OPTCR;
+} FLASH_TypeDef;
+
+typedef struct {
+    __IO uint32_t IMR, EMR, RTSR, FTSR, SWIER, PR;
+} EXTI_TypeDef;
+
+typedef struct {
+    __IO uint32_t MEMRMP, PMC, EXTICR[4], CMPCR;
+} SYSCFG_TypeDef;
+
+typedef struct {
+    __IO uint32_t IDCODE, CR, APB1FZ, APB2FZ;
+} DBGMCU_TypeDef;
+
+typedef struct {
+    __IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    __IO uint32_t CPUID, ICSR, VTOR, AIRCR, SCR, CCR, CPACR;
+} SCB_Type;
+
+typedef struct {
+    __IO uint32_t CTRL, LOAD, VAL, CALIB;
+} SysTick_Type;
+
+typedef struct {
+    uint32_t dummy;
+} SPI_TypeDef;
+
+typedef struct {
+    uint32_t dummy;
+} I2C_TypeDef;
+
+extern TIM_TypeDef HalStub_TIM1, HalStub_TIM2, HalStub_TIM3;
+extern GPIO_TypeDef HalStub_GPIOA, HalStub_GPIOB, HalStub_GPIOC, HalStub_GPIOH;
+extern IWDG_TypeDef HalStub_IWDG;
+extern RCC_TypeDef HalStub_RCC;
+extern FLASH_TypeDef HalStub_FLASH;
+extern EXTI_TypeDef HalStub_EXTI;
+extern SYSCFG_TypeDef HalStub_SYSCFG;
+extern DBGMCU_TypeDef HalStub_DBGMCU;
+extern DWT_Type HalStub_DWT;
+extern CoreDebug_Type HalStub_CoreDebug;
+extern SCB_Type HalStub_SCB;
+extern SysTick_Type HalStub_SysTick;
+extern SPI_TypeDef HalStub_SPI1;
+extern I2C_TypeDef HalStub_I2C1;
+
+#define TIM1        (&HalStub_TIM1)
+#define TIM2        (&HalStub_TIM2)
+#define TIM3        (&HalStub_TIM3)
+#define GPIOA       (&HalStub_GPIOA)
+#define GPIOB       (&HalStub_GPIOB)
+#define GPIOC       (&HalStub_GPIOC)
+#define GPIOH       (&HalStub_GPIOH)
+#define IWDG        (&HalStub_IWDG)
+#define RCC         (&HalStub_RCC)
+#define FLASH       (&HalStub_FLASH)
+#define EXTI        (&HalStub_EXTI)
+#define SYSCFG      (&HalStub_SYSCFG)
+#define DBGMCU      (&HalStub_DBGMCU)
+#define DWT         (&HalStub_DWT)
+#define CoreDebug   (&HalStub_CoreDebug)
+#define SCB         (&HalStub_SCB)
+#define SysTick     (&HalStub_SysTick)
+#define SPI1        (&HalStub_SPI1)
+#define I2C1        (&HalStub_I2C1)
+
+/* Register bits -------------------------------------------------------------*/
+#define TIM_CR1_CEN                 0x0001U
+#define TIM_CR1_CKD_Pos             8U
+#define TIM_CR1_CKD                 (0x3U << TIM_CR1_CKD_Pos)
+#define TIM_CR2_MMS                 0x0070U
+#define TIM_CR2_MMS_0               0x0010U
+#define TIM_SMCR_SMS                0x0007U
+#define TIM_SMCR_TS                 0x0070U
+#define TIM_DIER_UIE                0x0001U
+#define TIM_DIER_CC1IE              0x0002U
+#define TIM_DIER_CC2IE              0x0004U
+#define TIM_SR_UIF                  0x0001U
+#define TIM_SR_CC1IF                0x0002U
+#define TIM_EGR_UG                  0x0001U
+#define TIM_CCMR1_OC1M              0x0070U
+#define TIM_CCMR1_OC1M_2            0x0040U
+#define TIM_CCMR1_IC2F_Pos          12U
+#define TIM_CCMR1_IC2F              (0xFU << TIM_CCMR1_IC2F_Pos)
+#define TIM_CCMR2_OC3M              0x0070U
+#define TIM_CCMR2_OC3M_2            0x0040U
+#define TIM_CCMR2_OC4M              0x7000U
+#define TIM_CCMR2_OC4M_2            0x4000U
+
+#define RCC_CFGR_PPRE1              0x00001C00U
+#define RCC_CFGR_PPRE1_DIV1         0x00000000U
+#define RCC_CFGR_PPRE1_DIV2         0x00001000U
+#define RCC_CFGR_PPRE2              0x0000E000U
+#define RCC_CFGR_PPRE2_DIV1         0x00000000U
+#define RCC_CSR_RMVF                (1U << 24)
+#define RCC_CSR_BORRSTF             (1U << 25)
+#define RCC_CSR_PINRSTF             (1U << 26)
+#define RCC_CSR_PORRSTF             (1U << 27)
+#define RCC_CSR_SFTRSTF             (1U << 28)
+#define RCC_CSR_IWDGRSTF            (1U << 29)
+
+#define FLASH_ACR_DCEN              (1U << 10)
+#define FLASH_ACR_DCRST             (1U << 12)
+
+#define SYSCFG_EXTICR1_EXTI0        0x000FU
+#define SYSCFG_EXTICR1_EXTI1        0x00F0U
+
+#define DBGMCU_APB1_FZ_DBG_IWDG_STOP    (1U << 12)
+
+#define DWT_CTRL_CYCCNTENA_Msk          (1U << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1U << 24)
+#define SCB_ICSR_ISRPENDING_Msk         (1U << 22)
+#define SCB_ICSR_PENDSTSET_Msk          (1U << 26)
+
+/* GPIO ----------------------------------------------------------------------*/
+#define GPIO_PIN_0      ((uint16_t)0x0001)
+#define GPIO_PIN_1      ((uint16_t)0x0002)
+#define GPIO_PIN_2      ((uint16_t)0x0004)
+#define GPIO_PIN_3      ((uint16_t)0x0008)
+#define GPIO_PIN_7      ((uint16_t)0x0080)
+#define GPIO_PIN_13     ((uint16_t)0x2000)
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/* Timers --------------------------------------------------------------------*/
+#define TIM_CHANNEL_1               0x00000000U
+#define TIM_CHANNEL_2               0x00000004U
+#define TIM_CHANNEL_3               0x00000008U
+#define TIM_CHANNEL_4               0x0000000CU
+#define TIM_OCMODE_TIMING           0x00000000U
+#define TIM_OCMODE_PWM1             0x00000060U
+#define TIM_OCMODE_PWM2             0x00000070U
+#define TIM_OCPOLARITY_HIGH         0x00000000U
+#define TIM_OCFAST_DISABLE          0x00000000U
+#define TIM_SLAVEMODE_DISABLE       0x00000000U
+#define TIM_SLAVEMODE_RESET         0x00000004U
+#define TIM_SLAVEMODE_TRIGGER       0x00000006U
+#define TIM_TS_ITR1                 0x00000010U
+#define TIM_TS_TI2FP2               0x00000060U
+
+typedef struct {
+    uint32_t Prescaler;
+    uint32_t Period;
+} TIM_Base_InitTypeDef;
+
+typedef struct {
+    TIM_TypeDef *Instance;
+    TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+typedef struct {
+    uint32_t OCMode;
+    uint32_t Pulse;
+    uint32_t OCPolarity;
+    uint32_t OCNPolarity;
+    uint32_t OCFastMode;
+    uint32_t OCIdleState;
+    uint32_t OCNIdleState;
+} TIM_OC_InitTypeDef;
+
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+    (*(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)) = (__COMPARE__))
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__) \
+    (*(&((__HANDLE__)->Instance->CCR1) + ((__CHANNEL__) >> 2U)))
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__)    ((__HANDLE__)->Instance->ARR)
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig,
+                                            uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+
+/* SPI / I2C -----------------------------------------------------------------*/
+#define I2C_MEMADD_SIZE_8BIT        0x00000001U
+
+typedef struct {
+    SPI_TypeDef *Instance;
+} SPI_HandleTypeDef;
+
+typedef struct {
+    I2C_TypeDef *Instance;
+} I2C_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout);
+
+/* Flash ---------------------------------------------------------------------*/
+#define FLASH_BASE                  0x08000000U
+#define FLASH_SIZE                  0x00080000U
+#define FLASH_SECTOR_0              0U
+#define FLASH_SECTOR_1              1U
+#define FLASH_SECTOR_2              2U
+#define FLASH_SECTOR_3              3U
+#define FLASH_SECTOR_4              4U
+#define FLASH_SECTOR_5              5U
+#define FLASH_SECTOR_6              6U
+#define FLASH_SECTOR_7              7U
+#define FLASH_SECTOR_TOTAL          8U
+#define FLASH_TYPEERASE_SECTORS     0x00000000U
+#define FLASH_TYPEPROGRAM_WORD      0x00000002U
+#define FLASH_VOLTAGE_RANGE_3       0x00000002U
+#define FLASH_FLAG_EOP              0x00000001U
+#define FLASH_FLAG_OPERR            0x00000002U
+#define FLASH_FLAG_WRPERR           0x00000010U
+#define FLASH_FLAG_PGAERR           0x00000020U
+#define FLASH_FLAG_PGPERR           0x00000040U
+#define FLASH_FLAG_PGSERR           0x00000080U
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t Sector;
+    uint32_t NbSectors;
+    uint32_t VoltageRange;
+} FLASH_EraseInitTypeDef;
+
+#define __HAL_FLASH_CLEAR_FLAG(__FLAG__)    (FLASH->SR = (__FLAG__))
+#define __HAL_FLASH_DATA_CACHE_DISABLE()    (FLASH->ACR &= ~FLASH_ACR_DCEN)
+#define __HAL_FLASH_DATA_CACHE_ENABLE()     (FLASH->ACR |= FLASH_ACR_DCEN)
+#define __HAL_FLASH_DATA_CACHE_RESET()      ((void)0)
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError);
+
+/* System --------------------------------------------------------------------*/
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+void HAL_SuspendTick(void);
+void HAL_ResumeTick(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STM32F4XX_HAL_H_ */
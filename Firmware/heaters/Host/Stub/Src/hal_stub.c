@@ -0,0 +1,407 @@
+/**
+ * @file      hal_stub.c
+ * @author    Adrian Silva Palafox
+ * @brief     Host stand-in for the STM32F4 HAL implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#define _GNU_SOURCE
+#include "hal_stub.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+/* Private constants --------------------------------------------------------*/
+static const uint32_t sector_base[FLASH_SECTOR_TOTAL] = {
+    0x08000000U, 0x08004000U, 0x08008000U, 0x0800C000U,
+    0x08010000U, 0x08020000U, 0x08040000U, 0x08060000U,
+};
+static const uint32_t sector_size[FLASH_SECTOR_TOTAL] = {
+    0x4000U, 0x4000U, 0x4000U, 0x4000U,
+    0x10000U, 0x20000U, 0x20000U, 0x20000U,
+};
+
+/* Peripherals and core state -----------------------------------------------*/
+uint32_t SystemCoreClock = 100000000U;
+__IO uint32_t uwTick;
+
+TIM_TypeDef HalStub_TIM1, HalStub_TIM2, HalStub_TIM3;
+GPIO_TypeDef HalStub_GPIOA, HalStub_GPIOB, HalStub_GPIOC, HalStub_GPIOH;
+IWDG_TypeDef HalStub_IWDG;
+RCC_TypeDef HalStub_RCC;
+FLASH_TypeDef HalStub_FLASH;
+EXTI_TypeDef HalStub_EXTI;
+SYSCFG_TypeDef HalStub_SYSCFG;
+DBGMCU_TypeDef HalStub_DBGMCU;
+DWT_Type HalStub_DWT;
+CoreDebug_Type HalStub_CoreDebug;
+SCB_Type HalStub_SCB;
+SysTick_Type HalStub_SysTick;
+SPI_TypeDef HalStub_SPI1;
+I2C_TypeDef HalStub_I2C1;
+
+static uint8_t *flash;
+static int32_t flash_power = -1;
+static uint8_t flash_dead;
+static uint32_t flash_erases[FLASH_SECTOR_TOTAL];
+static uint32_t flash_programs;
+static uint8_t irq_enabled[HOST_IRQS];
+static void (*wfi_hook)(void);
+static HalStub_SpiRx_t spi_rx;
+static void *spi_ctx;
+static HalStub_I2c_t i2c_bus;
+
+/* Private helpers ----------------------------------------------------------*/
+static void flash_writable(uint8_t writable)
+{
+    mprotect(flash, FLASH_SIZE, writable ? (PROT_READ | PROT_WRITE) : PROT_READ);
+}
+
+/**
+ * @brief Map the flash at its target address before any test runs
+ */
+__attribute__((constructor)) static void hal_stub_flash_map(void)
+{
+    void *area = mmap((void *)(uintptr_t)FLASH_BASE, FLASH_SIZE, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (area != (void *)(uintptr_t)FLASH_BASE) {
+        fprintf(stderr, "hal_stub: cannot map the flash at 0x%08X\n", FLASH_BASE);
+        abort();
+    }
+    flash = area;
+    HalStub_FlashWipe();
+    HalStub_Reset();
+}
+
+/* Host controls ------------------------------------------------------------*/
+void HalStub_Reset(void)
+{
+    uwTick = 0;
+    memset(&HalStub_TIM1, 0, sizeof(TIM_TypeDef));
+    memset(&HalStub_TIM2, 0, sizeof(TIM_TypeDef));
+    memset(&HalStub_TIM3, 0, sizeof(TIM_TypeDef));
+    memset(&HalStub_GPIOA, 0, sizeof(GPIO_TypeDef));
+    memset(&HalStub_GPIOB, 0, sizeof(GPIO_TypeDef));
+    memset(&HalStub_GPIOC, 0, sizeof(GPIO_TypeDef));
+    memset(&HalStub_GPIOH, 0, sizeof(GPIO_TypeDef));
+    memset(&HalStub_IWDG, 0, sizeof(IWDG_TypeDef));
+    memset(&HalStub_RCC, 0, sizeof(RCC_TypeDef));
+    memset(&HalStub_EXTI, 0, sizeof(EXTI_TypeDef));
+    memset(&HalStub_SYSCFG, 0, sizeof(SYSCFG_TypeDef));
+    memset(&HalStub_DBGMCU, 0, sizeof(DBGMCU_TypeDef));
+    memset(&HalStub_DWT, 0, sizeof(DWT_Type));
+    memset(&HalStub_CoreDebug, 0, sizeof(CoreDebug_Type));
+    memset(&HalStub_SCB, 0, sizeof(SCB_Type));
+    memset(&HalStub_SysTick, 0, sizeof(SysTick_Type));
+    memset(irq_enabled, 0, sizeof(irq_enabled));
+
+    /* SystemClock_Config(): APB1 at HCLK / 2, APB2 at HCLK */
+    HalStub_RCC.CFGR = RCC_CFGR_PPRE1_DIV2;
+    HalStub_RCC.CSR = RCC_CSR_PORRSTF | RCC_CSR_PINRSTF;
+    HalStub_FLASH.ACR = FLASH_ACR_DCEN;
+    HalStub_SysTick.LOAD = SystemCoreClock / 1000U - 1U;
+    HalStub_SysTick.VAL = HalStub_SysTick.LOAD;
+    /* Detector and gate inputs idle low */
+    HalStub_GPIOA.IDR = 0;
+
+    wfi_hook = NULL;
+    spi_rx = NULL;
+    spi_ctx = NULL;
+    memset(&i2c_bus, 0, sizeof(i2c_bus));
+}
+
+void HalStub_Advance(uint32_t ms)
+{
+    uwTick += ms;
+    if (HalStub_DWT.CTRL & DWT_CTRL_CYCCNTENA_Msk) {
+        HalStub_DWT.CYCCNT += ms * (SystemCoreClock / 1000U);
+    }
+}
+
+void HalStub_SetWfiHook(void (*hook)(void))
+{
+    wfi_hook = hook;
+}
+
+void HalStub_Wfi(void)
+{
+    if (wfi_hook != NULL) {
+        wfi_hook();
+    }
+}
+
+void HalStub_FlashWipe(void)
+{
+    flash_writable(1);
+    memset(flash, 0xFF, FLASH_SIZE);
+    flash_writable(0);
+    memset(flash_erases, 0, sizeof(flash_erases));
+    flash_programs = 0;
+    flash_power = -1;
+    flash_dead = 0;
+}
+
+void HalStub_FlashPowerLoss(int32_t words)
+{
+    flash_power = words;
+    flash_dead = 0;
+}
+
+uint32_t HalStub_FlashErases(uint32_t sector)
+{
+    return (sector < FLASH_SECTOR_TOTAL) ? flash_erases[sector] : 0;
+}
+
+uint32_t HalStub_FlashPrograms(void)
+{
+    return flash_programs;
+}
+
+uint32_t HalStub_FlashEraseMs(uint32_t sector)
+{
+    /* RM0383 / DS10314: 16 KB 250 ms, 64 KB 550 ms, 128 KB 1 s typical */
+    if (sector >= FLASH_SECTOR_TOTAL) {
+        return 0;
+    }
+    return sector_size[sector] == 0x4000U ? 250U : (sector_size[sector] == 0x10000U ? 550U : 1000U);
+}
+
+void HalStub_SetSpi(HalStub_SpiRx_t rx, void *ctx)
+{
+    spi_rx = rx;
+    spi_ctx = ctx;
+}
+
+void HalStub_SetI2c(const HalStub_I2c_t *bus)
+{
+    if (bus != NULL) {
+        i2c_bus = *bus;
+    } else {
+        memset(&i2c_bus, 0, sizeof(i2c_bus));
+    }
+}
+
+void HalStub_SetInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    if (state == GPIO_PIN_SET) {
+        port->IDR |= pin;
+    } else {
+        port->IDR &= ~(uint32_t)pin;
+    }
+}
+
+uint8_t HalStub_IrqEnabled(IRQn_Type irq)
+{
+    return (irq >= 0 && irq < HOST_IRQS) ? irq_enabled[irq] : 0;
+}
+
+/* GPIO ---------------------------------------------------------------------*/
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState == GPIO_PIN_SET) {
+        GPIOx->ODR |= GPIO_Pin;
+    } else {
+        GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* Timers -------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, const TIM_OC_InitTypeDef *sConfig,
+                                            uint32_t Channel)
+{
+    __IO uint32_t *ccmr = (Channel < TIM_CHANNEL_3) ? &htim->Instance->CCMR1 : &htim->Instance->CCMR2;
+    uint32_t shift = (Channel & TIM_CHANNEL_2) ? 8U : 0U;
+
+    if (Channel > TIM_CHANNEL_4) {
+        return HAL_ERROR;
+    }
+    *ccmr = (*ccmr & ~(0x70U << shift)) | (sConfig->OCMode << shift);
+    __HAL_TIM_SET_COMPARE(htim, Channel, sConfig->Pulse);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    htim->Instance->CCER |= 1U << Channel;
+    /* A timer in trigger mode is started by its trigger */
+    if ((htim->Instance->SMCR & TIM_SMCR_SMS) != TIM_SLAVEMODE_TRIGGER) {
+        htim->Instance->CR1 |= TIM_CR1_CEN;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+    htim->Instance->DIER |= TIM_DIER_UIE;
+    htim->Instance->CR1 |= TIM_CR1_CEN;
+    return HAL_OK;
+}
+
+/* SPI / I2C ----------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)hspi;
+    (void)Timeout;
+    return (spi_rx != NULL) ? spi_rx(spi_ctx, pData, Size) : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)hi2c;
+    (void)MemAddSize;
+    (void)Timeout;
+    return (i2c_bus.read != NULL) ? i2c_bus.read(i2c_bus.ctx, DevAddress, MemAddress, pData, Size)
+                                  : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void)hi2c;
+    (void)MemAddSize;
+    (void)Timeout;
+    return (i2c_bus.write != NULL) ? i2c_bus.write(i2c_bus.ctx, DevAddress, MemAddress, pData, Size)
+                                   : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout)
+{
+    (void)hi2c;
+    (void)Trials;
+    (void)Timeout;
+    return (i2c_bus.ready != NULL) ? i2c_bus.ready(i2c_bus.ctx, DevAddress) : HAL_ERROR;
+}
+
+/* Flash --------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+    uint32_t word = (uint32_t)Data;
+    uint32_t old;
+
+    if (TypeProgram != FLASH_TYPEPROGRAM_WORD || (Address & 0x3U) ||
+        Address < FLASH_BASE || Address + 4U > FLASH_BASE + FLASH_SIZE) {
+        return HAL_ERROR;
+    }
+    if (flash_dead) {
+        return HAL_ERROR;
+    }
+
+    memcpy(&old, flash + (Address - FLASH_BASE), 4);
+    /* Supply lost during this word: only the low half-word made it */
+    if (flash_power == 0) {
+        word |= 0xFFFF0000U;
+        flash_dead = 1;
+    }
+    /* Programming can only clear bits */
+    word &= old;
+    flash_writable(1);
+    memcpy(flash + (Address - FLASH_BASE), &word, 4);
+    flash_writable(0);
+    flash_programs++;
+
+    if (flash_dead) {
+        return HAL_ERROR;
+    }
+    if (flash_power > 0) {
+        flash_power--;
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError)
+{
+    *SectorError = 0xFFFFFFFFU;
+    if (pEraseInit->TypeErase != FLASH_TYPEERASE_SECTORS) {
+        return HAL_ERROR;
+    }
+
+    for (uint32_t s = pEraseInit->Sector; s < pEraseInit->Sector + pEraseInit->NbSectors; s++) {
+        if (s >= FLASH_SECTOR_TOTAL || flash_dead || flash_power == 0) {
+            /* An interrupted erase leaves the sector in an undefined state */
+            flash_dead = 1;
+            *SectorError = s;
+            return HAL_ERROR;
+        }
+        flash_writable(1);
+        memset(flash + (sector_base[s] - FLASH_BASE), 0xFF, sector_size[s]);
+        flash_writable(0);
+        flash_erases[s]++;
+        /* The CPU stalls on the flash for the whole erase */
+        HalStub_Advance(HalStub_FlashEraseMs(s));
+    }
+    return HAL_OK;
+}
+
+/* System -------------------------------------------------------------------*/
+uint32_t HAL_GetTick(void)
+{
+    return uwTick;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    HalStub_Advance(Delay);
+}
+
+void HAL_SuspendTick(void)
+{
+}
+
+void HAL_ResumeTick(void)
+{
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return (HalStub_RCC.CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1 ? SystemCoreClock : SystemCoreClock / 2U;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return SystemCoreClock;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    (void)IRQn;
+    (void)PreemptPriority;
+    (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    if (IRQn >= 0 && IRQn < HOST_IRQS) {
+        irq_enabled[IRQn] = 1;
+    }
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    if (IRQn >= 0 && IRQn < HOST_IRQS) {
+        irq_enabled[IRQn] = 0;
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * @file      test.h
+ * @author    Adrian Silva Palafox
+ * @brief     Minimal assertion helpers for the host unit tests
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Each test file is one executable: TEST_RUN() calls a test
+ *            function and TEST_EXIT() returns the number of failed checks, so
+ *            ctest reports the file as failed when any check fails. A failed
+ *            check prints its location and carries on with the next one.
+ *
+ * @note      Host builds only.
+ */
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+#include <math.h>
+#include <stdio.h>
+
+static int test_failures;
+
+#define TEST_CHECK(cond)                                                        \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);    \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+#define TEST_NEAR(actual, expected, tol)                                        \
+    do {                                                                        \
+        double a_ = (double)(actual);                                           \
+        double e_ = (double)(expected);                                         \
+        if (!(fabs(a_ - e_) <= (double)(tol))) {                                \
+            printf("%s:%d: %s = %g, expected %g +/- %g\n", __FILE__, __LINE__, \
+                   #actual, a_, e_, (double)(tol));                             \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+#define TEST_RUN(fn)                                                            \
+    do {                                                                        \
+        int before_ = test_failures;                                            \
+        fn();                                                                   \
+        printf("%s %s\n", test_failures == before_ ? "PASS" : "FAIL", #fn);    \
+    } while (0)
+
+#define TEST_EXIT()     return test_failures ? 1 : 0
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,106 @@
+/**
+ * @file      test_as5048b.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the AS5048B driver against the device model
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "AS5048B.h"
+#include "as5048b_model.h"
+#include "test.h"
+
+static I2C_HandleTypeDef hi2c;
+static As5048bModel_t model;
+static const uint8_t addresses[AS5048B_MAX_DEVICES] = { AS5048B_DEFAULT_ADDR, AS5048B_DEFAULT_ADDR + 1 };
+
+static void as5048b_setup(AS5048B_Driver_t *driver)
+{
+    HalStub_Reset();
+    As5048bModel_Attach(&model, addresses);
+    AS5048B_Init(driver, &hi2c);
+}
+
+static void test_angle_and_zero(void)
+{
+    AS5048B_Driver_t driver;
+
+    as5048b_setup(&driver);
+    TEST_CHECK(AS5048B_AddDevice(&driver, 0, AS5048B_DEFAULT_ADDR) == HAL_OK);
+    TEST_CHECK(AS5048B_AddDevice(&driver, 1, AS5048B_DEFAULT_ADDR + 1) == HAL_OK);
+
+    model.device[0].angle = 0x1234;
+    model.device[1].angle = 4096;
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 0), 0x1234 * 360.0f / 16384.0f, 1e-4f);
+    TEST_CHECK(AS5048B_GetRawAngle(&driver, 0) == 0x1234);
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 1), 90.0f, 1e-4f);
+
+    /* The current position becomes zero, later moves read from there */
+    TEST_CHECK(AS5048B_SetZeroPosition(&driver, 1) == HAL_OK);
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 1), 0.0f, 0.0f);
+    model.device[1].angle = 4096 - 1024;
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 1), 360.0f - 22.5f, 1e-3f);
+
+    TEST_CHECK(AS5048B_WriteZeroPosition(&driver, 0, 0x0234) == HAL_OK);
+    TEST_CHECK(model.device[0].reg[REG_ZERO_POS_HIGH] == 0x08 && model.device[0].reg[REG_ZERO_POS_LOW] == 0x34);
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 0), 0x1000 * 360.0f / 16384.0f, 1e-4f);
+}
+
+static void test_magnitude_and_diagnostics(void)
+{
+    AS5048B_Driver_t driver;
+
+    as5048b_setup(&driver);
+    TEST_CHECK(AS5048B_AddDevice(&driver, 0, AS5048B_DEFAULT_ADDR) == HAL_OK);
+
+    /* Magnet in range: the AGC holds the magnitude, only OCF is set */
+    TEST_CHECK(AS5048B_GetMagnitude(&driver, 0) == AS5048B_MODEL_MAGNITUDE);
+    TEST_CHECK(AS5048B_CheckDiagnostics(&driver, 0) == AS5048B_MODEL_DIAG_OCF);
+    TEST_CHECK(driver.devices[0].registers.automatic_gain_control == 128);
+    As5048bModel_SetField(&model.device[0], 2.0f);
+    TEST_CHECK(AS5048B_GetMagnitude(&driver, 0) == AS5048B_MODEL_MAGNITUDE);
+    TEST_CHECK(driver.devices[0].registers.automatic_gain_control == 64);
+
+    /* Magnet too far: AGC at maximum, COMP high, magnitude drops */
+    As5048bModel_SetField(&model.device[0], 0.125f);
+    TEST_CHECK(AS5048B_GetMagnitude(&driver, 0) == AS5048B_MODEL_MAGNITUDE / 2);
+    TEST_CHECK(AS5048B_CheckDiagnostics(&driver, 0) == (AS5048B_MODEL_DIAG_OCF | AS5048B_MODEL_DIAG_COMP_HIGH));
+    TEST_CHECK(driver.devices[0].registers.automatic_gain_control == 255);
+
+    /* Magnet too close: AGC at minimum, COMP low */
+    As5048bModel_SetField(&model.device[0], 8.0f);
+    TEST_CHECK(AS5048B_CheckDiagnostics(&driver, 0) == (AS5048B_MODEL_DIAG_OCF | AS5048B_MODEL_DIAG_COMP_LOW));
+    TEST_CHECK(AS5048B_GetMagnitude(&driver, 0) == 2 * AS5048B_MODEL_MAGNITUDE);
+
+    /* Magnet lost: the CORDIC overflows and the angle is not valid */
+    As5048bModel_SetField(&model.device[0], 0.01f);
+    TEST_CHECK(AS5048B_CheckDiagnostics(&driver, 0) & AS5048B_MODEL_DIAG_COF);
+}
+
+static void test_missing_device(void)
+{
+    AS5048B_Driver_t driver;
+
+    as5048b_setup(&driver);
+    /* No encoder answers 0x48: NACK on the probe and on every transfer */
+    TEST_CHECK(AS5048B_AddDevice(&driver, 0, 0x48) == HAL_ERROR);
+    TEST_NEAR(AS5048B_GetAngleDegrees(&driver, 0), -1.0f, 0.0f);
+    TEST_CHECK(AS5048B_UpdateRegisters(&driver, 0) != HAL_OK);
+    TEST_CHECK(AS5048B_SetZeroPosition(&driver, 0) == HAL_ERROR);
+    TEST_CHECK(AS5048B_AddDevice(&driver, 1, AS5048B_DEFAULT_ADDR) == HAL_OK);
+
+    /* The bus scan finds both encoders in address order */
+    driver.devices[0].dev_id = 0;
+    driver.devices[1].dev_id = 0;
+    find_dev_id_address(&driver);
+    TEST_CHECK(driver.devices[0].dev_id == (AS5048B_DEFAULT_ADDR << 1));
+    TEST_CHECK(driver.devices[1].dev_id == ((AS5048B_DEFAULT_ADDR + 1) << 1));
+}
+
+int main(void)
+{
+    TEST_RUN(test_angle_and_zero);
+    TEST_RUN(test_magnitude_and_diagnostics);
+    TEST_RUN(test_missing_device);
+    TEST_EXIT();
+}
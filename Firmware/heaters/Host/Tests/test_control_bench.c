@@ -0,0 +1,93 @@
+/**
+ * @file      test_control_bench.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the closed-loop control bench
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "control_bench.h"
+#include "test.h"
+
+#include <string.h>
+
+static void bench_setup(Heaters_t *heaters, ThermalModel_t *model)
+{
+    static const ThermalModel_Zone_t zone = { 2000.0f, 1.5f, 400.0f, 5.0f };
+
+    Heaters_Init(heaters, 0.25f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(heaters, z, 8.0f, 0.02f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        model->zone[z] = zone;
+        model->disturbance[z] = 0.0f;
+        model->dead_time[z] = 0.0f;
+    }
+    model->coupling[0] = 1.0f;
+    model->coupling[1] = 1.0f;
+    model->ambient = 25.0f;
+}
+
+static void test_cold_start_settles(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    ControlBench_Result_t result;
+
+    bench_setup(&heaters, &model);
+    ControlBench_Run(&result, CONTROL_BENCH_COLD_START, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        TEST_CHECK(result.zone[z].rise_time > 0.0f);
+        TEST_CHECK(ControlMetrics_IsSettled(&result.zone[z], 1200.0f));
+        TEST_NEAR(model.tc_temp[z], 200.0f, CONTROL_BENCH_BAND);
+    }
+    TEST_CHECK(result.cycles_max == 0);
+}
+
+static void test_pellet_feed_disturbs_zone0(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    ControlBench_Result_t result;
+
+    bench_setup(&heaters, &model);
+    ControlBench_Run(&result, CONTROL_BENCH_PELLET_FEED, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    TEST_CHECK(result.zone[0].max_error > result.zone[2].max_error);
+    TEST_CHECK(result.zone[0].max_error > 1.0f);
+}
+
+static uint32_t fake_cycles(void)
+{
+    static uint32_t now;
+    return now += 100U;
+}
+
+static void test_csv_format(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    ControlBench_Result_t result;
+    char line[160];
+    int len;
+
+    bench_setup(&heaters, &model);
+    ControlBench_Run(&result, CONTROL_BENCH_SETPOINT_STEP, &heaters, NULL, NULL, &model,
+                     200.0f, 600.0f, fake_cycles);
+    TEST_CHECK(result.cycles_max == 100U);
+    TEST_CHECK(result.cycles_mean == 100U);
+
+    len = ControlBench_Format(&result, 1, line, sizeof(line));
+    TEST_CHECK(len > 0 && (size_t)len == strlen(line));
+    TEST_CHECK(strncmp(line, "setpoint_step,1,", 16) == 0);
+    TEST_CHECK(line[len - 1] == '\n');
+    TEST_CHECK(ControlBench_Format(&result, HEATERS_ZONES, line, sizeof(line)) < 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_cold_start_settles);
+    TEST_RUN(test_pellet_feed_disturbs_zone0);
+    TEST_RUN(test_csv_format);
+    TEST_EXIT();
+}
@@ -0,0 +1,90 @@
+/**
+ * @file      test_control_metrics.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the step-response metrics
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "control_metrics.h"
+#include "test.h"
+
+/* Linear rise from 0 to 110 in 11 s, then back down to 100 */
+static void feed_overshooting_step(ControlMetrics_t *m)
+{
+    ControlMetrics_Start(m, 0.0f, 100.0f, 2.0f);
+    for (int i = 1; i <= 11; i++) {
+        ControlMetrics_Update(m, 10.0f * i, 50.0f, 1.0f);
+    }
+    for (int i = 1; i <= 5; i++) {
+        ControlMetrics_Update(m, 110.0f - 2.0f * i, 10.0f, 1.0f);
+    }
+    for (int i = 0; i < 10; i++) {
+        ControlMetrics_Update(m, (i & 1) ? 100.5f : 99.5f, 10.0f, 1.0f);
+    }
+}
+
+static void test_rise_overshoot_settling(void)
+{
+    ControlMetrics_t m;
+
+    feed_overshooting_step(&m);
+    TEST_NEAR(m.rise_start, 1.0f, 1e-5f);
+    TEST_NEAR(m.rise_time, 8.0f, 1e-5f);
+    TEST_NEAR(m.overshoot, 10.0f, 1e-5f);
+    TEST_NEAR(m.peak, 110.0f, 1e-5f);
+    /* Last outside the band at 104 °C, 14 s in, then 102 down to 99.5 */
+    TEST_NEAR(m.settling_time, 14.0f, 1e-5f);
+    TEST_NEAR(m.ripple, 2.5f, 1e-5f);
+    TEST_NEAR(m.energy, 11 * 50.0f + 15 * 10.0f, 1e-3f);
+    TEST_CHECK(ControlMetrics_IsSettled(&m, 10.0f));
+    TEST_CHECK(!ControlMetrics_IsSettled(&m, 13.0f));
+}
+
+static void test_falling_step(void)
+{
+    ControlMetrics_t m;
+
+    ControlMetrics_Start(&m, 200.0f, 150.0f, 2.0f);
+    ControlMetrics_Update(&m, 170.0f, 0.0f, 1.0f);
+    ControlMetrics_Update(&m, 145.0f, 0.0f, 1.0f);
+    ControlMetrics_Update(&m, 150.0f, 0.0f, 1.0f);
+    TEST_NEAR(m.overshoot, 5.0f, 1e-5f);
+    TEST_NEAR(m.iae, 20.0f + 5.0f, 1e-4f);
+}
+
+static void test_step_inside_band(void)
+{
+    ControlMetrics_t m;
+
+    ControlMetrics_Start(&m, 199.0f, 200.0f, 2.0f);
+    TEST_NEAR(m.rise_time, 0.0f, 0.0f);
+    ControlMetrics_Update(&m, 203.0f, 0.0f, 1.0f);
+    TEST_NEAR(m.max_error, 3.0f, 1e-5f);
+}
+
+static void test_dominates(void)
+{
+    ControlMetrics_t a;
+    ControlMetrics_t b;
+
+    feed_overshooting_step(&a);
+    b = a;
+    TEST_CHECK(!ControlMetrics_Dominates(&a, &b));
+    b.iae += 1.0f;
+    TEST_CHECK(ControlMetrics_Dominates(&a, &b));
+    TEST_CHECK(!ControlMetrics_Dominates(&b, &a));
+    /* Better on one figure, worse on another: neither dominates */
+    a.overshoot += 1.0f;
+    TEST_CHECK(!ControlMetrics_Dominates(&a, &b));
+    TEST_CHECK(!ControlMetrics_Dominates(&b, &a));
+}
+
+int main(void)
+{
+    TEST_RUN(test_rise_overshoot_settling);
+    TEST_RUN(test_falling_step);
+    TEST_RUN(test_step_inside_band);
+    TEST_RUN(test_dominates);
+    TEST_EXIT();
+}
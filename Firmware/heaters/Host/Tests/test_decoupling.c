@@ -0,0 +1,198 @@
+/**
+ * @file      test_decoupling.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the static zone decoupler
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "decoupling.h"
+#include "control_bench.h"
+#include "test.h"
+
+static void model_setup(ThermalModel_t *model)
+{
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model->zone[z] = (ThermalModel_Zone_t){ 2000.0f, 1.5f, 400.0f, 5.0f };
+    }
+    model->coupling[0] = 0.8f;
+    model->coupling[1] = 0.4f;
+    ThermalModel_Init(model, 25.0f);
+}
+
+/**
+ * @brief Bench barrel of 800 W zones with strong wall conduction, zone PIs
+ *        at Kp 20 / Ki 0.05, with or without the decoupler
+ */
+static void bench_setup(Heaters_t *heaters, ThermalModel_t *model, uint8_t decouple)
+{
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model->zone[z] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 800.0f, 5.0f };
+        model->disturbance[z] = 0.0f;
+        model->dead_time[z] = 0.0f;
+    }
+    model->coupling[0] = 5.0f;
+    model->coupling[1] = 5.0f;
+    model->ambient = 25.0f;
+
+    Heaters_Init(heaters, 0.25f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(heaters, z, 20.0f, 0.05f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    }
+    if (decouple) {
+        Decoupling_GainFromModel(&heaters->decoupling, model);
+        TEST_CHECK(Decoupling_Compute(&heaters->decoupling));
+    }
+}
+
+static void test_disabled_passes_through(void)
+{
+    Decoupling_t dec;
+    const float in[3] = { 10.0f, 20.0f, 30.0f };
+    float out[3];
+
+    Decoupling_Init(&dec);
+    Decoupling_Apply(&dec, in, out);
+    TEST_NEAR(out[0], 10.0f, 0.0f);
+    TEST_NEAR(out[1], 20.0f, 0.0f);
+    TEST_NEAR(out[2], 30.0f, 0.0f);
+}
+
+static void test_model_gain_matches_simulation(void)
+{
+    Decoupling_t dec;
+    ThermalModel_t model = { 0 };
+    const float command[3] = { 0.0f, 50.0f, 0.0f };
+
+    model_setup(&model);
+    Decoupling_Init(&dec);
+    Decoupling_GainFromModel(&dec, &model);
+
+    /* Let the model settle with 50 % on the middle zone only */
+    for (int k = 0; k < 50000; k++) {
+        ThermalModel_Step(&model, command, 0.5f);
+    }
+    for (uint8_t z = 0; z < 3; z++) {
+        TEST_NEAR(model.temp[z] - 25.0f, 50.0f * dec.gain[z][1], 0.01f);
+    }
+}
+
+static void test_decoupled_plant_is_diagonal(void)
+{
+    Decoupling_t dec;
+    ThermalModel_t model = { 0 };
+
+    model_setup(&model);
+    Decoupling_Init(&dec);
+    Decoupling_GainFromModel(&dec, &model);
+    TEST_CHECK(Decoupling_Compute(&dec));
+    TEST_CHECK(dec.enabled);
+
+    /* G D = diag(G 1): each loop keeps its own full-power gain */
+    for (uint8_t i = 0; i < 3; i++) {
+        float sum = dec.gain[i][0] + dec.gain[i][1] + dec.gain[i][2];
+        for (uint8_t j = 0; j < 3; j++) {
+            float gd = dec.gain[i][0] * dec.matrix[0][j] + dec.gain[i][1] * dec.matrix[1][j] +
+                       dec.gain[i][2] * dec.matrix[2][j];
+            TEST_NEAR(gd, (i == j) ? sum : 0.0f, 1e-3f * sum);
+        }
+    }
+}
+
+static void test_restore_inverts_apply(void)
+{
+    Decoupling_t dec;
+    ThermalModel_t model = { 0 };
+    const float in[3] = { 80.0f, 20.0f, 55.0f };
+    float power[3];
+    float back[3];
+
+    model_setup(&model);
+    Decoupling_Init(&dec);
+    Decoupling_Restore(&dec, in, back);
+    TEST_NEAR(back[1], in[1], 0.0f);
+
+    Decoupling_GainFromModel(&dec, &model);
+    TEST_CHECK(Decoupling_Compute(&dec));
+    Decoupling_Apply(&dec, in, power);
+    Decoupling_Restore(&dec, power, back);
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_NEAR(back[i], in[i], 1e-3f);
+    }
+}
+
+static void test_step_gain_and_singular(void)
+{
+    Decoupling_t dec;
+    const float before[3] = { 100.0f, 100.0f, 100.0f };
+    const float after[3] = { 120.0f, 110.0f, 100.0f };
+
+    Decoupling_Init(&dec);
+    Decoupling_SetStep(&dec, 0, before, after, 10.0f);
+    TEST_NEAR(dec.gain[0][0], 2.0f, 1e-6f);
+    TEST_NEAR(dec.gain[1][0], 1.0f, 1e-6f);
+    TEST_NEAR(dec.gain[2][0], 0.0f, 1e-6f);
+
+    /* Two identical columns: no inverse, decoupling stays off */
+    Decoupling_SetStep(&dec, 1, before, after, 10.0f);
+    TEST_CHECK(!Decoupling_Compute(&dec));
+    TEST_CHECK(!dec.enabled);
+}
+
+static void test_pellet_feed_neighbour(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    ControlBench_Result_t coupled;
+    ControlBench_Result_t decoupled;
+
+    bench_setup(&heaters, &model, 0);
+    ControlBench_Run(&coupled, CONTROL_BENCH_PELLET_FEED, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    bench_setup(&heaters, &model, 1);
+    ControlBench_Run(&decoupled, CONTROL_BENCH_PELLET_FEED, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+
+    /* The feed zone recovers faster and its neighbour is barely disturbed
+     * (0.77 -> 0.26 °C and 465 -> 42 °C s on this barrel) */
+    TEST_CHECK(decoupled.zone[0].max_error < 0.5f * coupled.zone[0].max_error);
+    TEST_CHECK(decoupled.zone[1].iae < 0.2f * coupled.zone[1].iae);
+}
+
+static void test_budget_cut_settles(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    PowerAllocator_t allocator;
+    ControlBench_Result_t result;
+    const PowerAllocator_Config_t config = {
+        .loads = 3,
+        .budget = 1500.0f,
+        .rated = { 800.0f, 800.0f, 800.0f },
+        .priority = { 1, 1, 1 },
+    };
+
+    /* The budget cuts the decoupled commands for most of the warm-up: the
+     * cut must reach every PID through D^-1 or they wind up (never settled
+     * within the hour before, 1190 s now) */
+    bench_setup(&heaters, &model, 1);
+    PowerAllocator_Init(&allocator, &config);
+    ControlBench_Run(&result, CONTROL_BENCH_COLD_START, &heaters, &allocator, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        TEST_CHECK(ControlMetrics_IsSettled(&result.zone[z], 1500.0f));
+        TEST_CHECK(result.zone[z].overshoot < 0.5f);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_disabled_passes_through);
+    TEST_RUN(test_model_gain_matches_simulation);
+    TEST_RUN(test_decoupled_plant_is_diagonal);
+    TEST_RUN(test_restore_inverts_apply);
+    TEST_RUN(test_pellet_feed_neighbour);
+    TEST_RUN(test_budget_cut_settles);
+    TEST_RUN(test_step_gain_and_singular);
+    TEST_EXIT();
+}
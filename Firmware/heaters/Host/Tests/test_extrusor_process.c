@@ -0,0 +1,190 @@
+/**
+ * @file      test_extrusor_process.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the extrusion process state machine
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "extrusor_process.h"
+#include "test.h"
+
+typedef struct {
+    uint8_t heaters;
+    float screw;
+    float winder;
+} Actuators_t;
+
+static void set_heaters(void *ctx, uint8_t enable) { ((Actuators_t *)ctx)->heaters = enable; }
+static void set_screw(void *ctx, float rpm)        { ((Actuators_t *)ctx)->screw = rpm; }
+static void set_winder(void *ctx, float rpm)       { ((Actuators_t *)ctx)->winder = rpm; }
+
+static const ExtrusorProcess_Config_t config = {
+    .band = 2.0f,
+    .run_band = 5.0f,
+    .soak_time = 60.0f,
+    .feed_time = 30.0f,
+    .purge_time = 20.0f,
+    .cool_temp = 60.0f,
+    .feed_rpm = 5.0f,
+    .screw_rpm = 30.0f,
+    .purge_rpm = 40.0f,
+    .winder_rpm = 12.0f,
+};
+
+static const float setpoints[EXTRUSOR_ZONES] = { 200.0f, 210.0f, 220.0f };
+
+static void process_setup(ExtrusorProcess_t *p, Actuators_t *act)
+{
+    const ExtrusorProcess_Outputs_t outputs = { set_heaters, set_screw, set_winder, act };
+
+    *act = (Actuators_t){ 1, 1.0f, 1.0f };
+    ExtrusorProcess_Init(p, &config, &outputs);
+}
+
+static void tick(ExtrusorProcess_t *p, const float *temps, uint32_t faults, float dt)
+{
+    ExtrusorProcess_Tick(p, setpoints, temps, faults, dt);
+    ExtrusorProcess_Dispatch(p);
+}
+
+static void test_init_all_off(void)
+{
+    ExtrusorProcess_t p;
+    Actuators_t act;
+
+    process_setup(&p, &act);
+    TEST_CHECK(p.state == EXTRUSOR_IDLE);
+    TEST_CHECK(act.heaters == 0);
+    TEST_NEAR(act.screw, 0.0f, 0.0f);
+    TEST_NEAR(act.winder, 0.0f, 0.0f);
+}
+
+static void test_start_to_extrude(void)
+{
+    ExtrusorProcess_t p;
+    Actuators_t act;
+    const float cold[EXTRUSOR_ZONES] = { 25.0f, 25.0f, 25.0f };
+
+    process_setup(&p, &act);
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_START);
+    tick(&p, cold, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_PREHEAT);
+    TEST_CHECK(ExtrusorProcess_IsIn(&p, EXTRUSOR_RUN));
+    TEST_CHECK(act.heaters == 1);
+
+    tick(&p, setpoints, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_SOAK);
+    for (int i = 0; i < 60; i++) {
+        tick(&p, setpoints, 0, 1.0f);
+    }
+    TEST_CHECK(p.state == EXTRUSOR_FEED);
+    TEST_CHECK(ExtrusorProcess_IsIn(&p, EXTRUSOR_PRODUCE));
+    TEST_NEAR(act.screw, config.feed_rpm, 0.0f);
+
+    for (int i = 0; i < 30; i++) {
+        tick(&p, setpoints, 0, 1.0f);
+    }
+    TEST_CHECK(p.state == EXTRUSOR_EXTRUDE);
+    TEST_NEAR(act.screw, config.screw_rpm, 0.0f);
+
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_THREADED);
+    tick(&p, setpoints, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_WIND);
+    TEST_NEAR(act.winder, config.winder_rpm, 0.0f);
+
+    /* Leaving the run band drops back to PREHEAT: screw and winder stop */
+    tick(&p, cold, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_PREHEAT);
+    TEST_NEAR(act.screw, 0.0f, 0.0f);
+    TEST_NEAR(act.winder, 0.0f, 0.0f);
+    TEST_CHECK(act.heaters == 1);
+}
+
+static void test_thread_time_starts_winder(void)
+{
+    ExtrusorProcess_t p;
+    Actuators_t act;
+    const ExtrusorProcess_Outputs_t outputs = { set_heaters, set_screw, set_winder, &act };
+    ExtrusorProcess_Config_t c = config;
+
+    /* No operator input: the winder starts thread_time into EXTRUDE */
+    c.thread_time = 10.0f;
+    ExtrusorProcess_Init(&p, &c, &outputs);
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_START);
+    tick(&p, setpoints, 0, 1.0f);
+    tick(&p, setpoints, 0, 1.0f);
+    for (int i = 0; i < 60 + 30; i++) {
+        tick(&p, setpoints, 0, 1.0f);
+    }
+    TEST_CHECK(p.state == EXTRUSOR_EXTRUDE);
+    for (int i = 0; i < 9; i++) {
+        tick(&p, setpoints, 0, 1.0f);
+    }
+    TEST_CHECK(p.state == EXTRUSOR_EXTRUDE);
+    TEST_NEAR(act.winder, 0.0f, 0.0f);
+    tick(&p, setpoints, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_WIND);
+    TEST_NEAR(act.winder, c.winder_rpm, 0.0f);
+
+    /* The timeout does not apply once winding */
+    for (int i = 0; i < 60; i++) {
+        tick(&p, setpoints, 0, 1.0f);
+    }
+    TEST_CHECK(p.state == EXTRUSOR_WIND);
+}
+
+static void test_fault_and_reset(void)
+{
+    ExtrusorProcess_t p;
+    Actuators_t act;
+    const float cold[EXTRUSOR_ZONES] = { 25.0f, 25.0f, 25.0f };
+
+    process_setup(&p, &act);
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_START);
+    tick(&p, cold, 0, 1.0f);
+    tick(&p, cold, 0x01, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_FAULT);
+    TEST_CHECK(act.heaters == 0);
+
+    /* Reset is refused while the fault is still present */
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_RESET);
+    tick(&p, cold, 0x01, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_FAULT);
+
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_RESET);
+    tick(&p, cold, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_COOLDOWN);
+    tick(&p, cold, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_IDLE);
+}
+
+static void test_stop_and_queue_full(void)
+{
+    ExtrusorProcess_t p;
+    Actuators_t act;
+    const float hot[EXTRUSOR_ZONES] = { 150.0f, 150.0f, 150.0f };
+
+    process_setup(&p, &act);
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_START);
+    ExtrusorProcess_Post(&p, EXTRUSOR_EV_STOP);
+    tick(&p, hot, 0, 1.0f);
+    TEST_CHECK(p.state == EXTRUSOR_COOLDOWN);
+    TEST_CHECK(act.heaters == 0);
+
+    for (uint32_t i = 0; i < EXTRUSOR_QUEUE_SIZE; i++) {
+        TEST_CHECK(ExtrusorProcess_Post(&p, EXTRUSOR_EV_PURGE));
+    }
+    TEST_CHECK(!ExtrusorProcess_Post(&p, EXTRUSOR_EV_PURGE));
+    TEST_CHECK(!ExtrusorProcess_Post(&p, EXTRUSOR_EVENTS));
+}
+
+int main(void)
+{
+    TEST_RUN(test_init_all_off);
+    TEST_RUN(test_start_to_extrude);
+    TEST_RUN(test_thread_time_starts_winder);
+    TEST_RUN(test_fault_and_reset);
+    TEST_RUN(test_stop_and_queue_full);
+    TEST_EXIT();
+}
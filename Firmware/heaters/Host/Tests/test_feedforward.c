@@ -0,0 +1,212 @@
+/**
+ * @file      test_feedforward.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the model-based setpoint feedforward
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "feedforward.h"
+#include "control_bench.h"
+#include "test.h"
+
+#include <math.h>
+
+static const ThermalModel_Zone_t zone = { 2000.0f, 1.6f, 400.0f, 5.0f };
+
+static void test_off_without_model(void)
+{
+    Feedforward_t ff;
+
+    Feedforward_Init(&ff, 0.25f);
+    TEST_NEAR(Feedforward_Update(&ff, 200.0f), 0.0f, 0.0f);
+    Feedforward_SetModel(&ff, &(ThermalModel_Zone_t){ 2000.0f, 1.6f, 0.0f, 5.0f }, 25.0f);
+    TEST_NEAR(Feedforward_Update(&ff, 200.0f), 0.0f, 0.0f);
+}
+
+static void test_holding_power(void)
+{
+    Feedforward_t ff;
+
+    Feedforward_Init(&ff, 0.25f);
+    Feedforward_SetModel(&ff, &zone, 25.0f);
+    /* 1.6 W/°C * 175 °C = 280 W of 400 W */
+    TEST_NEAR(Feedforward_Update(&ff, 200.0f), 70.0f, 1e-4f);
+    TEST_NEAR(Feedforward_Update(&ff, 200.0f), 70.0f, 1e-4f);
+}
+
+static void test_ramp_and_clamp(void)
+{
+    Feedforward_t ff;
+
+    Feedforward_Init(&ff, 0.25f);
+    Feedforward_SetModel(&ff, &zone, 25.0f);
+    Feedforward_Update(&ff, 100.0f);
+    /* 0.025 °C per 250 ms = 0.1 °C/s, 200 W on top of 120 W */
+    TEST_NEAR(Feedforward_Update(&ff, 100.025f), 80.0f, 0.02f);
+
+    /* Falling setpoint never asks for negative power */
+    TEST_NEAR(Feedforward_Update(&ff, 50.0f), 0.0f, 0.0f);
+
+    /* After a reset the first update has no rate term */
+    Feedforward_Reset(&ff);
+    TEST_NEAR(Feedforward_Update(&ff, 225.0f), 80.0f, 1e-4f);
+}
+
+/**
+ * @brief Three-zone barrel at Kp 8 / Ki 0.02 (integrator -50..100), with the
+ *        feedforward model's loss and heat capacity scaled, or none
+ */
+static void bench_setup(Heaters_t *heaters, ThermalModel_t *model, uint8_t feedforward,
+                        float loss_scale, float capacity_scale)
+{
+    ThermalModel_Zone_t guess = { 2000.0f * capacity_scale, 2.0f * loss_scale, 800.0f, 5.0f };
+
+    *model = (ThermalModel_t){ 0 };
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        model->zone[z] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 800.0f, 5.0f };
+    }
+    model->coupling[0] = 1.0f;
+    model->coupling[1] = 1.0f;
+    model->ambient = 25.0f;
+    Heaters_Init(heaters, 0.25f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(heaters, z, 8.0f, 0.02f, 0.0f, 1.0f, 0.0f, 100.0f, -50.0f, 100.0f);
+        if (feedforward) {
+            Heaters_SetFeedforward(heaters, z, &guess, 25.0f);
+        }
+    }
+}
+
+/**
+ * @brief Zone 1 tracking a cold ramp 25 -> 200 °C at 10 °C/min: largest error
+ *        and IAE against the moving setpoint, overshoot once it holds
+ */
+static void cold_ramp(uint8_t feedforward, float loss_scale, float capacity_scale,
+                      float *max_error, float *iae, float *overshoot)
+{
+    static Heaters_t heaters;
+    static ThermalModel_t model;
+    float setpoints[HEATERS_ZONES];
+    float temps[HEATERS_ZONES];
+
+    bench_setup(&heaters, &model, feedforward, loss_scale, capacity_scale);
+    ThermalModel_Init(&model, 25.0f);
+    *max_error = 0.0f;
+    *iae = 0.0f;
+    *overshoot = 0.0f;
+    for (uint32_t k = 0; k < 3600U * 4U; k++) {
+        float sp = 25.0f + (float)k * 0.25f * (10.0f / 60.0f);
+        float error;
+
+        sp = (sp > 200.0f) ? 200.0f : sp;
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            setpoints[z] = sp;
+            temps[z] = ThermalModel_ReadSensor(&model, z);
+        }
+        Heaters_ControlStep(&heaters, setpoints, temps);
+        ThermalModel_Step(&model, heaters.power, 0.25f);
+
+        error = (float)(model.tc_temp[1] - sp);
+        if (sp < 200.0f) {
+            *max_error = (fabsf(error) > *max_error) ? fabsf(error) : *max_error;
+            *iae += fabsf(error) * 0.25f;
+        } else if (error > *overshoot) {
+            *overshoot = error;
+        }
+    }
+}
+
+static void test_cold_ramp_tracking(void)
+{
+    float max_error;
+    float iae;
+    float overshoot;
+
+    /* Max error 4.61 -> 0.62 °C, IAE 3163 -> 198 °C·s, overshoot 2.62 -> 0.81 °C */
+    cold_ramp(0, 1.0f, 1.0f, &max_error, &iae, &overshoot);
+    TEST_NEAR(max_error, 4.61f, 0.05f);
+    TEST_NEAR(iae, 3163.0f, 30.0f);
+    TEST_NEAR(overshoot, 2.62f, 0.05f);
+    cold_ramp(1, 1.0f, 1.0f, &max_error, &iae, &overshoot);
+    TEST_NEAR(max_error, 0.62f, 0.05f);
+    TEST_NEAR(iae, 198.0f, 10.0f);
+    TEST_NEAR(overshoot, 0.81f, 0.05f);
+}
+
+static void test_cold_ramp_model_error(void)
+{
+    static const float scales[4][2] = {
+        { 1.1f, 1.1f }, { 0.9f, 0.9f }, { 1.1f, 0.9f }, { 0.9f, 1.1f },
+    };
+    float max_error;
+    float iae;
+    float overshoot;
+
+    /* Loss and heat capacity off by 10 % either way: max error 0.59-0.74 °C,
+     * overshoot 0.58-1.10 °C */
+    for (uint8_t i = 0; i < 4; i++) {
+        cold_ramp(1, scales[i][0], scales[i][1], &max_error, &iae, &overshoot);
+        TEST_CHECK(max_error < 0.8f);
+        TEST_CHECK(overshoot < 1.2f);
+    }
+}
+
+static void test_bench_scenarios(void)
+{
+    static Heaters_t heaters;
+    static ThermalModel_t model;
+    ControlBench_Result_t plain;
+    ControlBench_Result_t ff;
+
+    /* Ramped setpoint: overshoot 1.52 -> 0.84 °C, IAE 10051 -> 7534 °C·s */
+    bench_setup(&heaters, &model, 0, 1.0f, 1.0f);
+    ControlBench_Run(&plain, CONTROL_BENCH_SETPOINT_RAMP, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    bench_setup(&heaters, &model, 1, 1.0f, 1.0f);
+    ControlBench_Run(&ff, CONTROL_BENCH_SETPOINT_RAMP, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    TEST_NEAR(plain.zone[1].overshoot, 1.52f, 0.05f);
+    TEST_NEAR(ff.zone[1].overshoot, 0.84f, 0.05f);
+    TEST_NEAR(plain.zone[1].iae, 10051.0f, 50.0f);
+    TEST_NEAR(ff.zone[1].iae, 7534.0f, 50.0f);
+
+    /* Raw setpoint steps overshoot more, hence main ramps every change:
+     * 6.19 -> 10.83 °C from cold, 1.60 -> 2.14 °C on a 20 °C step */
+    bench_setup(&heaters, &model, 0, 1.0f, 1.0f);
+    ControlBench_Run(&plain, CONTROL_BENCH_COLD_START, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    bench_setup(&heaters, &model, 1, 1.0f, 1.0f);
+    ControlBench_Run(&ff, CONTROL_BENCH_COLD_START, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    TEST_NEAR(plain.zone[1].overshoot, 6.19f, 0.05f);
+    TEST_NEAR(ff.zone[1].overshoot, 10.83f, 0.05f);
+    bench_setup(&heaters, &model, 0, 1.0f, 1.0f);
+    ControlBench_Run(&plain, CONTROL_BENCH_SETPOINT_STEP, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    bench_setup(&heaters, &model, 1, 1.0f, 1.0f);
+    ControlBench_Run(&ff, CONTROL_BENCH_SETPOINT_STEP, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    TEST_NEAR(plain.zone[1].overshoot, 1.60f, 0.05f);
+    TEST_NEAR(ff.zone[1].overshoot, 2.14f, 0.05f);
+
+    /* Pellet load on the feed zone: same peak error */
+    bench_setup(&heaters, &model, 0, 1.0f, 1.0f);
+    ControlBench_Run(&plain, CONTROL_BENCH_PELLET_FEED, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    bench_setup(&heaters, &model, 1, 1.0f, 1.0f);
+    ControlBench_Run(&ff, CONTROL_BENCH_PELLET_FEED, &heaters, NULL, NULL, &model,
+                     200.0f, 3600.0f, NULL);
+    TEST_NEAR(ff.zone[0].max_error, plain.zone[0].max_error, 0.05f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_off_without_model);
+    TEST_RUN(test_holding_power);
+    TEST_RUN(test_ramp_and_clamp);
+    TEST_RUN(test_cold_ramp_tracking);
+    TEST_RUN(test_cold_ramp_model_error);
+    TEST_RUN(test_bench_scenarios);
+    TEST_EXIT();
+}
@@ -0,0 +1,181 @@
+/**
+ * @file      test_gain_schedule.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the temperature / screw speed gain schedule
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "gain_schedule.h"
+#include "heaters.h"
+#include "thermal_model.h"
+#include "test.h"
+
+#include <math.h>
+
+static GainSchedule_Table_t table_setup(void)
+{
+    GainSchedule_Table_t table = {
+        .temp = { 50.0f, 100.0f, 200.0f, 300.0f },
+        .rpm = { 0.0f, 30.0f, 60.0f },
+    };
+
+    /* Kp scale grows with temperature, Ki with screw speed, Kd fixed */
+    for (uint8_t t = 0; t < GAIN_SCHEDULE_TEMPS; t++) {
+        for (uint8_t r = 0; r < GAIN_SCHEDULE_RPMS; r++) {
+            table.scale[t][r].Kp = 1.0f + t;
+            table.scale[t][r].Ki = 1.0f + 0.5f * r;
+            table.scale[t][r].Kd = 1.0f;
+        }
+    }
+    return table;
+}
+
+static void test_breakpoints(void)
+{
+    GainSchedule_Table_t table = table_setup();
+    const PIDGains base = { 2.0f, 0.1f, 4.0f };
+    PIDGains g;
+
+    g = GainSchedule_Lookup(&table, &base, 50.0f, 0.0f);
+    TEST_NEAR(g.Kp, 2.0f, 1e-6f);
+    TEST_NEAR(g.Ki, 0.1f, 1e-6f);
+    TEST_NEAR(g.Kd, 4.0f, 1e-6f);
+    g = GainSchedule_Lookup(&table, &base, 300.0f, 60.0f);
+    TEST_NEAR(g.Kp, 8.0f, 1e-6f);
+    TEST_NEAR(g.Ki, 0.2f, 1e-6f);
+}
+
+static void test_bilinear(void)
+{
+    GainSchedule_Table_t table = table_setup();
+    const PIDGains base = { 2.0f, 0.1f, 4.0f };
+    PIDGains g;
+
+    g = GainSchedule_Lookup(&table, &base, 150.0f, 45.0f);
+    TEST_NEAR(g.Kp, 2.0f * 2.5f, 1e-5f);
+    TEST_NEAR(g.Ki, 0.1f * 1.75f, 1e-6f);
+    TEST_NEAR(g.Kd, 4.0f, 1e-6f);
+}
+
+static void test_clamped_outside(void)
+{
+    GainSchedule_Table_t table = table_setup();
+    const PIDGains base = { 2.0f, 0.1f, 4.0f };
+    PIDGains g;
+
+    g = GainSchedule_Lookup(&table, &base, 20.0f, -5.0f);
+    TEST_NEAR(g.Kp, 2.0f, 1e-6f);
+    TEST_NEAR(g.Ki, 0.1f, 1e-6f);
+    g = GainSchedule_Lookup(&table, &base, 400.0f, 90.0f);
+    TEST_NEAR(g.Kp, 8.0f, 1e-6f);
+    TEST_NEAR(g.Ki, 0.2f, 1e-6f);
+}
+
+/**
+ * @brief Material run of the feed zone at Kp 8 / Ki 0.02 with main's default
+ *        table: warm-up to 200 °C, screw load at 30 then 60 rpm (5 W/rpm from
+ *        the feed zone, 2 W/rpm from the next), change to 230 °C. IAE and
+ *        peak error of each phase, the warm-up peak after its first 1000 s.
+ */
+static void material_run(uint8_t scheduled, float *iae, float *peak)
+{
+    static const GainSchedule_Table_t table = {
+        .temp = { 50.0f, 150.0f, 180.0f, 250.0f },
+        .rpm = { 0.0f, 30.0f, 60.0f },
+        .scale = {
+            { { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f } },
+            { { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f }, { 1.0f, 0.25f, 1.0f } },
+            { { 1.0f, 1.0f, 1.0f }, { 1.5f, 1.5f, 1.0f }, { 2.0f, 2.0f, 1.0f } },
+            { { 1.0f, 1.0f, 1.0f }, { 1.5f, 1.5f, 1.0f }, { 2.0f, 2.0f, 1.0f } },
+        },
+    };
+    static const float starts[4] = { 0.0f, 2400.0f, 4200.0f, 6000.0f };
+    const PIDGains base = { 8.0f, 0.02f, 0.0f };
+    ThermalModel_t model = { 0 };
+    Heaters_t heaters;
+    float setpoints[HEATERS_ZONES] = { 200.0f, 200.0f, 200.0f };
+    float temps[HEATERS_ZONES];
+    float rpm = 0.0f;
+    uint8_t phase = 0;
+
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        model.zone[z] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 800.0f, 5.0f };
+    }
+    model.coupling[0] = 1.0f;
+    model.coupling[1] = 1.0f;
+    ThermalModel_Init(&model, 25.0f);
+    Heaters_Init(&heaters, 0.25f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(&heaters, z, base.Kp, base.Ki, base.Kd, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    }
+    for (uint8_t p = 0; p < 4; p++) {
+        iae[p] = 0.0f;
+        peak[p] = 0.0f;
+    }
+
+    for (uint32_t k = 0; k < 8000U * 4U; k++) {
+        float t = (float)k * 0.25f;
+        float error;
+
+        if ((phase < 3) && (t >= starts[phase + 1])) {
+            phase++;
+            rpm = (phase == 1) ? 30.0f : 60.0f;
+            if (phase == 3) {
+                for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+                    setpoints[z] = 230.0f;
+                }
+            }
+        }
+        model.disturbance[0] = -5.0f * rpm;
+        model.disturbance[1] = -2.0f * rpm;
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            temps[z] = ThermalModel_ReadSensor(&model, z);
+            if (scheduled) {
+                PIDGains g = GainSchedule_Lookup(&table, &base, temps[z], rpm);
+                PID_UpdateGainsBumpless(&heaters.pid[z], g.Kp, g.Ki, g.Kd);
+            }
+        }
+        Heaters_ControlStep(&heaters, setpoints, temps);
+        ThermalModel_Step(&model, heaters.power, 0.25f);
+
+        error = (float)fabs(model.tc_temp[0] - setpoints[0]);
+        iae[phase] += error * 0.25f;
+        if (((phase > 0) || (t > 1000.0f)) && (error > peak[phase])) {
+            peak[phase] = error;
+        }
+    }
+}
+
+static void test_material_run(void)
+{
+    float fixed_iae[4];
+    float fixed_peak[4];
+    float iae[4];
+    float peak[4];
+
+    /* Screw load recovered faster: IAE 766 -> 479 °C·s (peak 1.80 -> 1.26 °C)
+     * at 30 rpm, 798 -> 349 °C·s (1.89 -> 1.01 °C) at 60 rpm; warm-up and
+     * setpoint change within 5 % */
+    material_run(0, fixed_iae, fixed_peak);
+    material_run(1, iae, peak);
+    TEST_NEAR(fixed_iae[1], 766.0f, 10.0f);
+    TEST_NEAR(iae[1], 479.0f, 10.0f);
+    TEST_NEAR(fixed_peak[1], 1.80f, 0.05f);
+    TEST_NEAR(peak[1], 1.26f, 0.05f);
+    TEST_NEAR(fixed_iae[2], 798.0f, 10.0f);
+    TEST_NEAR(iae[2], 349.0f, 10.0f);
+    TEST_NEAR(fixed_peak[2], 1.89f, 0.05f);
+    TEST_NEAR(peak[2], 1.01f, 0.05f);
+    TEST_NEAR(iae[0], fixed_iae[0], 0.05f * fixed_iae[0]);
+    TEST_NEAR(iae[3], fixed_iae[3], 0.05f * fixed_iae[3]);
+}
+
+int main(void)
+{
+    TEST_RUN(test_breakpoints);
+    TEST_RUN(test_bilinear);
+    TEST_RUN(test_clamped_outside);
+    TEST_RUN(test_material_run);
+    TEST_EXIT();
+}
@@ -0,0 +1,128 @@
+/**
+ * @file      test_heater_supervisor.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the heater fault supervisor
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "heater_supervisor.h"
+#include "test.h"
+
+static const HeaterSupervisor_Config_t config = {
+    .temp_limit = { 280.0f, 280.0f, 280.0f },
+    .stuck_time = 10.0f,
+    .runaway_power = 80.0f,
+    .runaway_band = 10.0f,
+    .runaway_rise = 2.0f,
+    .runaway_time = 60.0f,
+    .overshoot = 15.0f,
+};
+
+static const float setpoints[3] = { 200.0f, 200.0f, 200.0f };
+
+static void test_healthy_warmup(void)
+{
+    HeaterSupervisor_t sup;
+    const float power[3] = { 100.0f, 100.0f, 100.0f };
+    float temps[3] = { 25.0f, 25.0f, 25.0f };
+
+    HeaterSupervisor_Init(&sup, &config);
+    for (int i = 0; i < 600; i++) {
+        TEST_CHECK(HeaterSupervisor_Check(&sup, temps, 0, power, setpoints, 0.25f) == 0);
+        for (int z = 0; z < 3; z++) {
+            temps[z] += 0.1f;
+        }
+    }
+}
+
+static void test_open_and_overtemp_latch(void)
+{
+    HeaterSupervisor_t sup;
+    const float power[3] = { 0.0f, 0.0f, 0.0f };
+    float temps[3] = { 150.0f, 150.0f, 150.0f };
+
+    HeaterSupervisor_Init(&sup, &config);
+    TEST_CHECK(HeaterSupervisor_Check(&sup, temps, 0x02, power, setpoints, 1.0f) == 0x02);
+    TEST_CHECK(sup.zone[1].fault == HEATER_FAULT_OPEN);
+    TEST_NEAR(sup.zone[1].fault_time, 1.0f, 0.0f);
+
+    /* Latched: still reported after the reading is back */
+    temps[2] = 290.0f;
+    TEST_CHECK(HeaterSupervisor_Check(&sup, temps, 0, power, setpoints, 1.0f) == 0x06);
+    TEST_CHECK(sup.zone[2].fault & HEATER_FAULT_OVERTEMP);
+
+    HeaterSupervisor_Reset(&sup);
+    TEST_CHECK(HeaterSupervisor_Faults(&sup) == 0);
+}
+
+static void test_stuck_reading(void)
+{
+    HeaterSupervisor_t sup;
+    const float power[3] = { 50.0f, 0.0f, 0.0f };
+    const float temps[3] = { 100.0f, 100.0f, 100.0f };
+    uint8_t mask = 0;
+
+    HeaterSupervisor_Init(&sup, &config);
+    for (int i = 0; i <= 40; i++) {
+        mask = HeaterSupervisor_Check(&sup, temps, 0, power, setpoints, 0.25f);
+    }
+    TEST_CHECK(mask == 0x01);
+    TEST_CHECK(sup.zone[0].fault & HEATER_FAULT_STUCK);
+}
+
+static void test_no_rise_and_overshoot(void)
+{
+    HeaterSupervisor_t sup;
+    const float power[3] = { 100.0f, 0.0f, 0.0f };
+    float temps[3] = { 100.0f, 200.0f, 200.0f };
+
+    HeaterSupervisor_Init(&sup, &config);
+    /* Zone 0 creeps 1 °C a minute at full power; zone 1 climbs unpowered */
+    for (int i = 0; i < 4 * 70; i++) {
+        HeaterSupervisor_Check(&sup, temps, 0, power, setpoints, 0.25f);
+        temps[0] += 1.0f / 240.0f;
+        temps[1] += 0.1f;
+    }
+    TEST_CHECK(sup.zone[0].fault & HEATER_FAULT_NO_RISE);
+    TEST_CHECK(sup.zone[1].fault & HEATER_FAULT_OVERSHOOT);
+    TEST_CHECK(sup.zone[2].fault == 0);
+}
+
+static void test_acknowledge_needs_cleared_condition(void)
+{
+    HeaterSupervisor_t sup;
+    const float off[3] = { 0.0f, 0.0f, 0.0f };
+    const float heating[3] = { 50.0f, 0.0f, 0.0f };
+    float temps[3] = { 100.0f, 150.0f, 290.0f };
+
+    /* Zone 0 stuck, zone 1 open, zone 2 over its limit */
+    HeaterSupervisor_Init(&sup, &config);
+    for (int i = 0; i <= 40; i++) {
+        HeaterSupervisor_Check(&sup, temps, 0x02, heating, setpoints, 0.25f);
+    }
+    TEST_CHECK(HeaterSupervisor_Faults(&sup) == 0x07);
+
+    /* Nothing has changed yet: nothing is released */
+    TEST_CHECK(HeaterSupervisor_Acknowledge(&sup, temps, 0x02, setpoints) == 0x07);
+
+    /* Reading moving, thermocouple back, zone cooled below setpoint + overshoot */
+    temps[0] = 99.75f;
+    temps[2] = 210.0f;
+    TEST_CHECK(HeaterSupervisor_Acknowledge(&sup, temps, 0x02, setpoints) == 0x02);
+    TEST_CHECK(HeaterSupervisor_Acknowledge(&sup, temps, 0, setpoints) == 0);
+
+    /* Released zones restart their watches from the next reading */
+    TEST_CHECK(HeaterSupervisor_Check(&sup, temps, 0, off, setpoints, 0.25f) == 0);
+    TEST_CHECK(sup.zone[0].started);
+}
+
+int main(void)
+{
+    TEST_RUN(test_healthy_warmup);
+    TEST_RUN(test_open_and_overtemp_latch);
+    TEST_RUN(test_stuck_reading);
+    TEST_RUN(test_no_rise_and_overshoot);
+    TEST_RUN(test_acknowledge_needs_cleared_condition);
+    TEST_EXIT();
+}
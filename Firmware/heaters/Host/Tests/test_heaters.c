@@ -0,0 +1,125 @@
+/**
+ * @file      test_heaters.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the heater zone control step
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "heaters.h"
+#include "test.h"
+
+static void heaters_setup(Heaters_t *heaters)
+{
+    Heaters_Init(heaters, 0.25f);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        Heaters_ConfigureZone(heaters, zone, 5.0f, 0.0f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    }
+}
+
+static void test_control_step_per_zone(void)
+{
+    Heaters_t heaters;
+    const float setpoints[HEATERS_ZONES] = { 200.0f, 200.0f, 200.0f };
+    const float temps[HEATERS_ZONES] = { 190.0f, 199.0f, 250.0f };
+
+    heaters_setup(&heaters);
+    TEST_CHECK(Heaters_IsIdle(&heaters));
+    Heaters_ControlStep(&heaters, setpoints, temps);
+    TEST_NEAR(heaters.power[0], 50.0f, 1e-4f);
+    TEST_NEAR(heaters.power[1], 5.0f, 1e-4f);
+    TEST_NEAR(heaters.power[2], 0.0f, 1e-4f);
+    TEST_CHECK(!Heaters_IsIdle(&heaters));
+}
+
+static void test_limit_power(void)
+{
+    Heaters_t heaters;
+    const float setpoints[HEATERS_ZONES] = { 200.0f, 200.0f, 200.0f };
+    const float temps[HEATERS_ZONES] = { 100.0f, 100.0f, 100.0f };
+    const float limit[HEATERS_ZONES] = { 30.0f, 100.0f, 0.0f };
+
+    heaters_setup(&heaters);
+    Heaters_ControlStep(&heaters, setpoints, temps);
+    Heaters_LimitPower(&heaters, limit);
+    TEST_NEAR(heaters.power[0], 30.0f, 1e-5f);
+    TEST_NEAR(heaters.pid[0].out, 30.0f, 1e-5f);
+    TEST_NEAR(heaters.power[1], 100.0f, 1e-5f);
+    TEST_NEAR(heaters.power[2], 0.0f, 1e-5f);
+}
+
+static void test_decoupled_cut_mapped_back(void)
+{
+    Heaters_t heaters;
+    ThermalModel_t model = { 0 };
+    const float setpoints[HEATERS_ZONES] = { 200.0f, 200.0f, 200.0f };
+    const float temps[HEATERS_ZONES] = { 195.0f, 198.0f, 199.0f };
+    const float limit[HEATERS_ZONES] = { 20.0f, 100.0f, 100.0f };
+    float power[HEATERS_ZONES];
+
+    heaters_setup(&heaters);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        model.zone[z] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 800.0f, 5.0f };
+        heaters.pid[z].integrator = 20.0f;
+    }
+    model.coupling[0] = 5.0f;
+    model.coupling[1] = 5.0f;
+    Decoupling_GainFromModel(&heaters.decoupling, &model);
+    TEST_CHECK(Decoupling_Compute(&heaters.decoupling));
+
+    Heaters_ControlStep(&heaters, setpoints, temps);
+    TEST_CHECK(heaters.power[0] > limit[0]);
+    Heaters_LimitPower(&heaters, limit);
+    TEST_NEAR(heaters.power[0], limit[0], 1e-5f);
+
+    /* The PID outputs left behind give exactly the applied power */
+    {
+        float out[HEATERS_ZONES] = { heaters.pid[0].out, heaters.pid[1].out, heaters.pid[2].out };
+        Decoupling_Apply(&heaters.decoupling, out, power);
+    }
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        TEST_NEAR(power[z], heaters.power[z], 1e-3f);
+    }
+    /* The cut in zone 0 also moved its neighbour's integrator */
+    TEST_CHECK(heaters.pid[1].integrator != 20.0f);
+}
+
+static void test_off_clears_state(void)
+{
+    Heaters_t heaters;
+    const float setpoints[HEATERS_ZONES] = { 200.0f, 200.0f, 200.0f };
+    const float temps[HEATERS_ZONES] = { 100.0f, 100.0f, 100.0f };
+
+    heaters_setup(&heaters);
+    Heaters_ConfigureZone(&heaters, 0, 1.0f, 0.1f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    for (int i = 0; i < 10; i++) {
+        Heaters_ControlStep(&heaters, setpoints, temps);
+    }
+    TEST_CHECK(heaters.pid[0].integrator > 0.0f);
+    Heaters_Off(&heaters);
+    TEST_CHECK(Heaters_IsIdle(&heaters));
+    TEST_NEAR(heaters.pid[0].integrator, 0.0f, 0.0f);
+}
+
+static void test_zone_index_checked(void)
+{
+    Heaters_t heaters;
+
+    heaters_setup(&heaters);
+    Heaters_ConfigureZone(&heaters, HEATERS_ZONES, 9.0f, 9.0f, 9.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f);
+    Heaters_SetDeadTime(&heaters, HEATERS_ZONES, NULL, 1.0f);
+    Heaters_SetFeedforward(&heaters, HEATERS_ZONES, NULL, 25.0f);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        TEST_NEAR(heaters.pid[zone].Kp, 5.0f, 0.0f);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_control_step_per_zone);
+    TEST_RUN(test_limit_power);
+    TEST_RUN(test_decoupled_cut_mapped_back);
+    TEST_RUN(test_off_clears_state);
+    TEST_RUN(test_zone_index_checked);
+    TEST_EXIT();
+}
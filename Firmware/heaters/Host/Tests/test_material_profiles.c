@@ -0,0 +1,106 @@
+/**
+ * @file      test_material_profiles.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the per-material recipes
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "material_profiles.h"
+#include "test.h"
+
+#include <string.h>
+
+static void heaters_running(Heaters_t *heaters, float *setpoints)
+{
+    const float temps[HEATERS_ZONES] = { 178.0f, 179.0f, 180.0f };
+
+    /* Near the setpoints, the integrator holding 30 % */
+    Heaters_Init(heaters, 0.25f);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        Heaters_ConfigureZone(heaters, zone, 4.0f, 0.05f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        heaters->pid[zone].integrator = 30.0f;
+        setpoints[zone] = 180.0f;
+    }
+    for (int k = 0; k < 40; k++) {
+        Heaters_ControlStep(heaters, setpoints, temps);
+    }
+}
+
+static void test_builtin_lookup(void)
+{
+    TEST_CHECK(strcmp(MaterialProfile_Get(MATERIAL_ABS)->name, "ABS") == 0);
+    TEST_NEAR(MaterialProfile_Get(MATERIAL_PLA)->limits[0].lim_max, 100.0f, 0.0f);
+    TEST_CHECK(MaterialProfile_Get(MATERIAL_CUSTOM) == NULL);
+    TEST_CHECK(MaterialProfile_Get(MATERIAL_COUNT) == NULL);
+}
+
+static void test_apply_is_bumpless(void)
+{
+    Heaters_t heaters;
+    float setpoints[HEATERS_ZONES];
+    float before[HEATERS_ZONES];
+    ExtrusorProcess_Config_t config = { 0 };
+    MaterialProfile_t profile = *MaterialProfile_Get(MATERIAL_PLA);
+
+    heaters_running(&heaters, setpoints);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        before[zone] = heaters.pid[zone].out;
+        profile.setpoint[zone] = setpoints[zone];
+    }
+    /* Same setpoints, doubled Kp: the output does not step */
+    MaterialProfile_Apply(&profile, &heaters, setpoints, &config);
+    Heaters_ControlStep(&heaters, setpoints, (const float[HEATERS_ZONES]){ 178.0f, 179.0f, 180.0f });
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        TEST_NEAR(PID_GetKp(&heaters.pid[zone]), 8.0f, 0.0f);
+        TEST_NEAR(heaters.pid[zone].out, before[zone], 0.5f);
+    }
+    TEST_NEAR(config.screw_rpm, profile.screw_rpm, 0.0f);
+    TEST_NEAR(config.winder_rpm, profile.puller_rpm, 0.0f);
+}
+
+static void test_zero_limit_leaves_zone_unheated(void)
+{
+    Heaters_t heaters;
+    float setpoints[HEATERS_ZONES];
+    ExtrusorProcess_Config_t config = { 0 };
+    MaterialProfile_t profile = *MaterialProfile_Get(MATERIAL_PETG);
+
+    heaters_running(&heaters, setpoints);
+    profile.limits[2].lim_max = 0.0f;
+    profile.limits[2].lim_max_int = 0.0f;
+    MaterialProfile_Apply(&profile, &heaters, setpoints, &config);
+    TEST_NEAR(heaters.pid[2].integrator, 0.0f, 0.0f);
+    Heaters_ControlStep(&heaters, setpoints, (const float[HEATERS_ZONES]){ 170.0f, 170.0f, 170.0f });
+    TEST_NEAR(heaters.power[2], 0.0f, 0.0f);
+    TEST_CHECK(heaters.power[0] > 0.0f);
+}
+
+static void test_custom_round_trip(void)
+{
+    ParamStore_Data_t params = { 0 };
+    MaterialProfile_t profile;
+
+    params.zones[1].kp = 6.0f;
+    params.zones[1].lim_max = 80.0f;
+    params.zones[1].lim_max_int = 40.0f;
+    params.zones[1].setpoint = 200.0f;
+    params.material.screw_rpm = 12.0f;
+    MaterialProfile_GetCustom(&profile, &params);
+    TEST_CHECK(strcmp(profile.name, "CUSTOM") == 0);
+    TEST_NEAR(profile.gains[1].Kp, 6.0f, 0.0f);
+    TEST_NEAR(profile.limits[1].lim_max, 80.0f, 0.0f);
+    TEST_NEAR(profile.limits[1].lim_max_int, 40.0f, 0.0f);
+    TEST_NEAR(profile.limits[0].lim_max, 0.0f, 0.0f);
+    TEST_NEAR(profile.setpoint[1], 200.0f, 0.0f);
+    TEST_NEAR(profile.screw_rpm, 12.0f, 0.0f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_builtin_lookup);
+    TEST_RUN(test_apply_is_bumpless);
+    TEST_RUN(test_zero_limit_leaves_zone_unheated);
+    TEST_RUN(test_custom_round_trip);
+    TEST_EXIT();
+}
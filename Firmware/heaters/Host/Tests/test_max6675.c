@@ -0,0 +1,120 @@
+/**
+ * @file      test_max6675.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the MAX6675 driver against the device model
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "max6675.h"
+#include "max6675_model.h"
+#include "hal_stub.h"
+#include "test.h"
+
+static SPI_HandleTypeDef hspi;
+static Max6675Model_t model;
+
+static void max6675_setup(MAX6675_Driver_t *driver, float temperature)
+{
+    HalStub_Reset();
+    HalStub_Advance(1000);
+    Max6675Model_Attach(&model, temperature);
+    MAX6675_Init(driver, &hspi);
+}
+
+static void test_reads_selected_device(void)
+{
+    MAX6675_Driver_t driver;
+    float t;
+
+    max6675_setup(&driver, 25.0f);
+    model.device[0].temperature = 180.25f;
+    model.device[2].temperature = 230.0f;
+    TEST_CHECK(MAX6675_AddDevice(&driver, 0) == HAL_OK);
+    TEST_CHECK(MAX6675_AddDevice(&driver, 2) == HAL_OK);
+    TEST_CHECK(MAX6675_GetTemperature(&driver, 0, &t) == HAL_OK);
+    TEST_NEAR(t, 180.25f, 0.0f);
+    TEST_CHECK(MAX6675_GetTemperature(&driver, 2, &t) == HAL_OK);
+    TEST_NEAR(t, 230.0f, 0.0f);
+    TEST_CHECK(model.device[1].frames == 0);
+    /* Every chip select is released after the frame */
+    TEST_CHECK((GPIOA->ODR & CS_0_Pin) && (GPIOB->ODR & CS_2_Pin));
+}
+
+static void test_open_thermocouple(void)
+{
+    MAX6675_Driver_t driver;
+
+    max6675_setup(&driver, 200.0f);
+    TEST_CHECK(MAX6675_AddDevice(&driver, 1) == HAL_OK);
+    TEST_CHECK(MAX6675_IsConnected(&driver, 1));
+
+    /* D2 set alone, the temperature bits still hold a plausible value */
+    model.device[1].fault = MAX6675_MODEL_OPEN;
+    HalStub_Advance(MAX6675_CONVERSION_MS);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 1) == HAL_ERROR);
+    TEST_CHECK(driver.devices[1].raw_data & MAX6675_INPUT_BIT);
+    TEST_CHECK(!MAX6675_IsConnected(&driver, 1));
+    TEST_NEAR(driver.devices[1].temperature, -404.0f, 0.0f);
+
+    /* Reconnected: the next conversion reads again */
+    model.device[1].fault = MAX6675_MODEL_OK;
+    HalStub_Advance(MAX6675_CONVERSION_MS);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 1) == HAL_OK);
+    TEST_CHECK(MAX6675_IsConnected(&driver, 1));
+}
+
+static void test_bus_faults(void)
+{
+    MAX6675_Driver_t driver;
+
+    max6675_setup(&driver, 200.0f);
+    model.device[0].fault = MAX6675_MODEL_MISO_HIGH;
+    TEST_CHECK(MAX6675_AddDevice(&driver, 0) == HAL_ERROR);
+    TEST_CHECK(driver.devices[0].raw_data & MAX6675_DUMMY_BIT);
+
+    model.device[0].fault = MAX6675_MODEL_MISO_LOW;
+    HalStub_Advance(MAX6675_CONVERSION_MS);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 0) == HAL_ERROR);
+    TEST_CHECK(driver.devices[0].raw_data == 0x0000);
+    TEST_CHECK(!MAX6675_IsConnected(&driver, 0));
+
+    /* No model on the bus: the SPI transfer itself fails */
+    HalStub_SetSpi(NULL, NULL);
+    HalStub_Advance(MAX6675_CONVERSION_MS);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 0) == HAL_ERROR);
+}
+
+static void test_conversion_not_aborted(void)
+{
+    MAX6675_Driver_t driver;
+
+    max6675_setup(&driver, 150.0f);
+    TEST_CHECK(MAX6675_AddDevice(&driver, 3) == HAL_OK);
+
+    /* Polled every 100 ms for 10 s: the driver only reads finished
+     * conversions, so the device never restarts one and tracks the ramp */
+    for (int k = 0; k < 100; k++) {
+        HalStub_Advance(100);
+        model.device[3].temperature += 0.5f;
+        (void)MAX6675_ReadTemperature(&driver, 3);
+    }
+    TEST_CHECK(model.device[3].aborted == 0);
+    TEST_CHECK(model.device[3].frames == 1 + 100 / 3);
+    TEST_NEAR(driver.devices[3].temperature, model.device[3].temperature, 1.5f);
+
+    /* A read 100 ms after the last one is refused */
+    HalStub_Advance(MAX6675_CONVERSION_MS);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 3) == HAL_OK);
+    HalStub_Advance(100);
+    TEST_CHECK(MAX6675_ReadTemperature(&driver, 3) == HAL_BUSY);
+}
+
+int main(void)
+{
+    TEST_RUN(test_reads_selected_device);
+    TEST_RUN(test_open_thermocouple);
+    TEST_RUN(test_bus_faults);
+    TEST_RUN(test_conversion_not_aborted);
+    TEST_EXIT();
+}
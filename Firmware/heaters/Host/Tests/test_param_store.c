@@ -0,0 +1,166 @@
+/**
+ * @file      test_param_store.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the parameter store on the emulated flash
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "param_store.h"
+#include "hal_stub.h"
+#include "test.h"
+
+static ParamStore_Data_t defaults_setup(void)
+{
+    ParamStore_Data_t d = { 0 };
+
+    for (uint8_t zone = 0; zone < PARAM_STORE_ZONES; zone++) {
+        d.zones[zone].kp = 5.0f;
+        d.zones[zone].lim_max = 100.0f;
+        d.zones[zone].setpoint = 200.0f;
+    }
+    return d;
+}
+
+static void service_all(ParamStore_t *store)
+{
+    while (ParamStore_IsPending(store)) {
+        TEST_CHECK(ParamStore_Service(store, 0) == HAL_OK);
+    }
+}
+
+static void test_defaults_on_blank_flash(void)
+{
+    const ParamStore_Data_t defaults = defaults_setup();
+    ParamStore_t store;
+
+    HalStub_FlashWipe();
+    TEST_CHECK(ParamStore_Init(&store, &defaults) == HAL_OK);
+    TEST_CHECK(store.usable);
+    TEST_CHECK(!ParamStore_IsPending(&store));
+    TEST_NEAR(store.data.zones[1].setpoint, 200.0f, 0.0f);
+    /* Defaults survive a reset from their own sector */
+    TEST_CHECK(ParamStore_Init(&store, &(ParamStore_Data_t){ 0 }) == HAL_OK);
+    TEST_NEAR(store.data.zones[2].kp, 5.0f, 0.0f);
+}
+
+static void test_changes_persist(void)
+{
+    const ParamStore_Data_t defaults = defaults_setup();
+    ParamStore_t store;
+    ParamStore_Zone_t zone;
+
+    HalStub_FlashWipe();
+    ParamStore_Init(&store, &defaults);
+    zone = store.data.zones[1];
+    zone.setpoint = 215.0f;
+    ParamStore_SetZone(&store, 1, &zone);
+    ParamStore_SetEncoderZero(&store, 0, 0xFFFF);
+    TEST_CHECK(ParamStore_IsPending(&store));
+    service_all(&store);
+
+    ParamStore_Init(&store, &defaults);
+    TEST_NEAR(store.data.zones[1].setpoint, 215.0f, 0.0f);
+    TEST_CHECK(store.data.encoders.zero_position[0] == 0x3FFF);
+    TEST_CHECK(ParamStore_SetZone(&store, PARAM_STORE_ZONES, &zone) == HAL_ERROR);
+}
+
+static void test_torn_record_keeps_old_value(void)
+{
+    const ParamStore_Data_t defaults = defaults_setup();
+    ParamStore_t store;
+    ParamStore_Zone_t zone;
+
+    HalStub_FlashWipe();
+    ParamStore_Init(&store, &defaults);
+    zone = store.data.zones[0];
+    zone.kp = 9.0f;
+    ParamStore_SetZone(&store, 0, &zone);
+
+    HalStub_FlashPowerLoss(5);
+    TEST_CHECK(ParamStore_Service(&store, 0) != HAL_OK);
+    HalStub_FlashPowerLoss(-1);
+
+    ParamStore_Init(&store, &defaults);
+    TEST_NEAR(store.data.zones[0].kp, 5.0f, 0.0f);
+    /* The torn slot is stepped over, the next record lands after it */
+    zone.kp = 7.0f;
+    ParamStore_SetZone(&store, 0, &zone);
+    service_all(&store);
+    ParamStore_Init(&store, &defaults);
+    TEST_NEAR(store.data.zones[0].kp, 7.0f, 0.0f);
+}
+
+static void test_failed_first_format_unusable(void)
+{
+    const ParamStore_Data_t defaults = defaults_setup();
+    ParamStore_t store;
+
+    HalStub_FlashWipe();
+    HalStub_FlashPowerLoss(3);
+    TEST_CHECK(ParamStore_Init(&store, &defaults) == HAL_ERROR);
+    TEST_CHECK(!store.usable);
+    TEST_CHECK(store.write_offset == PARAM_STORE_SECTOR_SIZE);
+    TEST_NEAR(store.data.zones[0].kp, 5.0f, 0.0f);
+
+    /* Nothing is appended to a sector without a header, the retry needs an erase */
+    HalStub_FlashPowerLoss(-1);
+    TEST_CHECK(ParamStore_IsPending(&store));
+    TEST_CHECK(ParamStore_Service(&store, 0) == HAL_BUSY);
+    TEST_CHECK(ParamStore_Service(&store, 1) == HAL_OK);
+    TEST_CHECK(store.usable);
+    TEST_CHECK(!ParamStore_IsPending(&store));
+
+    TEST_CHECK(ParamStore_Init(&store, &(ParamStore_Data_t){ 0 }) == HAL_OK);
+    TEST_NEAR(store.data.zones[0].kp, 5.0f, 0.0f);
+}
+
+static void test_compaction_only_when_allowed(void)
+{
+    const ParamStore_Data_t defaults = defaults_setup();
+    ParamStore_t store;
+    ParamStore_Zone_t zone;
+    uint32_t generation;
+    float stored;
+
+    HalStub_FlashWipe();
+    ParamStore_Init(&store, &defaults);
+    zone = store.data.zones[2];
+    while (store.write_offset + sizeof(ParamStore_Record_t) <= PARAM_STORE_SECTOR_SIZE) {
+        zone.setpoint += 1.0f;
+        ParamStore_SetZone(&store, 2, &zone);
+        TEST_CHECK(ParamStore_Service(&store, 0) == HAL_OK);
+    }
+    generation = store.generation;
+    stored = zone.setpoint;
+
+    zone.setpoint = 230.0f;
+    ParamStore_SetZone(&store, 2, &zone);
+    TEST_CHECK(ParamStore_Service(&store, 0) == HAL_BUSY);
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_1) == 0);
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_2) == 0);
+
+    /* Power lost before the new header: the full sector stays active, and
+     * the next boot compacts it again from its last complete records */
+    HalStub_FlashPowerLoss(20);
+    TEST_CHECK(ParamStore_Service(&store, 1) != HAL_OK);
+    HalStub_FlashPowerLoss(-1);
+    TEST_CHECK(ParamStore_Init(&store, &defaults) == HAL_OK);
+    TEST_CHECK(store.generation == generation + 1);
+    TEST_NEAR(store.data.zones[2].setpoint, stored, 0.0f);
+
+    ParamStore_SetZone(&store, 2, &zone);
+    TEST_CHECK(ParamStore_Service(&store, 1) == HAL_OK);
+    ParamStore_Init(&store, &defaults);
+    TEST_NEAR(store.data.zones[2].setpoint, 230.0f, 0.0f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_defaults_on_blank_flash);
+    TEST_RUN(test_changes_persist);
+    TEST_RUN(test_torn_record_keeps_old_value);
+    TEST_RUN(test_failed_first_format_unusable);
+    TEST_RUN(test_compaction_only_when_allowed);
+    TEST_EXIT();
+}
@@ -0,0 +1,141 @@
+/**
+ * @file      test_pid.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the PID controller
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "pid.h"
+#include "test.h"
+
+static void test_proportional(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 2.0f, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, -50.0f, 50.0f, 0.25f);
+    TEST_NEAR(PID_Update(&pid, 100.0f, 90.0f), 20.0f, 1e-4f);
+    TEST_NEAR(PID_Update(&pid, 100.0f, 105.0f), -10.0f, 1e-4f);
+}
+
+static void test_integrator_trapezoidal_and_clamped(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 0.0f, 1.0f, 0.0f, 1.0f, -100.0f, 100.0f, -5.0f, 5.0f, 1.0f);
+    /* First step averages the error with the zero previous error */
+    TEST_NEAR(PID_Update(&pid, 2.0f, 0.0f), 1.0f, 1e-5f);
+    TEST_NEAR(PID_Update(&pid, 2.0f, 0.0f), 3.0f, 1e-5f);
+    for (int i = 0; i < 10; i++) {
+        PID_Update(&pid, 2.0f, 0.0f);
+    }
+    TEST_NEAR(pid.integrator, 5.0f, 1e-5f);
+    TEST_NEAR(pid.out, 5.0f, 1e-5f);
+}
+
+static void test_output_limits(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 10.0f, 0.0f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f, 0.25f);
+    TEST_NEAR(PID_Update(&pid, 200.0f, 20.0f), 100.0f, 1e-5f);
+    TEST_NEAR(PID_Update(&pid, 20.0f, 200.0f), 0.0f, 1e-5f);
+}
+
+static void test_derivative_on_measurement(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 0.0f, 0.0f, 1.0f, 0.0f, -100.0f, 100.0f, -100.0f, 100.0f, 1.0f);
+    PID_Update(&pid, 50.0f, 0.0f);
+    /* Setpoint steps do not kick, a rising measurement brakes */
+    TEST_NEAR(PID_Update(&pid, 80.0f, 0.0f), 0.0f, 1e-5f);
+    TEST_CHECK(PID_Update(&pid, 80.0f, 1.0f) < 0.0f);
+}
+
+static void test_feedforward_inside_limits(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 100.0f, -50.0f, 50.0f, 0.25f);
+    PID_SetFeedforward(&pid, 40.0f);
+    TEST_NEAR(PID_Update(&pid, 100.0f, 95.0f), 45.0f, 1e-5f);
+    PID_SetFeedforward(&pid, 120.0f);
+    TEST_NEAR(PID_Update(&pid, 100.0f, 95.0f), 100.0f, 1e-5f);
+    PID_Reset(&pid);
+    TEST_NEAR(pid.feedforward, 0.0f, 0.0f);
+}
+
+static void test_limit_output_gives_back(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 100.0f, -20.0f, 50.0f, 1.0f);
+    pid.integrator = 30.0f;
+    PID_Update(&pid, 100.0f, 90.0f);
+    TEST_NEAR(pid.out, 45.0f, 1e-4f);
+    PID_LimitOutput(&pid, 20.0f);
+    TEST_NEAR(pid.out, 20.0f, 1e-5f);
+    TEST_NEAR(pid.integrator, 10.0f, 1e-4f);
+    /* Past zero, down to the integrator limit */
+    PID_LimitOutput(&pid, -20.0f);
+    TEST_NEAR(pid.out, -20.0f, 1e-5f);
+    TEST_NEAR(pid.integrator, -20.0f, 1e-4f);
+    /* An applied value above the output moves it up, up to the limit */
+    PID_LimitOutput(&pid, 10.0f);
+    TEST_NEAR(pid.out, 10.0f, 1e-5f);
+    TEST_NEAR(pid.integrator, 10.0f, 1e-4f);
+    PID_LimitOutput(&pid, 100.0f);
+    TEST_NEAR(pid.integrator, 50.0f, 1e-4f);
+}
+
+static void test_bumpless_gain_change(void)
+{
+    PIDController pid;
+    float before;
+    float after;
+
+    PID_Init(&pid, 2.0f, 0.1f, 0.0f, 1.0f, -100.0f, 100.0f, -100.0f, 100.0f, 0.25f);
+    for (int i = 0; i < 20; i++) {
+        PID_Update(&pid, 200.0f, 190.0f);
+    }
+    before = PID_Update(&pid, 200.0f, 190.0f);
+    PID_UpdateGainsBumpless(&pid, 4.0f, 0.2f, 0.0f);
+    after = PID_Update(&pid, 200.0f, 190.0f);
+    /* Only the new integral increment separates the two outputs */
+    TEST_NEAR(after - before, 0.5f * 0.2f * 0.25f * 20.0f, 1e-3f);
+    TEST_NEAR(PID_GetKp(&pid), 4.0f, 0.0f);
+
+    PID_UpdateGains(&pid, 1.0f, 2.0f, 3.0f);
+    PIDGains gains = PID_GetGains(&pid);
+    TEST_NEAR(gains.Kp, 1.0f, 0.0f);
+    TEST_NEAR(gains.Ki, 2.0f, 0.0f);
+    TEST_NEAR(gains.Kd, 3.0f, 0.0f);
+}
+
+static void test_set_limits_clamps_state(void)
+{
+    PIDController pid;
+
+    PID_Init(&pid, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f, 1.0f);
+    for (int i = 0; i < 10; i++) {
+        PID_Update(&pid, 10.0f, 0.0f);
+    }
+    PID_SetLimits(&pid, 0.0f, 30.0f, 0.0f, 20.0f);
+    TEST_NEAR(pid.integrator, 20.0f, 0.0f);
+    TEST_NEAR(pid.out, 30.0f, 0.0f);
+    TEST_NEAR(PID_Update(&pid, 10.0f, 0.0f), 20.0f, 1e-5f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_proportional);
+    TEST_RUN(test_integrator_trapezoidal_and_clamped);
+    TEST_RUN(test_output_limits);
+    TEST_RUN(test_derivative_on_measurement);
+    TEST_RUN(test_feedforward_inside_limits);
+    TEST_RUN(test_limit_output_gives_back);
+    TEST_RUN(test_bumpless_gain_change);
+    TEST_RUN(test_set_limits_clamps_state);
+    TEST_EXIT();
+}
@@ -0,0 +1,142 @@
+/**
+ * @file      test_power_allocator.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the shared heater power budget
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "power_allocator.h"
+#include "control_bench.h"
+#include "test.h"
+
+static const PowerAllocator_Config_t config = {
+    .loads = 3,
+    .budget = 1000.0f,
+    .rated = { 400.0f, 400.0f, 400.0f },
+    .priority = { 1, 1, 1 },
+};
+
+static void test_within_budget(void)
+{
+    PowerAllocator_t pa;
+    const float request[3] = { 100.0f, 50.0f, 0.0f };
+    const float error[3] = { 10.0f, 10.0f, 10.0f };
+    float granted[3];
+
+    PowerAllocator_Init(&pa, &config);
+    TEST_NEAR(PowerAllocator_Allocate(&pa, request, error, granted), 600.0f, 1e-3f);
+    TEST_NEAR(granted[0], 100.0f, 1e-4f);
+    TEST_NEAR(granted[1], 50.0f, 1e-4f);
+    TEST_NEAR(granted[2], 0.0f, 1e-4f);
+    TEST_CHECK(pa.limited == 0);
+}
+
+static void test_shared_by_error(void)
+{
+    PowerAllocator_t pa;
+    const float request[3] = { 100.0f, 100.0f, 100.0f };
+    const float error[3] = { 30.0f, 10.0f, 10.0f };
+    float granted[3];
+
+    PowerAllocator_Init(&pa, &config);
+    TEST_NEAR(PowerAllocator_Allocate(&pa, request, error, granted), 1000.0f, 1e-3f);
+    /* 1000 W split 3:1:1, the coldest zone capped at its rating */
+    TEST_NEAR(granted[0], 100.0f, 1e-3f);
+    TEST_NEAR(granted[1], 75.0f, 1e-3f);
+    TEST_NEAR(granted[2], 75.0f, 1e-3f);
+    TEST_CHECK(pa.limited == 0x06);
+}
+
+static void test_priority_served_first(void)
+{
+    PowerAllocator_t pa;
+    PowerAllocator_Config_t c = config;
+    const float request[3] = { 100.0f, 100.0f, 100.0f };
+    const float error[3] = { 1.0f, 1.0f, 50.0f };
+    float granted[3];
+
+    c.budget = 600.0f;
+    c.priority[0] = 2;
+    PowerAllocator_Init(&pa, &c);
+    PowerAllocator_Allocate(&pa, request, error, granted);
+    TEST_NEAR(granted[0], 100.0f, 1e-3f);
+    TEST_NEAR(granted[1] + granted[2], 50.0f, 1e-3f);
+    TEST_CHECK(granted[2] > granted[1]);
+}
+
+static void test_requests_clamped(void)
+{
+    PowerAllocator_t pa;
+    const float request[3] = { -10.0f, 150.0f, 20.0f };
+    const float error[3] = { 0.0f, 0.0f, 0.0f };
+    float granted[3];
+
+    PowerAllocator_Init(&pa, &config);
+    PowerAllocator_Allocate(&pa, request, error, granted);
+    TEST_NEAR(granted[0], 0.0f, 1e-4f);
+    TEST_NEAR(granted[1], 100.0f, 1e-4f);
+    TEST_NEAR(granted[2], 20.0f, 1e-4f);
+}
+
+static void test_budget_cold_start(void)
+{
+    /* COLD_START to 200 °C, three 800 W zones (2400 W installed), losses
+     * about 1050 W at the setpoint: rise time and overshoot of every zone */
+    static const struct {
+        float budget;
+        float rise;
+        float overshoot;
+    } runs[] = {
+        { 0.0f,    456.0f, 6.2f },
+        { 2400.0f, 456.0f, 6.2f },
+        { 1800.0f, 684.0f, 0.0f },
+        { 1200.0f, 1457.0f, 0.0f },
+        { 900.0f,  -1.0f,  0.0f },  /* setpoint never reached */
+    };
+    Heaters_t heaters;
+    ThermalModel_t model;
+    PowerAllocator_t pa;
+    ControlBench_Result_t result;
+
+    for (uint32_t r = 0; r < sizeof(runs) / sizeof(runs[0]); r++) {
+        PowerAllocator_Config_t c = {
+            .loads = 3,
+            .budget = runs[r].budget,
+            .rated = { 800.0f, 800.0f, 800.0f },
+            .priority = { 1, 1, 1 },
+        };
+
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            model.zone[z] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 800.0f, 5.0f };
+            model.disturbance[z] = 0.0f;
+            model.dead_time[z] = 0.0f;
+        }
+        model.coupling[0] = 1.0f;
+        model.coupling[1] = 1.0f;
+        model.ambient = 25.0f;
+        Heaters_Init(&heaters, 0.25f);
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            Heaters_ConfigureZone(&heaters, z, 8.0f, 0.02f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        }
+        PowerAllocator_Init(&pa, &c);
+
+        ControlBench_Run(&result, CONTROL_BENCH_COLD_START, &heaters,
+                         (runs[r].budget > 0.0f) ? &pa : NULL, NULL, &model,
+                         200.0f, 3600.0f, NULL);
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            TEST_NEAR(result.zone[z].rise_time, runs[r].rise, 5.0f);
+            TEST_NEAR(result.zone[z].overshoot, runs[r].overshoot, 0.1f);
+        }
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_within_budget);
+    TEST_RUN(test_shared_by_error);
+    TEST_RUN(test_priority_served_first);
+    TEST_RUN(test_requests_clamped);
+    TEST_RUN(test_budget_cold_start);
+    TEST_EXIT();
+}
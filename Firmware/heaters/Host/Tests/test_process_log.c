@@ -0,0 +1,185 @@
+/**
+ * @file      test_process_log.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the flash-backed process log on the emulated flash
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "process_log.h"
+#include "hal_stub.h"
+#include "test.h"
+
+#define SECTOR_RECORDS  ((PROCESS_LOG_SECTOR_SIZE - sizeof(ProcessLog_SectorHeader_t)) / \
+                         sizeof(ProcessLog_Record_t))
+
+static uint8_t count_records(const ProcessLog_Record_t *record, void *ctx)
+{
+    uint32_t *last = (uint32_t *)ctx;
+
+    /* Oldest to newest, no gaps in the sequence */
+    TEST_CHECK(last[1] == 0 || record->sequence == last[0] + 1);
+    last[0] = record->sequence;
+    last[1]++;
+    return 0;
+}
+
+static uint32_t stream_count(const ProcessLog_t *log)
+{
+    uint32_t last[2] = { 0, 0 };
+
+    ProcessLog_Stream(log, count_records, last);
+    return last[1];
+}
+
+static HAL_StatusTypeDef append(ProcessLog_t *log, uint32_t minute)
+{
+    ProcessLog_Record_t rec = { .uptime_min = minute, .reserved = 0xFFFF };
+
+    return ProcessLog_Append(log, &rec);
+}
+
+static void fill(ProcessLog_t *log)
+{
+    while (log->write_offset + sizeof(ProcessLog_Record_t) <= PROCESS_LOG_SECTOR_SIZE) {
+        TEST_CHECK(append(log, log->sequence) == HAL_OK);
+    }
+}
+
+static void test_blank_flash_formatted(void)
+{
+    ProcessLog_t log;
+
+    HalStub_FlashWipe();
+    TEST_CHECK(ProcessLog_Init(&log) == HAL_OK);
+    TEST_CHECK(log.active == 0);
+    TEST_CHECK(log.generation == 1);
+    TEST_CHECK(log.write_offset == sizeof(ProcessLog_SectorHeader_t));
+    /* Blank sectors are not erased again */
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_6) == 0);
+    TEST_CHECK(stream_count(&log) == 0);
+}
+
+static void test_minute_summary(void)
+{
+    ProcessLog_t log;
+    const float temps[3] = { 200.0f, 210.25f, 220.5f };
+    const float power[3] = { 40.0f, 55.0f, 120.0f };
+    const ProcessLog_Record_t *rec;
+
+    HalStub_FlashWipe();
+    ProcessLog_Init(&log);
+    for (int i = 0; i < 239; i++) {
+        ProcessLog_Sample(&log, temps, power, 12.5f, (i == 7) ? 0x02 : 0, 0.25f);
+    }
+    TEST_CHECK(log.sequence == 0);
+    ProcessLog_Sample(&log, temps, power, 12.5f, 0, 0.25f);
+    TEST_CHECK(log.sequence == 1);
+
+    rec = (const ProcessLog_Record_t *)(0x08040000U + sizeof(ProcessLog_SectorHeader_t));
+    TEST_CHECK(rec->uptime_min == 1);
+    TEST_CHECK(rec->temp_avg[1] == 841);
+    TEST_CHECK(rec->temp_max[2] == 882);
+    TEST_CHECK(rec->power_avg[0] == 40 && rec->power_avg[2] == 100);
+    TEST_CHECK(rec->faults == 0x02);
+    TEST_CHECK(rec->throughput == 125);
+}
+
+static void test_recovery_after_reset(void)
+{
+    ProcessLog_t log;
+
+    HalStub_FlashWipe();
+    ProcessLog_Init(&log);
+    for (uint32_t i = 0; i < 10; i++) {
+        TEST_CHECK(append(&log, i) == HAL_OK);
+    }
+
+    TEST_CHECK(ProcessLog_Init(&log) == HAL_OK);
+    TEST_CHECK(log.sequence == 10);
+    TEST_CHECK(log.write_offset == sizeof(ProcessLog_SectorHeader_t) + 10 * sizeof(ProcessLog_Record_t));
+    TEST_CHECK(stream_count(&log) == 10);
+}
+
+static void test_torn_record_skipped(void)
+{
+    ProcessLog_t log;
+    uint32_t offset;
+
+    HalStub_FlashWipe();
+    ProcessLog_Init(&log);
+    append(&log, 0);
+    append(&log, 1);
+
+    /* Supply lost in the third word of the third record */
+    HalStub_FlashPowerLoss(2);
+    TEST_CHECK(append(&log, 2) != HAL_OK);
+    HalStub_FlashPowerLoss(-1);
+
+    ProcessLog_Init(&log);
+    offset = log.write_offset;
+    TEST_CHECK(offset == sizeof(ProcessLog_SectorHeader_t) + 3 * sizeof(ProcessLog_Record_t));
+    TEST_CHECK(stream_count(&log) == 2);
+    TEST_CHECK(log.sequence == 2);
+    TEST_CHECK(append(&log, 3) == HAL_OK);
+    TEST_CHECK(stream_count(&log) == 3);
+}
+
+static void test_full_sector_drops_without_erase(void)
+{
+    ProcessLog_t log;
+    uint32_t now;
+
+    HalStub_FlashWipe();
+    HalStub_Reset();
+    ProcessLog_Init(&log);
+    fill(&log);
+    TEST_CHECK(log.sequence == SECTOR_RECORDS);
+    TEST_CHECK(ProcessLog_RotateDue(&log));
+
+    /* Mid-run: no erase, no stall, the record is dropped and counted */
+    now = HAL_GetTick();
+    TEST_CHECK(append(&log, 0) == HAL_BUSY);
+    TEST_CHECK(append(&log, 0) == HAL_BUSY);
+    TEST_CHECK(log.dropped == 2);
+    TEST_CHECK(HAL_GetTick() == now);
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_6) == 0);
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_7) == 0);
+
+    /* Stopped: rotation to the blank sector, then back over the oldest data */
+    TEST_CHECK(ProcessLog_Rotate(&log) == HAL_OK);
+    TEST_CHECK(log.active == 1 && log.generation == 2);
+    fill(&log);
+    TEST_CHECK(ProcessLog_Rotate(&log) == HAL_OK);
+    TEST_CHECK(HalStub_FlashErases(FLASH_SECTOR_6) == 1);
+    TEST_CHECK(HAL_GetTick() - now == HalStub_FlashEraseMs(FLASH_SECTOR_6));
+    TEST_CHECK(log.active == 0 && log.erase_count == 1);
+    TEST_CHECK(stream_count(&log) == SECTOR_RECORDS);
+    TEST_CHECK(append(&log, 0) == HAL_OK);
+}
+
+static void test_boot_rotation(void)
+{
+    ProcessLog_t log;
+
+    HalStub_FlashWipe();
+    ProcessLog_Init(&log);
+    while (!ProcessLog_RotateDue(&log)) {
+        append(&log, 0);
+    }
+    TEST_CHECK(ProcessLog_Init(&log) == HAL_OK);
+    TEST_CHECK(log.active == 1);
+    TEST_CHECK(!ProcessLog_RotateDue(&log));
+    TEST_CHECK(log.sequence == (uint32_t)stream_count(&log));
+}
+
+int main(void)
+{
+    TEST_RUN(test_blank_flash_formatted);
+    TEST_RUN(test_minute_summary);
+    TEST_RUN(test_recovery_after_reset);
+    TEST_RUN(test_torn_record_skipped);
+    TEST_RUN(test_full_sector_drops_without_erase);
+    TEST_RUN(test_boot_rotation);
+    TEST_EXIT();
+}
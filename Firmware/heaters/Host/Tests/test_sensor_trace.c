@@ -0,0 +1,71 @@
+/**
+ * @file      test_sensor_trace.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the raw sensor flight recorder
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "sensor_trace.h"
+#include "test.h"
+
+static SensorTrace_t trace;
+
+static void test_records_in_order(void)
+{
+    SensorTrace_Record_t rec;
+
+    SensorTrace_Init(&trace);
+    TEST_CHECK(!SensorTrace_Next(&trace, &rec));
+    SensorTrace_Record(&trace, 10, SENSOR_TRACE_MAX6675, 2, 0x0640);
+    SensorTrace_Record(&trace, 20, SENSOR_TRACE_ZERO_CROSS, 1, 24);
+    TEST_CHECK(SensorTrace_Count(&trace) == 2);
+    TEST_CHECK(SensorTrace_Next(&trace, &rec));
+    TEST_CHECK(rec.time == 10 && rec.type == SENSOR_TRACE_MAX6675 &&
+               rec.channel == 2 && rec.value == 0x0640);
+    TEST_CHECK(SensorTrace_Next(&trace, &rec));
+    TEST_CHECK(rec.type == SENSOR_TRACE_ZERO_CROSS && rec.channel == 1 && rec.value == 24);
+    TEST_CHECK(SensorTrace_Count(&trace) == 0);
+}
+
+static void test_oldest_overwritten(void)
+{
+    SensorTrace_Record_t rec;
+
+    SensorTrace_Init(&trace);
+    for (uint32_t i = 0; i < SENSOR_TRACE_DEPTH + 10U; i++) {
+        SensorTrace_Record(&trace, i, SENSOR_TRACE_CONTROL_TICK, 0, (uint16_t)i);
+    }
+    TEST_CHECK(SensorTrace_Count(&trace) == SENSOR_TRACE_DEPTH);
+    TEST_CHECK(SensorTrace_Next(&trace, &rec));
+    TEST_CHECK(rec.time == 10);
+}
+
+static void test_freeze_keeps_lead_up(void)
+{
+    SensorTrace_Record_t rec;
+
+    SensorTrace_Init(&trace);
+    for (uint32_t i = 0; i < 100; i++) {
+        SensorTrace_Record(&trace, i, SENSOR_TRACE_CONTROL_TICK, 0, (uint16_t)i);
+    }
+    SensorTrace_Freeze(&trace);
+    for (uint32_t i = 100; i < 2U * SENSOR_TRACE_DEPTH; i++) {
+        SensorTrace_Record(&trace, i, SENSOR_TRACE_CONTROL_TICK, 0, (uint16_t)i);
+    }
+    TEST_CHECK(SensorTrace_Count(&trace) == 100);
+    TEST_CHECK(SensorTrace_Next(&trace, &rec) && rec.time == 0);
+
+    /* Acknowledged: recording carries on after the kept records */
+    SensorTrace_Resume(&trace);
+    SensorTrace_Record(&trace, 500, SENSOR_TRACE_CONTROL_TICK, 0, 500);
+    TEST_CHECK(SensorTrace_Count(&trace) == 100);
+}
+
+int main(void)
+{
+    TEST_RUN(test_records_in_order);
+    TEST_RUN(test_oldest_overwritten);
+    TEST_RUN(test_freeze_keeps_lead_up);
+    TEST_EXIT();
+}
@@ -0,0 +1,172 @@
+/**
+ * @file      test_smith_predictor.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the Smith predictor around the zone PID
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "smith_predictor.h"
+#include "control_bench.h"
+#include "test.h"
+
+static const ThermalModel_Zone_t zone = { 1000.0f, 1.0f, 400.0f, 0.0f };
+
+static void test_no_model_is_plain_pid(void)
+{
+    SmithPredictor_t sp;
+    PIDController pid;
+
+    SmithPredictor_Init(&sp, NULL, 10.0f, 1.0f);
+    PID_Init(&pid, 2.0f, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, -50.0f, 50.0f, 1.0f);
+    TEST_NEAR(SmithPredictor_Update(&sp, &pid, 100.0f, 90.0f, 50.0f), 20.0f, 1e-5f);
+    TEST_NEAR(sp.undelayed, 0.0f, 0.0f);
+}
+
+static void test_delay_rounded_and_capped(void)
+{
+    SmithPredictor_t sp;
+
+    SmithPredictor_Init(&sp, &zone, 10.0f, 0.25f);
+    TEST_CHECK(sp.delay == 40);
+    SmithPredictor_Init(&sp, &zone, 1.1f, 0.25f);
+    TEST_CHECK(sp.delay == 4);
+    SmithPredictor_Init(&sp, &zone, 600.0f, 0.25f);
+    TEST_CHECK(sp.delay == SMITH_PREDICTOR_MAX_DELAY);
+}
+
+static void test_model_output_fed_back_early(void)
+{
+    SmithPredictor_t sp;
+    PIDController pid;
+
+    SmithPredictor_Init(&sp, &zone, 3.0f, 1.0f);
+    PID_Init(&pid, 1.0f, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, -50.0f, 50.0f, 1.0f);
+
+    /* 200 W into 1000 J/°C: the undelayed model rises 0.2 °C in the first
+     * second and reaches the feedback before the delayed copy does */
+    TEST_NEAR(SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f), 9.8f, 1e-4f);
+    SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f);
+    SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f);
+    TEST_NEAR(sp.delayed, 0.0f, 0.0f);
+    SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f);
+    TEST_NEAR(sp.delayed, 0.2f, 1e-5f);
+    TEST_CHECK(sp.undelayed > sp.delayed);
+
+    /* Steady state: both copies equal, the PID sees the plain measurement */
+    for (int i = 0; i < 20000; i++) {
+        SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f);
+    }
+    TEST_NEAR(sp.undelayed, 200.0f, 0.1f);
+    TEST_NEAR(SmithPredictor_Update(&sp, &pid, 10.0f, 5.0f, 50.0f), 5.0f, 1e-3f);
+
+    SmithPredictor_Reset(&sp);
+    TEST_NEAR(sp.undelayed, 0.0f, 0.0f);
+    TEST_NEAR(sp.delayed, 0.0f, 0.0f);
+}
+
+static void test_set_model_keeps_state(void)
+{
+    SmithPredictor_t sp;
+    PIDController pid;
+    const ThermalModel_Zone_t identified = { 1200.0f, 1.1f, 400.0f, 0.0f };
+    float undelayed;
+
+    /* Off: nothing to update, the caller starts it with SmithPredictor_Init */
+    SmithPredictor_Init(&sp, NULL, 3.0f, 1.0f);
+    TEST_CHECK(!SmithPredictor_SetModel(&sp, &identified));
+    TEST_NEAR(sp.model.heat_capacity, 0.0f, 0.0f);
+
+    SmithPredictor_Init(&sp, &zone, 3.0f, 1.0f);
+    PID_Init(&pid, 1.0f, 0.0f, 0.0f, 1.0f, -100.0f, 100.0f, -50.0f, 50.0f, 1.0f);
+    for (int i = 0; i < 10; i++) {
+        SmithPredictor_Update(&sp, &pid, 10.0f, 0.0f, 50.0f);
+    }
+    undelayed = sp.undelayed;
+    TEST_CHECK(SmithPredictor_SetModel(&sp, &identified));
+    TEST_NEAR(sp.model.heat_capacity, 1200.0f, 0.0f);
+    TEST_NEAR(sp.undelayed, undelayed, 0.0f);
+    TEST_CHECK(sp.delay == 3);
+    TEST_CHECK(!SmithPredictor_SetModel(&sp, &(ThermalModel_Zone_t){ 0 }));
+}
+
+/**
+ * @brief SETPOINT_STEP to 200 °C of a coupled barrel with a given thermocouple
+ *        lag and reading dead time, with or without the predictor; its model
+ *        has the heat capacity and lag scaled by error and the loss divided
+ */
+static void bench_step(ControlBench_Result_t *result, float kp, float ki, float tc_tau,
+                       float dead_time, uint8_t smith, float error)
+{
+    Heaters_t heaters;
+    ThermalModel_t model = { 0 };
+    const ThermalModel_Zone_t truth = { 2000.0f, 2.0f, 800.0f, tc_tau };
+    const ThermalModel_Zone_t guess = { 2000.0f * error, 2.0f / error, 800.0f, tc_tau * error };
+
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        model.zone[z] = truth;
+        model.dead_time[z] = dead_time;
+    }
+    model.coupling[0] = 1.0f;
+    model.coupling[1] = 1.0f;
+    model.ambient = 25.0f;
+    Heaters_Init(&heaters, 0.25f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(&heaters, z, kp, ki, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        if (smith) {
+            Heaters_SetDeadTime(&heaters, z, &guess, dead_time);
+        }
+    }
+    ControlBench_Run(result, CONTROL_BENCH_SETPOINT_STEP, &heaters, NULL, NULL,
+                     &model, 200.0f, 3600.0f, NULL);
+}
+
+static void test_thermocouple_lag(void)
+{
+    ControlBench_Result_t plain;
+    ControlBench_Result_t smith;
+
+    /* Wall-mounted thermocouple, 30 s lag: settling 244 -> 121 s at
+     * Kp 8 / Ki 0.02 and 162 -> 113 s at Kp 80 / Ki 0.3, less overshoot */
+    bench_step(&plain, 8.0f, 0.02f, 30.0f, 0.0f, 0, 1.0f);
+    bench_step(&smith, 8.0f, 0.02f, 30.0f, 0.0f, 1, 1.0f);
+    TEST_NEAR(plain.zone[1].settling_time, 244.0f, 5.0f);
+    TEST_NEAR(smith.zone[1].settling_time, 121.0f, 5.0f);
+    TEST_CHECK(smith.zone[1].overshoot < plain.zone[1].overshoot);
+
+    bench_step(&plain, 80.0f, 0.3f, 30.0f, 0.0f, 0, 1.0f);
+    bench_step(&smith, 80.0f, 0.3f, 30.0f, 0.0f, 1, 1.0f);
+    TEST_NEAR(plain.zone[1].settling_time, 162.0f, 5.0f);
+    TEST_NEAR(smith.zone[1].settling_time, 113.0f, 5.0f);
+    TEST_CHECK(smith.zone[1].overshoot < plain.zone[1].overshoot);
+}
+
+static void test_pure_dead_time(void)
+{
+    ControlBench_Result_t plain;
+    ControlBench_Result_t smith;
+    ControlBench_Result_t wrong;
+
+    /* 10 s reading dead time at Kp 40 / Ki 0.1: the bare loop keeps
+     * oscillating out of the band for the whole hour, the predictor settles
+     * in 80 s, and within 90 s with the model 30 % off either way */
+    bench_step(&plain, 40.0f, 0.1f, 5.0f, 10.0f, 0, 1.0f);
+    bench_step(&smith, 40.0f, 0.1f, 5.0f, 10.0f, 1, 1.0f);
+    TEST_CHECK(plain.zone[1].settling_time > 3000.0f);
+    TEST_NEAR(smith.zone[1].settling_time, 80.0f, 5.0f);
+    bench_step(&wrong, 40.0f, 0.1f, 5.0f, 10.0f, 1, 1.3f);
+    TEST_CHECK(wrong.zone[1].settling_time < 90.0f);
+    bench_step(&wrong, 40.0f, 0.1f, 5.0f, 10.0f, 1, 0.7f);
+    TEST_CHECK(wrong.zone[1].settling_time < 90.0f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_no_model_is_plain_pid);
+    TEST_RUN(test_delay_rounded_and_capped);
+    TEST_RUN(test_model_output_fed_back_early);
+    TEST_RUN(test_set_model_keeps_state);
+    TEST_RUN(test_thermocouple_lag);
+    TEST_RUN(test_pure_dead_time);
+    TEST_EXIT();
+}
@@ -0,0 +1,145 @@
+/**
+ * @file      test_temp_estimator.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the per-zone Kalman temperature estimator
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "temp_estimator.h"
+#include "control_bench.h"
+#include "test.h"
+
+#include <math.h>
+
+static const TempEstimator_Config_t config = {
+    .model = { 2000.0f, 2.0f, 800.0f, 5.0f },
+    .ambient = 25.0f,
+    .q_temp = 1e-3f,
+    .q_rate = 1e-6f,
+    .r = 0.03f,
+};
+
+static void test_first_reading_primes(void)
+{
+    TempEstimator_t est;
+
+    TempEstimator_Init(&est, &config);
+    TEST_NEAR(est.temp, 25.0f, 0.0f);
+    TempEstimator_Predict(&est, 0.0f, 0.25f);
+    TempEstimator_Correct(&est, 180.0f);
+    TEST_NEAR(est.temp, 180.0f, 0.0f);
+    TEST_CHECK(est.primed);
+}
+
+static void test_tracks_model_between_readings(void)
+{
+    TempEstimator_t est;
+    ThermalModel_t model = { 0 };
+    const float command[THERMAL_MODEL_ZONES] = { 60.0f, 0.0f, 0.0f };
+    float worst = 0.0f;
+
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model.zone[z] = config.model;
+    }
+    ThermalModel_Init(&model, 25.0f);
+    TempEstimator_Init(&est, &config);
+
+    /* Quantized reading every 250 ms, the estimate is compared to the true
+     * thermocouple temperature once it has converged */
+    for (int k = 0; k < 4 * 1200; k++) {
+        TempEstimator_Predict(&est, command[0], 0.25f);
+        TempEstimator_Correct(&est, ThermalModel_ReadSensor(&model, 0));
+        ThermalModel_Step(&model, command, 0.25f);
+        if (k > 4 * 60) {
+            float error = (float)fabs(est.temp - model.tc_temp[0]);
+            worst = (error > worst) ? error : worst;
+        }
+    }
+    TEST_CHECK(worst < THERMAL_MODEL_QUANTUM);
+    TEST_CHECK(est.rate > 0.0f);
+}
+
+static void test_unexplained_rate_learned(void)
+{
+    TempEstimator_t est;
+    float truth = 100.0f;
+
+    /* Unpowered zone held 50 °C above ambient by an unmodelled 0.05 °C/s load */
+    TempEstimator_Init(&est, &config);
+    est.config.model.tc_tau = 0.0f;
+    TempEstimator_Correct(&est, truth);
+    for (int k = 0; k < 4 * 3600; k++) {
+        truth += 0.25f * (0.05f - 2.0f / 2000.0f * (truth - 25.0f));
+        TempEstimator_Predict(&est, 0.0f, 0.25f);
+        TempEstimator_Correct(&est, truth);
+    }
+    TEST_NEAR(est.x[2], 0.05f, 0.01f);
+    TEST_NEAR(est.temp, truth, 0.2f);
+}
+
+/**
+ * @brief SETPOINT_STEP of zone 1 with Kp 8 / Ki 0.02 / Kd 1500, through the
+ *        filters or on the raw readings, at a given control period (the
+ *        readings still come every CONTROL_BENCH_SENSOR_PERIOD)
+ */
+static void bench_step(ControlBench_Result_t *result, uint8_t filtered, float period)
+{
+    Heaters_t heaters;
+    ThermalModel_t model = { 0 };
+    TempEstimator_t est[HEATERS_ZONES];
+
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        model.zone[z] = config.model;
+        TempEstimator_Init(&est[z], &config);
+    }
+    model.coupling[0] = 1.0f;
+    model.coupling[1] = 1.0f;
+    model.ambient = 25.0f;
+    Heaters_Init(&heaters, period);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(&heaters, z, 8.0f, 0.02f, 1500.0f, 2.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    }
+    ControlBench_Run(result, CONTROL_BENCH_SETPOINT_STEP, &heaters, NULL, filtered ? est : NULL,
+                     &model, 200.0f, 3600.0f, NULL);
+}
+
+static void test_derivative_on_estimate(void)
+{
+    ControlBench_Result_t raw;
+    ControlBench_Result_t filtered;
+
+    /* The derivative chatters on the 0.25 °C steps of the raw readings:
+     * overshoot 3.06 -> 1.62 °C, settling 558 -> 91 s */
+    bench_step(&raw, 0, 0.25f);
+    bench_step(&filtered, 1, 0.25f);
+    TEST_NEAR(raw.zone[1].overshoot, 3.06f, 0.05f);
+    TEST_NEAR(filtered.zone[1].overshoot, 1.62f, 0.05f);
+    TEST_NEAR(raw.zone[1].settling_time, 558.0f, 5.0f);
+    TEST_NEAR(filtered.zone[1].settling_time, 91.0f, 5.0f);
+}
+
+static void test_faster_tick_no_gain(void)
+{
+    ControlBench_Result_t tick250;
+    ControlBench_Result_t tick50;
+
+    /* Five filter predictions per reading instead of one: within 10 % */
+    bench_step(&tick250, 1, 0.25f);
+    bench_step(&tick50, 1, 0.05f);
+    TEST_NEAR(tick50.zone[1].overshoot, tick250.zone[1].overshoot,
+              0.1f * tick250.zone[1].overshoot);
+    TEST_NEAR(tick50.zone[1].settling_time, tick250.zone[1].settling_time,
+              0.1f * tick250.zone[1].settling_time);
+    TEST_NEAR(tick50.zone[1].iae, tick250.zone[1].iae, 0.1f * tick250.zone[1].iae);
+}
+
+int main(void)
+{
+    TEST_RUN(test_first_reading_primes);
+    TEST_RUN(test_tracks_model_between_readings);
+    TEST_RUN(test_unexplained_rate_learned);
+    TEST_RUN(test_derivative_on_estimate);
+    TEST_RUN(test_faster_tick_no_gain);
+    TEST_EXIT();
+}
@@ -0,0 +1,123 @@
+/**
+ * @file      test_thermal_model.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the barrel thermal model
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "thermal_model.h"
+#include "test.h"
+
+static void model_setup(ThermalModel_t *model, float coupling)
+{
+    for (uint8_t zone = 0; zone < THERMAL_MODEL_ZONES; zone++) {
+        model->zone[zone] = (ThermalModel_Zone_t){ 2000.0f, 2.0f, 400.0f, 0.0f };
+        model->dead_time[zone] = 0.0f;
+    }
+    model->coupling[0] = coupling;
+    model->coupling[1] = coupling;
+    ThermalModel_Init(model, 25.0f);
+}
+
+static void test_first_order_step(void)
+{
+    ThermalModel_t model;
+    const float command[THERMAL_MODEL_ZONES] = { 50.0f, 50.0f, 50.0f };
+    float tau;
+    float gain;
+
+    model_setup(&model, 0.0f);
+    tau = ThermalModel_TimeConstant(&model, 0);
+    gain = ThermalModel_Gain(&model, 0);
+    TEST_NEAR(tau, 1000.0f, 1e-3f);
+    TEST_NEAR(gain, 2.0f, 1e-6f);
+
+    /* One time constant reaches 63.2 % of the final rise */
+    ThermalModel_Step(&model, command, tau);
+    TEST_NEAR(model.temp[0] - 25.0f, 0.632f * gain * 50.0f, 0.2f);
+    for (int i = 0; i < 10; i++) {
+        ThermalModel_Step(&model, command, tau);
+    }
+    TEST_NEAR(model.temp[0], 25.0f + gain * 50.0f, 0.01f);
+}
+
+static void test_coupling_conserves_heat(void)
+{
+    ThermalModel_t model;
+    const float command[THERMAL_MODEL_ZONES] = { 100.0f, 0.0f, 0.0f };
+
+    model_setup(&model, 1.0f);
+    ThermalModel_Step(&model, command, 600.0f);
+    /* Heat flows from the heated zone into its neighbour and on */
+    TEST_CHECK(model.temp[0] > model.temp[1]);
+    TEST_CHECK(model.temp[1] > model.temp[2]);
+    TEST_CHECK(model.temp[2] > 25.0f);
+}
+
+static void test_sensor_lag_and_quantization(void)
+{
+    ThermalModel_t model;
+    const float command[THERMAL_MODEL_ZONES] = { 100.0f, 100.0f, 100.0f };
+
+    model_setup(&model, 0.0f);
+    model.zone[0].tc_tau = 20.0f;
+    ThermalModel_Step(&model, command, 60.0f);
+    TEST_CHECK(model.tc_temp[0] < model.temp[0]);
+    TEST_NEAR(model.tc_temp[1], model.temp[1], 1e-6f);
+
+    model.tc_temp[2] = 123.37f;
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 2), 123.25f, 1e-6f);
+    model.tc_temp[2] = -5.0f;
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 2), 0.0f, 0.0f);
+}
+
+static void test_reading_dead_time(void)
+{
+    ThermalModel_t model;
+    const float command[THERMAL_MODEL_ZONES] = { 100.0f, 100.0f, 0.0f };
+    double past[121];
+
+    /* Rising at 0.2 °C/s: zone 0 reads 10 s late, zone 1 reads now */
+    model_setup(&model, 0.0f);
+    model.dead_time[0] = 10.0f;
+    for (int k = 0; k < 121; k++) {
+        past[k] = model.tc_temp[0];
+        ThermalModel_Step(&model, command, 0.25f);
+    }
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 0), past[121 - 40], THERMAL_MODEL_QUANTUM);
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 1), model.tc_temp[1], THERMAL_MODEL_QUANTUM);
+
+    /* Between history entries and within the last one, interpolated */
+    model.dead_time[0] = 10.125f;
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 0), model.tc_temp[0] - 10.125 * 0.2,
+              THERMAL_MODEL_QUANTUM);
+    model.dead_time[0] = 0.125f;
+    TEST_NEAR(ThermalModel_ReadSensor(&model, 0), model.tc_temp[0] - 0.125 * 0.2,
+              THERMAL_MODEL_QUANTUM);
+}
+
+static void test_command_clamped(void)
+{
+    ThermalModel_t a;
+    ThermalModel_t b;
+    const float over[THERMAL_MODEL_ZONES] = { 150.0f, -20.0f, 100.0f };
+    const float full[THERMAL_MODEL_ZONES] = { 100.0f, 0.0f, 100.0f };
+
+    model_setup(&a, 0.0f);
+    model_setup(&b, 0.0f);
+    ThermalModel_Step(&a, over, 30.0f);
+    ThermalModel_Step(&b, full, 30.0f);
+    TEST_NEAR(a.temp[0], b.temp[0], 1e-5f);
+    TEST_NEAR(a.temp[1], 25.0f, 1e-5f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_first_order_step);
+    TEST_RUN(test_coupling_conserves_heat);
+    TEST_RUN(test_sensor_lag_and_quantization);
+    TEST_RUN(test_reading_dead_time);
+    TEST_RUN(test_command_clamped);
+    TEST_EXIT();
+}
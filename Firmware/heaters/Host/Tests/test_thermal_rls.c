@@ -0,0 +1,151 @@
+/**
+ * @file      test_thermal_rls.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the online zone model identification
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "thermal_rls.h"
+#include "heaters.h"
+#include "test.h"
+
+static const ThermalModel_Zone_t truth = { 2000.0f, 1.2f, 400.0f, 0.0f };
+
+static void rls_setup(ThermalRLS_t *rls)
+{
+    const ThermalRLS_Config_t config = {
+        .dt = 0.25f,
+        .decimation = 40,
+        .delay = 1,
+        .lambda = 0.998f,
+        .p0 = 100.0f,
+        .p_max = 1000.0f,
+        .min_dy = 0.5f,
+        .min_du = 5.0f,
+        .prior = { 1500.0f, 1.5f, 400.0f, 0.0f },
+        .ambient = 20.0f,
+    };
+
+    ThermalRLS_Init(rls, &config);
+}
+
+static void test_prior_not_valid(void)
+{
+    ThermalRLS_t rls;
+    ThermalModel_Zone_t zone;
+
+    rls_setup(&rls);
+    TEST_NEAR(rls.tau, 1000.0f, 1.0f);
+    TEST_NEAR(rls.ambient, 20.0f, 0.01f);
+    TEST_CHECK(!rls.valid);
+    TEST_CHECK(!ThermalRLS_GetZone(&rls, &zone));
+}
+
+static void test_converges_on_power_steps(void)
+{
+    ThermalRLS_t rls;
+    ThermalModel_t model = { 0 };
+    ThermalModel_Zone_t zone;
+    float command[THERMAL_MODEL_ZONES] = { 0 };
+    static const float steps[] = { 60.0f, 20.0f, 80.0f, 40.0f, 70.0f, 10.0f, 50.0f, 90.0f };
+
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model.zone[z] = truth;
+    }
+    ThermalModel_Init(&model, 25.0f);
+    rls_setup(&rls);
+
+    /* Eight hours of 1 h power steps at the 250 ms control rate */
+    for (uint32_t k = 0; k < 8U * 3600U * 4U; k++) {
+        command[0] = steps[(k / (3600U * 4U)) % 8U];
+        ThermalRLS_Update(&rls, command[0], ThermalModel_ReadSensor(&model, 0));
+        ThermalModel_Step(&model, command, 0.25f);
+    }
+
+    TEST_CHECK(ThermalRLS_GetZone(&rls, &zone));
+    TEST_NEAR(zone.heat_capacity, truth.heat_capacity, 0.1f * truth.heat_capacity);
+    TEST_NEAR(zone.loss, truth.loss, 0.1f * truth.loss);
+    /* Loss and ambient trade off over the excited range, check what they
+     * predict together: the steady temperature at half power */
+    TEST_NEAR(rls.ambient + 0.5f * zone.heater_power / zone.loss,
+              25.0f + 0.5f * truth.heater_power / truth.loss, 2.0f);
+    TEST_NEAR(zone.heater_power, 400.0f, 0.0f);
+}
+
+static void test_hold_does_not_update(void)
+{
+    ThermalRLS_t rls;
+    uint32_t updates;
+
+    rls_setup(&rls);
+    for (int k = 0; k < 40 * 10; k++) {
+        ThermalRLS_Update(&rls, 30.0f, 150.0f);
+    }
+    updates = rls.updates;
+    TEST_CHECK(updates == 0);
+    /* Only every decimation-th call completes a step */
+    TEST_CHECK(!ThermalRLS_Update(&rls, 80.0f, 160.0f));
+}
+
+static void test_closed_loop_barrel(void)
+{
+    /* Coupled barrel under its own PIs, every setpoint changed each 30 min,
+     * every zone starting from the 1500 J/°C prior */
+    static const ThermalModel_Zone_t zones[3] = {
+        { 800.0f, 1.0f, 400.0f, 5.0f },
+        { 2000.0f, 1.2f, 400.0f, 5.0f },
+        { 3000.0f, 1.2f, 400.0f, 5.0f },
+    };
+    static const float setpoints[12][3] = {
+        { 203.0f, 186.0f, 237.0f }, { 195.0f, 221.0f, 190.0f }, { 232.0f, 199.0f, 214.0f },
+        { 184.0f, 238.0f, 201.0f }, { 219.0f, 192.0f, 183.0f }, { 238.0f, 213.0f, 226.0f },
+        { 190.0f, 182.0f, 209.0f }, { 226.0f, 230.0f, 188.0f }, { 209.0f, 205.0f, 235.0f },
+        { 181.0f, 217.0f, 196.0f }, { 236.0f, 188.0f, 221.0f }, { 198.0f, 226.0f, 185.0f },
+    };
+    ThermalModel_t model = { 0 };
+    Heaters_t heaters;
+    ThermalRLS_t rls[3];
+    ThermalModel_Zone_t zone;
+    float temps[3];
+
+    for (uint8_t z = 0; z < 3; z++) {
+        model.zone[z] = zones[z];
+    }
+    model.coupling[0] = 1.0f;
+    model.coupling[1] = 1.0f;
+    ThermalModel_Init(&model, 25.0f);
+    Heaters_Init(&heaters, 0.25f);
+    for (uint8_t z = 0; z < 3; z++) {
+        Heaters_ConfigureZone(&heaters, z, 8.0f, 0.02f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        rls_setup(&rls[z]);
+    }
+
+    for (uint32_t k = 0; k < 6U * 3600U * 4U; k++) {
+        const float *sp = setpoints[k / (1800U * 4U)];
+        for (uint8_t z = 0; z < 3; z++) {
+            temps[z] = ThermalModel_ReadSensor(&model, z);
+        }
+        Heaters_ControlStep(&heaters, sp, temps);
+        for (uint8_t z = 0; z < 3; z++) {
+            ThermalRLS_Update(&rls[z], heaters.power[z], temps[z]);
+        }
+        ThermalModel_Step(&model, heaters.power, 0.25f);
+    }
+
+    /* Heat capacity to within 20 % (15, 8 and 3 % after 6 h), loss and
+     * ambient take up the coupling */
+    for (uint8_t z = 0; z < 3; z++) {
+        TEST_CHECK(ThermalRLS_GetZone(&rls[z], &zone));
+        TEST_NEAR(zone.heat_capacity, zones[z].heat_capacity, 0.2f * zones[z].heat_capacity);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_prior_not_valid);
+    TEST_RUN(test_converges_on_power_steps);
+    TEST_RUN(test_hold_does_not_update);
+    TEST_RUN(test_closed_loop_barrel);
+    TEST_EXIT();
+}
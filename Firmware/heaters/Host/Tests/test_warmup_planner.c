@@ -0,0 +1,214 @@
+/**
+ * @file      test_warmup_planner.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the warm-up ramp planner
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "warmup_planner.h"
+#include "heaters.h"
+#include "power_allocator.h"
+#include "test.h"
+
+static const WarmupPlanner_Config_t config = {
+    .zone = {
+        { 1000.0f, 1.0f, 400.0f, 5.0f },
+        { 2000.0f, 1.0f, 400.0f, 5.0f },
+        { 1000.0f, 1.0f, 400.0f, 5.0f },
+    },
+    .ambient = 25.0f,
+    .budget = 1200.0f,
+    .headroom = 0.8f,
+    .ramp_limit = 0.0f,
+    .band = 5.0f,
+};
+
+static void test_slowest_zone_sets_duration(void)
+{
+    WarmupPlanner_t planner;
+    const float targets[3] = { 225.0f, 225.0f, 225.0f };
+    const float temps[3] = { 25.0f, 25.0f, 25.0f };
+
+    WarmupPlanner_Init(&planner, &config);
+    WarmupPlanner_Start(&planner, targets, temps);
+    /* Zone 1: 2000 J/°C * 200 °C / (320 W - 100 W mean loss) */
+    TEST_NEAR(planner.expected, 2000.0f * 200.0f / 220.0f, 0.5f);
+    TEST_CHECK(planner.active);
+}
+
+static void test_budget_and_ramp_limit(void)
+{
+    WarmupPlanner_t planner;
+    WarmupPlanner_Config_t c = config;
+    const float targets[3] = { 225.0f, 225.0f, 225.0f };
+    const float temps[3] = { 25.0f, 25.0f, 25.0f };
+
+    /* 800 kJ against 0.8 * 600 W - 300 W held */
+    c.budget = 600.0f;
+    WarmupPlanner_Init(&planner, &c);
+    WarmupPlanner_Start(&planner, targets, temps);
+    TEST_NEAR(planner.expected, 4000.0f * 200.0f / 180.0f, 1.0f);
+
+    c.budget = 1200.0f;
+    c.ramp_limit = 0.05f;
+    WarmupPlanner_Init(&planner, &c);
+    WarmupPlanner_Start(&planner, targets, temps);
+    TEST_NEAR(planner.expected, 200.0f / 0.05f, 1e-2f);
+}
+
+static void test_ramps_finish_together(void)
+{
+    WarmupPlanner_t planner;
+    const float targets[3] = { 225.0f, 125.0f, 225.0f };
+    float temps[3] = { 25.0f, 25.0f, 125.0f };
+    float sp[3];
+
+    WarmupPlanner_Init(&planner, &config);
+    WarmupPlanner_Start(&planner, targets, temps);
+    WarmupPlanner_Step(&planner, targets, temps, 0.5f * planner.expected, sp);
+    TEST_NEAR(sp[0], 125.0f, 0.01f);
+    TEST_NEAR(sp[1], 75.0f, 0.01f);
+    TEST_NEAR(sp[2], 175.0f, 0.01f);
+
+    /* At the end of the plan every ramp is at its target */
+    temps[0] = 224.0f;
+    temps[1] = 124.0f;
+    temps[2] = 226.0f;
+    WarmupPlanner_Step(&planner, targets, temps, planner.expected, sp);
+    TEST_NEAR(sp[0], 225.0f, 0.0f);
+    TEST_NEAR(sp[1], 125.0f, 0.0f);
+    TEST_CHECK(planner.actual > 0.0f);
+    TEST_CHECK(!planner.active);
+
+    /* Inactive: the targets pass through */
+    WarmupPlanner_Step(&planner, targets, temps, 1.0f, sp);
+    TEST_NEAR(sp[2], 225.0f, 0.0f);
+}
+
+static void test_new_targets_replan(void)
+{
+    WarmupPlanner_t planner;
+    float targets[3] = { 225.0f, 225.0f, 225.0f };
+    const float temps[3] = { 100.0f, 100.0f, 100.0f };
+    float sp[3];
+
+    WarmupPlanner_Init(&planner, &config);
+    WarmupPlanner_Start(&planner, targets, (const float[3]){ 25.0f, 25.0f, 25.0f });
+    WarmupPlanner_Step(&planner, targets, temps, 100.0f, sp);
+    targets[1] = 250.0f;
+    WarmupPlanner_Step(&planner, targets, temps, 0.0f, sp);
+    TEST_NEAR(planner.start[1], 100.0f, 0.0f);
+    TEST_NEAR(sp[1], 100.0f, 1e-3f);
+    WarmupPlanner_Stop(&planner);
+    TEST_CHECK(!planner.active);
+}
+
+/**
+ * @brief Closed-loop warm-up of a barrel with 800, 2000 and 3000 J/°C zones
+ *        to 200/210/220 °C under a 1000 W budget, as main runs it
+ *
+ * @param plan      Ramp through the planner, otherwise step the setpoints
+ * @param planner   Planner used (expected/actual figures)
+ * @param ready     Time each zone first came within the band [s]
+ * @param overshoot Largest overshoot of each zone [°C]
+ */
+static void barrel_warmup(uint8_t plan, WarmupPlanner_t *planner, float *ready, float *overshoot)
+{
+    const WarmupPlanner_Config_t c = {
+        .zone = {
+            { 800.0f, 1.0f, 400.0f, 5.0f },
+            { 2000.0f, 1.2f, 400.0f, 5.0f },
+            { 3000.0f, 1.2f, 400.0f, 5.0f },
+        },
+        .ambient = 25.0f,
+        .budget = 1000.0f,
+        .headroom = 0.95f,
+        .ramp_limit = 10.0f / 60.0f,
+        .band = 5.0f,
+    };
+    const PowerAllocator_Config_t pc = {
+        .loads = 3,
+        .budget = 1000.0f,
+        .rated = { 400.0f, 400.0f, 400.0f },
+        .priority = { 1, 1, 1 },
+    };
+    const float targets[3] = { 200.0f, 210.0f, 220.0f };
+    ThermalModel_t model = { 0 };
+    Heaters_t heaters;
+    PowerAllocator_t pa;
+    float temps[3], sp[3], error[3], granted[3];
+
+    for (uint8_t z = 0; z < 3; z++) {
+        model.zone[z] = c.zone[z];
+        ready[z] = -1.0f;
+        overshoot[z] = 0.0f;
+    }
+    model.coupling[0] = 1.0f;
+    model.coupling[1] = 1.0f;
+    ThermalModel_Init(&model, 25.0f);
+    Heaters_Init(&heaters, 0.25f);
+    for (uint8_t z = 0; z < 3; z++) {
+        Heaters_ConfigureZone(&heaters, z, 8.0f, 0.02f, 0.0f, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+        temps[z] = ThermalModel_ReadSensor(&model, z);
+    }
+    PowerAllocator_Init(&pa, &pc);
+    WarmupPlanner_Init(planner, &c);
+    if (plan) {
+        WarmupPlanner_Start(planner, targets, temps);
+    }
+
+    for (uint32_t k = 0; k < 4U * 4000U; k++) {
+        for (uint8_t z = 0; z < 3; z++) {
+            temps[z] = ThermalModel_ReadSensor(&model, z);
+        }
+        WarmupPlanner_Step(planner, targets, temps, 0.25f, sp);
+        Heaters_ControlStep(&heaters, sp, temps);
+        for (uint8_t z = 0; z < 3; z++) {
+            error[z] = sp[z] - temps[z];
+        }
+        PowerAllocator_Allocate(&pa, heaters.power, error, granted);
+        Heaters_LimitPower(&heaters, granted);
+        ThermalModel_Step(&model, heaters.power, 0.25f);
+        for (uint8_t z = 0; z < 3; z++) {
+            if (ready[z] < 0.0f && temps[z] > targets[z] - c.band) {
+                ready[z] = k * 0.25f;
+            }
+            if (temps[z] - targets[z] > overshoot[z]) {
+                overshoot[z] = temps[z] - targets[z];
+            }
+        }
+    }
+}
+
+static void test_barrel_zones_ready_together(void)
+{
+    WarmupPlanner_t planner;
+    float ready[3], overshoot[3];
+    float stepped, planned;
+
+    /* Stepped setpoints: the light zone is ready 592 s before the heavy one */
+    barrel_warmup(0, &planner, ready, overshoot);
+    stepped = ready[2] - ready[0];
+    TEST_NEAR(stepped, 592.0f, 5.0f);
+
+    /* Planned ramps: 220 s apart, the heavy zone trails the end of its ramp
+     * (it runs out of power at the top, where the loss is above the mean
+     * planned for) */
+    barrel_warmup(1, &planner, ready, overshoot);
+    planned = ready[2] - ready[0];
+    TEST_NEAR(planned, 220.0f, 5.0f);
+    TEST_NEAR(planner.expected, 2224.0f, 2.0f);
+    TEST_NEAR(planner.actual, 2392.0f, 5.0f);
+    TEST_CHECK(overshoot[0] < 1.0f && overshoot[1] < 2.0f && overshoot[2] < 4.0f);
+}
+
+int main(void)
+{
+    TEST_RUN(test_slowest_zone_sets_duration);
+    TEST_RUN(test_budget_and_ramp_limit);
+    TEST_RUN(test_ramps_finish_together);
+    TEST_RUN(test_new_targets_replan);
+    TEST_RUN(test_barrel_zones_ready_together);
+    TEST_EXIT();
+}
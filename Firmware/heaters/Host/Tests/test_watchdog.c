@@ -0,0 +1,119 @@
+/**
+ * @file      test_watchdog.c
+ * @author    Adrian Silva Palafox
+ * @brief     Unit tests of the task watchdog and its reset record
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "watchdog.h"
+#include "hal_stub.h"
+#include "test.h"
+
+/* Power-on, then every loop task registered with a 100 ms deadline */
+static void watchdog_setup(Watchdog_t *wd)
+{
+    HalStub_Reset();
+    Watchdog_Init(wd);
+    for (uint8_t task = WATCHDOG_TASK_SENSORS; task <= WATCHDOG_TASK_ENCODERS; task++) {
+        Watchdog_Register(wd, task, 100U);
+    }
+}
+
+/* Watchdog reset: RAM other than .noinit restarts, the record survives */
+static void watchdog_reset(Watchdog_t *wd)
+{
+    HalStub_Reset();
+    HalStub_RCC.CSR = RCC_CSR_IWDGRSTF | RCC_CSR_PINRSTF;
+    Watchdog_Init(wd);
+}
+
+static void test_power_on_no_record(void)
+{
+    Watchdog_t wd;
+
+    watchdog_setup(&wd);
+    TEST_CHECK(Watchdog_LastFailure() == NULL);
+    TEST_CHECK(HalStub_IWDG.RLR == WATCHDOG_TIMEOUT_MS / 2U - 1U);
+}
+
+static void test_stalled_task_withholds_kick(void)
+{
+    Watchdog_t wd;
+    const Watchdog_Record_t *record;
+
+    watchdog_setup(&wd);
+    HalStub_Advance(50U);
+    HalStub_IWDG.KR = 0;
+    TEST_CHECK(Watchdog_Service(&wd) == HAL_OK);
+    TEST_CHECK(HalStub_IWDG.KR == 0xAAAAU);
+
+    /* The firing task stops, everything else keeps checking in */
+    for (int i = 0; i < 15; i++) {
+        HalStub_Advance(10U);
+        Watchdog_CheckIn(&wd, WATCHDOG_TASK_SENSORS);
+        Watchdog_CheckIn(&wd, WATCHDOG_TASK_CONTROL);
+        Watchdog_CheckIn(&wd, WATCHDOG_TASK_ENCODERS);
+        HalStub_IWDG.KR = 0;
+        Watchdog_Service(&wd);
+    }
+    TEST_CHECK(wd.stalled);
+    TEST_CHECK(HalStub_IWDG.KR == 0);
+
+    /* Coming back does not bring the kicks back */
+    Watchdog_CheckIn(&wd, WATCHDOG_TASK_FIRING);
+    TEST_CHECK(Watchdog_Service(&wd) == HAL_TIMEOUT);
+    Watchdog_Restart(&wd);
+    TEST_CHECK(HalStub_IWDG.KR == 0);
+
+    watchdog_reset(&wd);
+    record = Watchdog_LastFailure();
+    TEST_CHECK(record != NULL);
+    TEST_CHECK(record->task == WATCHDOG_TASK_FIRING);
+    TEST_CHECK(record->overdue > 100U && record->overdue <= 110U);
+    TEST_CHECK(record->resets == 1);
+}
+
+static void test_hang_before_service(void)
+{
+    Watchdog_t wd;
+    const Watchdog_Record_t *record;
+
+    watchdog_setup(&wd);
+    for (int i = 0; i < 10; i++) {
+        HalStub_Advance(10U);
+        for (uint8_t task = WATCHDOG_TASK_SENSORS; task <= WATCHDOG_TASK_ENCODERS; task++) {
+            Watchdog_CheckIn(&wd, task);
+        }
+        TEST_CHECK(Watchdog_Service(&wd) == HAL_OK);
+    }
+
+    /* Next tick hangs in the control step: sensors read, nothing after */
+    HalStub_Advance(10U);
+    Watchdog_CheckIn(&wd, WATCHDOG_TASK_ENCODERS);
+    Watchdog_CheckIn(&wd, WATCHDOG_TASK_SENSORS);
+    HalStub_Advance(WATCHDOG_TIMEOUT_MS);
+
+    watchdog_reset(&wd);
+    record = Watchdog_LastFailure();
+    TEST_CHECK(record != NULL);
+    TEST_CHECK(record->task == WATCHDOG_TASK_CONTROL);
+    TEST_CHECK(record->last_task == WATCHDOG_TASK_SENSORS);
+    TEST_CHECK(record->tick == 110U);
+    TEST_CHECK(record->overdue == 10U);
+    TEST_CHECK(record->last[WATCHDOG_TASK_FIRING] == 100U);
+
+    /* A second hang in a row counts, a power-on forgets */
+    watchdog_reset(&wd);
+    TEST_CHECK(Watchdog_LastFailure()->resets == 2);
+    watchdog_setup(&wd);
+    TEST_CHECK(Watchdog_LastFailure() == NULL);
+}
+
+int main(void)
+{
+    TEST_RUN(test_power_on_no_record);
+    TEST_RUN(test_stalled_task_withholds_kick);
+    TEST_RUN(test_hang_before_service);
+    TEST_EXIT();
+}
@@ -0,0 +1,137 @@
+/**
+ * @file      test_zero_cross.c
+ * @author    Adrian Silva Palafox
+ * @brief     Zero-cross timing against the detector model, with glitches and
+ *            missing edges
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "zero_cross_model.h"
+#include "hal_stub.h"
+#include "test.h"
+
+static TIM_HandleTypeDef htim1;
+static TIM_HandleTypeDef htim2;
+static TriacFire_t fire;
+static ZeroCross_t zc;
+static ZeroCrossModel_t model;
+
+/**
+ * @brief Board timers as CubeMX leaves them, firing and zero-cross set up
+ */
+static void zc_setup(uint32_t half_cycle)
+{
+    HalStub_Reset();
+    htim2.Instance = TIM2;
+    TIM2->ARR = 8300U - 1U;
+    TIM2->SMCR = TIM_TS_TI2FP2 | TIM_SLAVEMODE_TRIGGER;
+    htim1.Instance = TIM1;
+    Profiling_Init();
+    TEST_CHECK(TriacFire_Init(&fire, &htim2) == HAL_OK);
+    TEST_CHECK(ZeroCross_Init(&zc, &fire, &htim1, ZERO_CROSS_OPTO_DELAY_US) == HAL_OK);
+    ZeroCrossModel_Init(&model, &zc, half_cycle, 600U);
+}
+
+static void test_locks_and_gates(void)
+{
+    zc_setup(TRIAC_FIRE_HALF_CYCLE_US);
+
+    /* Up to the rising edge of pulse 9 */
+    ZeroCrossModel_Run(&model, 10U * 8333U);
+    TEST_CHECK(zc.period > 0);
+    TEST_NEAR((float)zc.period / zc.cycles_per_us, 8333.0f, 2.0f);
+    TEST_CHECK(model.starts == 10);
+    TEST_CHECK(model.misfires == 0);
+    TEST_CHECK(zc.flywheel == 0);
+
+    /* Mid half-cycle the trigger is gated, inside the window it is not */
+    ZeroCrossModel_Run(&model, 4000U);
+    TEST_CHECK((TIM2->SMCR & TIM_SMCR_SMS) == 0);
+    ZeroCrossModel_Run(&model, 8333U - 4000U - 350U);
+    TEST_CHECK((TIM2->SMCR & TIM_SMCR_SMS) == TIM_SLAVEMODE_TRIGGER);
+    ZeroCrossModel_Run(&model, 1000U);
+    TEST_CHECK((TIM2->SMCR & TIM_SMCR_SMS) == 0);
+    TEST_CHECK(model.starts == 11);
+    TEST_CHECK(model.misfires == 0);
+}
+
+static void test_glitches_rejected(void)
+{
+    const uint32_t half = 8700U;    /* 57.5 Hz: 300 us between TIM2 and the window */
+    uint32_t glitches = 0;
+
+    zc_setup(half);
+    ZeroCrossModel_Run(&model, 10U * half);
+
+    /* From pulse 10 on, a glitch mid half-cycle (TIM2 running) and one in the
+     * gap after TIM2 has stopped, before the window */
+    for (uint32_t k = 10; k < 30; k++) {
+        uint32_t rise = (k + 1U) * half - 300U;
+        TEST_CHECK(ZeroCrossModel_AddGlitch(&model, rise + 4000U, 5U) == HAL_OK);
+        TEST_CHECK(ZeroCrossModel_AddGlitch(&model, rise + 8400U, 30U) == HAL_OK);
+        glitches += 2U;
+    }
+    ZeroCrossModel_Run(&model, 22U * half);
+    ZeroCross_Update(&zc, &fire);
+
+    TEST_CHECK(model.misfires == 0);
+    TEST_CHECK(model.worst_phase <= 2);
+    TEST_CHECK(model.glitch_starts == 0);
+    TEST_CHECK(model.starts == 32);
+    TEST_CHECK(zc.rejected >= glitches);
+    TEST_CHECK(zc.flywheel == 0);
+    TEST_NEAR((float)zc.period / zc.cycles_per_us, (float)half, 2.0f);
+    TEST_NEAR(zc.width, 600.0f, 2.0f);
+}
+
+static void test_missing_edges(void)
+{
+    zc_setup(TRIAC_FIRE_HALF_CYCLE_US);
+
+    /* A few missing edges: the flywheel fires them at the right phase */
+    ZeroCrossModel_Drop(&model, 10U, 3U);
+    ZeroCrossModel_Run(&model, 20U * 8333U);
+    TEST_CHECK(zc.flywheel == 3);
+    TEST_CHECK(!zc.lost);
+    TEST_CHECK(model.starts == 20);
+    TEST_CHECK(model.misfires == 0);
+
+    /* Too many: lost, the flywheel stops, the next real edge recovers */
+    ZeroCrossModel_Drop(&model, 25U, 20U);
+    ZeroCrossModel_Run(&model, 30U * 8333U);
+    TEST_CHECK(zc.flywheel == 3U + ZERO_CROSS_LOST_LIMIT);
+    TEST_CHECK(model.starts == 50U - 20U + ZERO_CROSS_LOST_LIMIT);
+    TEST_CHECK(model.misfires == 0);
+    TEST_CHECK(!zc.lost);
+    TEST_CHECK(zc.missed == 0);
+}
+
+static void test_killed_never_starts(void)
+{
+    uint32_t starts;
+
+    zc_setup(TRIAC_FIRE_HALF_CYCLE_US);
+    ZeroCrossModel_Run(&model, 10U * 8333U + 4000U);
+    TriacFire_Kill(&fire);
+    starts = model.starts;
+
+    /* Neither the window, the edges nor the flywheel start it again */
+    ZeroCrossModel_Run(&model, 10U * 8333U);
+    TEST_CHECK(model.starts == starts);
+    TEST_CHECK((TIM2->SMCR & TIM_SMCR_SMS) == 0);
+
+    TriacFire_Arm(&fire);
+    ZeroCrossModel_Run(&model, 10U * 8333U);
+    TEST_CHECK(model.starts == starts + 10U);
+    TEST_CHECK(model.misfires == 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_locks_and_gates);
+    TEST_RUN(test_glitches_rejected);
+    TEST_RUN(test_missing_edges);
+    TEST_RUN(test_killed_never_starts);
+    TEST_EXIT();
+}
@@ -0,0 +1,244 @@
+/**
+ * @file      control_bench.c
+ * @author    Adrian Silva Palafox
+ * @brief     Closed-loop benchmark scenarios implementation
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "control_bench.h"
+#include <stdio.h>
+
+static const char *const scenario_names[CONTROL_BENCH_SCENARIOS] = {
+    "cold_start", "setpoint_step", "pellet_feed", "tc_dropout", "setpoint_ramp"
+};
+
+/**
+ * @brief Cycle statistics of the control step
+ */
+typedef struct {
+    uint32_t max;
+    uint64_t total;
+    uint32_t count;
+} bench_cycles_t;
+
+/**
+ * @brief One control step, limited by the shared budget when there is one
+ */
+static void bench_step(Heaters_t *heaters, PowerAllocator_t *allocator,
+                       const float *setpoints, const float *temps)
+{
+    Heaters_ControlStep(heaters, setpoints, temps);
+
+    if (allocator != NULL) {
+        float error[HEATERS_ZONES];
+        float granted[HEATERS_ZONES];
+        for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+            error[zone] = setpoints[zone] - temps[zone];
+        }
+        PowerAllocator_Allocate(allocator, heaters->power, error, granted);
+        Heaters_LimitPower(heaters, granted);
+    }
+}
+
+/**
+ * @brief Close the loop for a number of control periods
+ *
+ * @param heaters   Heater zones
+ * @param allocator Shared power budget or NULL
+ * @param estimators Per-zone filters the controller reads through, or NULL
+ * @param model     Barrel model
+ * @param setpoints Zone setpoints [°C], ramped towards target
+ * @param target    Final setpoint of the ramp [°C]
+ * @param rate      Setpoint ramp rate [°C/s], 0 to hold the setpoints
+ * @param temps     Temperatures seen by the controller, kept between calls
+ * @param duration  Time to run [s]
+ * @param result    Figures to update, NULL for an unscored run
+ * @param hold_zone Zone whose reading is frozen, HEATERS_ZONES for none
+ * @param hold_time Time the reading stays frozen [s]
+ * @param cycles    Cycle counter read function or NULL
+ * @param stats     Cycle statistics to update
+ */
+static void bench_loop(Heaters_t *heaters, PowerAllocator_t *allocator,
+                       TempEstimator_t *estimators, ThermalModel_t *model, float *setpoints,
+                       float target, float rate, float *temps, float duration, ControlBench_Result_t *result,
+                       uint8_t hold_zone, float hold_time,
+                       uint32_t (*cycles)(void), bench_cycles_t *stats)
+{
+    uint32_t ticks = (uint32_t)(duration / heaters->T + 0.5f);
+    uint32_t every = (uint32_t)(CONTROL_BENCH_SENSOR_PERIOD / heaters->T + 0.5f);
+    float t = 0.0f;
+
+    if (every == 0) {
+        every = 1;
+    }
+
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+            if (rate > 0.0f && setpoints[zone] < target) {
+                setpoints[zone] += rate * heaters->T;
+                if (setpoints[zone] > target) {
+                    setpoints[zone] = target;
+                }
+            }
+        }
+
+        for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+            uint8_t fresh = (tick % every == 0) && (zone != hold_zone || t >= hold_time);
+
+            if (estimators != NULL) {
+                /* A held reading is a missing one for the filter */
+                TempEstimator_Predict(&estimators[zone], heaters->power[zone], heaters->T);
+                if (fresh) {
+                    TempEstimator_Correct(&estimators[zone], ThermalModel_ReadSensor(model, zone));
+                }
+                temps[zone] = estimators[zone].temp;
+            } else if (fresh) {
+                temps[zone] = ThermalModel_ReadSensor(model, zone);
+            }
+        }
+
+        if (cycles != NULL) {
+            uint32_t start = cycles();
+            bench_step(heaters, allocator, setpoints, temps);
+            uint32_t elapsed = cycles() - start;
+            if (elapsed > stats->max) {
+                stats->max = elapsed;
+            }
+            stats->total += elapsed;
+            stats->count++;
+        } else {
+            bench_step(heaters, allocator, setpoints, temps);
+        }
+
+        ThermalModel_Step(model, heaters->power, heaters->T);
+        t += heaters->T;
+
+        if (result != NULL) {
+            for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+                ControlMetrics_Update(&result->zone[zone], model->tc_temp[zone],
+                                      heaters->power[zone], heaters->T);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Run one scenario
+ *
+ * @param result    Destination of the figures
+ * @param scenario  Scenario to run
+ * @param heaters   Configured heater zones
+ * @param allocator Shared power budget, NULL for none
+ * @param estimators Per-zone filters the controller reads through, NULL for
+ *                  the raw readings
+ * @param model     Barrel model with its parameters filled in
+ * @param setpoint  Final setpoint of every zone [°C]
+ * @param duration  Scored time [s]
+ * @param cycles    Cycle counter read function, NULL to skip timing
+ */
+void ControlBench_Run(ControlBench_Result_t *result, ControlBench_Scenario_t scenario,
+                      Heaters_t *heaters, PowerAllocator_t *allocator,
+                      TempEstimator_t *estimators, ThermalModel_t *model,
+                      float setpoint, float duration, uint32_t (*cycles)(void))
+{
+    float setpoints[HEATERS_ZONES];
+    float temps[HEATERS_ZONES];
+    bench_cycles_t stats = { 0, 0, 0 };
+    uint8_t hold_zone = HEATERS_ZONES;
+    float rate = 0.0f;
+
+    ThermalModel_Init(model, model->ambient);
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        PID_Reset(&heaters->pid[zone]);
+        SmithPredictor_Reset(&heaters->smith[zone]);
+        Feedforward_Reset(&heaters->feedforward[zone]);
+        heaters->power[zone] = 0.0f;
+        temps[zone] = ThermalModel_ReadSensor(model, zone);
+        if (estimators != NULL) {
+            TempEstimator_Init(&estimators[zone], &estimators[zone].config);
+        }
+    }
+
+    /* Unscored warm-up for the scenarios that start settled */
+    if (scenario != CONTROL_BENCH_COLD_START) {
+        float warm = setpoint;
+        if (scenario == CONTROL_BENCH_SETPOINT_STEP) {
+            warm = setpoint - CONTROL_BENCH_STEP;
+        } else if (scenario == CONTROL_BENCH_SETPOINT_RAMP) {
+            warm = setpoint - CONTROL_BENCH_RAMP_SPAN;
+        }
+        for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+            setpoints[zone] = warm;
+        }
+        bench_loop(heaters, allocator, estimators, model, setpoints, warm, 0.0f, temps, duration,
+                   NULL, HEATERS_ZONES, 0.0f, NULL, &stats);
+    }
+
+    if (scenario == CONTROL_BENCH_PELLET_FEED) {
+        model->disturbance[0] = -CONTROL_BENCH_PELLET_LOAD;
+    } else if (scenario == CONTROL_BENCH_TC_DROPOUT) {
+        hold_zone = CONTROL_BENCH_DROPOUT_ZONE;
+    } else if (scenario == CONTROL_BENCH_SETPOINT_RAMP) {
+        rate = CONTROL_BENCH_RAMP_RATE;
+    }
+
+    result->scenario = scenario;
+    for (uint8_t zone = 0; zone < HEATERS_ZONES; zone++) {
+        if (rate == 0.0f) {
+            setpoints[zone] = setpoint;
+        }
+        ControlMetrics_Start(&result->zone[zone], model->tc_temp[zone], setpoint,
+                             CONTROL_BENCH_BAND);
+    }
+
+    bench_loop(heaters, allocator, estimators, model, setpoints, setpoint, rate, temps, duration,
+               result, hold_zone, CONTROL_BENCH_DROPOUT_TIME, cycles, &stats);
+
+    result->cycles_max = stats.max;
+    result->cycles_mean = (stats.count > 0) ? (uint32_t)(stats.total / stats.count) : 0;
+}
+
+/**
+ * @brief Name of a scenario, as in the CSV lines
+ *
+ * @param scenario    Scenario
+ * @return const char* Name, NULL for an unknown scenario
+ */
+const char *ControlBench_Name(ControlBench_Scenario_t scenario)
+{
+    return (scenario < CONTROL_BENCH_SCENARIOS) ? scenario_names[scenario] : NULL;
+}
+
+/**
+ * @brief Format the figures of one zone as a CSV line
+ *
+ * @param result Results of a scenario
+ * @param zone   Zone index
+ * @param buf    Destination buffer
+ * @param size   Buffer size
+ * @return int   Line length
+ */
+int ControlBench_Format(const ControlBench_Result_t *result, uint8_t zone,
+                        char *buf, uint32_t size)
+{
+    const ControlMetrics_t *m;
+
+    if (zone >= HEATERS_ZONES || result->scenario >= CONTROL_BENCH_SCENARIOS) {
+        return -1;
+    }
+    m = &result->zone[zone];
+
+    /* Fixed point fields, so two runs compare with a plain diff */
+    return snprintf(buf, size, "%s,%u,%ld,%ld,%ld,%ld,%ld,%ld,%ld,%lu,%lu\n",
+                    scenario_names[result->scenario], zone,
+                    (m->rise_time < 0.0f) ? -1L : (long)(m->rise_time * 1000.0f),
+                    (long)(m->overshoot * 1000.0f),
+                    (long)(m->settling_time * 1000.0f),
+                    (long)(m->ripple * 1000.0f),
+                    (long)(m->max_error * 1000.0f),
+                    (long)(m->iae * 1000.0f),
+                    (long)m->energy,
+                    (unsigned long)result->cycles_max,
+                    (unsigned long)result->cycles_mean);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file      control_bench.h
+ * @author    Adrian Silva Palafox
+ * @brief     Standard closed-loop scenarios for benchmarking the heater control
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Runs the heater control step against the barrel thermal model on a
+ *            fixed set of scenarios and scores every zone with the control
+ *            metrics:
+ *
+ *              - COLD_START:    all zones from ambient to the setpoint
+ *              - SETPOINT_STEP: settled CONTROL_BENCH_STEP below the setpoint,
+ *                               then stepped to it
+ *              - PELLET_FEED:   settled at the setpoint, then cold pellets start
+ *                               drawing CONTROL_BENCH_PELLET_LOAD from the feed
+ *                               zone
+ *              - TC_DROPOUT:    settled at the setpoint, then one thermocouple
+ *                               holds its last reading for
+ *                               CONTROL_BENCH_DROPOUT_TIME
+ *              - SETPOINT_RAMP: settled CONTROL_BENCH_RAMP_SPAN below the
+ *                               setpoint, then ramped to it at
+ *                               CONTROL_BENCH_RAMP_RATE (scored against the
+ *                               final setpoint, so a lagging zone shows up in
+ *                               the IAE and settling time)
+ *
+ *            With a power allocator the zones share its budget, e.g. to compare
+ *            COLD_START warm-up times against the budget. With temperature
+ *            estimators the controller reads the filtered temperatures instead
+ *            of the raw readings (a frozen TC_DROPOUT reading is then a
+ *            missing one), to compare both on the same scenarios.
+ *
+ *            Scores use the true thermocouple temperature of the model, not the
+ *            quantized reading the controller sees. Every result is emitted as a
+ *            CSV line with integer fields so runs can be diffed and compared
+ *            whenever pid.c changes.
+ *
+ *            Tools/control_bench_main.c runs the scenarios from the command
+ *            line, gain_sweep scores gain grids with them.
+ *
+ * @note      Host builds only. Cycle counts are taken through an optional
+ *            callback.
+ */
+
+#ifndef HOST_CONTROL_BENCH_H_
+#define HOST_CONTROL_BENCH_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "heaters.h"
+#include "thermal_model.h"
+#include "control_metrics.h"
+#include "power_allocator.h"
+#include "temp_estimator.h"
+#include <stdint.h>
+
+/* Configuration Constants --------------------------------------------------*/
+/**
+ * @brief Settling band half-width [°C]
+ */
+#define CONTROL_BENCH_BAND          2.0f
+
+/**
+ * @brief Setpoint step of SETPOINT_STEP [°C]
+ */
+#define CONTROL_BENCH_STEP          20.0f
+
+/**
+ * @brief Heat drawn from the feed zone by cold pellets [W]
+ */
+#define CONTROL_BENCH_PELLET_LOAD   150.0f
+
+/**
+ * @brief Setpoint ramp of SETPOINT_RAMP: span [°C] and rate [°C/s]
+ */
+#define CONTROL_BENCH_RAMP_SPAN     50.0f
+#define CONTROL_BENCH_RAMP_RATE     (10.0f / 60.0f)
+
+/**
+ * @brief Time between thermocouple readings [s] (MAX6675 conversion time);
+ *        a faster control period sees the same reading several times
+ */
+#define CONTROL_BENCH_SENSOR_PERIOD 0.25f
+
+/**
+ * @brief Thermocouple dropout duration and affected zone
+ */
+#define CONTROL_BENCH_DROPOUT_TIME  30.0f
+#define CONTROL_BENCH_DROPOUT_ZONE  1
+
+/**
+ * @brief Column names of ControlBench_Format() lines
+ */
+#define CONTROL_BENCH_CSV_HEADER \
+    "scenario,zone,rise_ms,overshoot_mC,settling_ms,ripple_mC,max_error_mC," \
+    "iae_mCs,energy_pct_s,cycles_max,cycles_mean\n"
+
+/* Type Definitions ---------------------------------------------------------*/
+/**
+ * @brief Benchmark scenarios
+ */
+typedef enum {
+    CONTROL_BENCH_COLD_START = 0,
+    CONTROL_BENCH_SETPOINT_STEP,
+    CONTROL_BENCH_PELLET_FEED,
+    CONTROL_BENCH_TC_DROPOUT,
+    CONTROL_BENCH_SETPOINT_RAMP,
+    CONTROL_BENCH_SCENARIOS
+} ControlBench_Scenario_t;
+
+/**
+ * @brief Results of one scenario
+ */
+typedef struct {
+    ControlBench_Scenario_t scenario;               /**< Scenario that was run */
+    ControlMetrics_t zone[HEATERS_ZONES];           /**< Per-zone figures */
+    uint32_t cycles_max;                            /**< Worst control step [cycles] */
+    uint32_t cycles_mean;                           /**< Average control step [cycles] */
+} ControlBench_Result_t;
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Run one scenario
+ * @details The model is reset to its ambient temperature and the controllers
+ *          to their initial state. Scenarios that start settled first run an
+ *          unscored warm-up of the same duration.
+ * @param   result      Destination of the figures
+ * @param   scenario    Scenario to run
+ * @param   heaters     Configured heater zones, the period sets the step size
+ * @param   allocator   Shared power budget over the zones, NULL for none
+ * @param   estimators  Per-zone filters (configured) the controller reads
+ *                      through, NULL for the raw readings
+ * @param   model       Barrel model with its parameters filled in
+ * @param   setpoint    Final setpoint of every zone [°C]
+ * @param   duration    Scored time [s]
+ * @param   cycles      Cycle counter read function, NULL to skip timing
+ */
+void ControlBench_Run(ControlBench_Result_t *result, ControlBench_Scenario_t scenario,
+                      Heaters_t *heaters, PowerAllocator_t *allocator,
+                      TempEstimator_t *estimators, ThermalModel_t *model,
+                      float setpoint, float duration, uint32_t (*cycles)(void));
+
+/**
+ * @brief   Name of a scenario, as in the CSV lines
+ * @param   scenario    Scenario
+ * @return  const char* Name, NULL for an unknown scenario
+ */
+const char *ControlBench_Name(ControlBench_Scenario_t scenario);
+
+/**
+ * @brief   Format the figures of one zone as a CSV line
+ * @param   result      Results of a scenario
+ * @param   zone        Zone index
+ * @param   buf         Destination buffer
+ * @param   size        Buffer size
+ * @return  int         Line length, as returned by snprintf()
+ */
+int ControlBench_Format(const ControlBench_Result_t *result, uint8_t zone,
+                        char *buf, uint32_t size);
+
+#endif /* HOST_CONTROL_BENCH_H_ */
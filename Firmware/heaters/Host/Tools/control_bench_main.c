@@ -0,0 +1,118 @@
+/**
+ * @file      control_bench_main.c
+ * @author    Adrian Silva Palafox
+ * @brief     Command line front end of the control bench
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Runs control bench scenarios on the reference barrel
+ *            (sim_plant.c) and prints one CSV line per scenario and zone:
+ *
+ *              control_bench [--scenario NAME|all] [--kp KP] [--ki KI]
+ *                            [--setpoint C] [--duration S] [--budget W]
+ *                            [--estimator]
+ *
+ *            --budget shares the given power over the zones through the
+ *            power allocator, --estimator makes the controllers read the
+ *            Kalman estimates instead of the raw readings. The cycle columns
+ *            stay 0, timing is only meaningful on the target.
+ */
+
+#include "control_bench.h"
+#include "sim_plant.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private functions --------------------------------------------------------*/
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--scenario NAME|all] [--kp KP] [--ki KI] [--setpoint C]\n"
+                    "       [--duration S] [--budget W] [--estimator]\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    Heaters_t heaters;
+    ThermalModel_t model;
+    PowerAllocator_t allocator;
+    TempEstimator_t estimators[HEATERS_ZONES];
+    ControlBench_Result_t result;
+    uint32_t first = 0;
+    uint32_t last = CONTROL_BENCH_SCENARIOS - 1U;
+    float kp = SIM_KP;
+    float ki = SIM_KI;
+    float setpoint = 200.0f;
+    float duration = 3600.0f;
+    float budget = 0.0f;
+    uint8_t estimate = 0;
+    char line[128];
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "all") != 0) {
+                first = 0;
+                while (first < CONTROL_BENCH_SCENARIOS &&
+                       strcmp(argv[i], ControlBench_Name((ControlBench_Scenario_t)first)) != 0) {
+                    first++;
+                }
+                if (first == CONTROL_BENCH_SCENARIOS) {
+                    bench_usage(argv[0]);
+                    return 2;
+                }
+                last = first;
+            }
+        } else if (strcmp(argv[i], "--kp") == 0 && i + 1 < argc) {
+            kp = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--ki") == 0 && i + 1 < argc) {
+            ki = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--setpoint") == 0 && i + 1 < argc) {
+            setpoint = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+            duration = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budget = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--estimator") == 0) {
+            estimate = 1;
+        } else {
+            bench_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    fputs(CONTROL_BENCH_CSV_HEADER, stdout);
+    for (uint32_t s = first; s <= last; s++) {
+        SimPlant_Model(&model);
+        SimPlant_Heaters(&heaters, kp, ki, 0.0f);
+        if (budget > 0.0f) {
+            PowerAllocator_Config_t config = { .loads = HEATERS_ZONES, .budget = budget };
+            for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+                config.rated[z] = model.zone[z].heater_power;
+                config.priority[z] = 1;
+            }
+            PowerAllocator_Init(&allocator, &config);
+        }
+        if (estimate) {
+            for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+                const TempEstimator_Config_t config = {
+                    .model = model.zone[z],
+                    .ambient = SIM_AMBIENT,
+                    .q_temp = 1e-3f,
+                    .q_rate = 1e-6f,
+                    .r = 0.03f,
+                };
+                TempEstimator_Init(&estimators[z], &config);
+            }
+        }
+
+        ControlBench_Run(&result, (ControlBench_Scenario_t)s, &heaters,
+                         (budget > 0.0f) ? &allocator : NULL, estimate ? estimators : NULL,
+                         &model, setpoint, duration, NULL);
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            ControlBench_Format(&result, z, line, sizeof(line));
+            fputs(line, stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file      gain_sweep.c
+ * @author    Adrian Silva Palafox
+ * @brief     Parallel PI gain sweep with Pareto ranking of the step responses
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Scores every Kp x Ki pair of a grid with a control bench scenario
+ *            on the reference barrel (sim_plant.c), spreading the runs over
+ *            worker threads, and marks the gain sets no other set dominates
+ *            (ControlMetrics_Dominates(): settling time, overshoot, IAE and
+ *            energy):
+ *
+ *              gain_sweep [--kp MIN:MAX:N] [--ki MIN:MAX:N] [--scenario NAME]
+ *                         [--setpoint C] [--duration S] [--threads N] [--front]
+ *
+ *            One CSV line per gain set on stdout, --front keeps only the Pareto
+ *            front. Each gain set is scored on its worst zone: longest settling
+ *            time, largest overshoot, and the IAE and energy of all zones.
+ */
+
+#include "control_bench.h"
+#include "sim_plant.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private constants --------------------------------------------------------*/
+#define SWEEP_MAX_POINTS    64
+#define SWEEP_MAX_THREADS   64
+
+/* Private types ------------------------------------------------------------*/
+typedef struct {
+    float min;
+    float max;
+    uint32_t count;
+} sweep_range_t;
+
+typedef struct {
+    float kp;
+    float ki;
+    ControlMetrics_t score;
+    uint8_t front;
+} sweep_point_t;
+
+typedef struct {
+    sweep_point_t *points;
+    uint32_t count;
+    uint32_t next;              /**< Next point to run, taken under the lock */
+    pthread_mutex_t lock;
+    ControlBench_Scenario_t scenario;
+    float setpoint;
+    float duration;
+} sweep_job_t;
+
+/* Private functions --------------------------------------------------------*/
+static int sweep_parse_range(const char *text, sweep_range_t *range)
+{
+    unsigned count;
+
+    if (sscanf(text, "%f:%f:%u", &range->min, &range->max, &count) != 3 ||
+        count == 0 || count > SWEEP_MAX_POINTS || range->max < range->min) {
+        return -1;
+    }
+    range->count = count;
+    return 0;
+}
+
+static float sweep_value(const sweep_range_t *range, uint32_t i)
+{
+    if (range->count == 1) {
+        return range->min;
+    }
+    return range->min + (range->max - range->min) * (float)i / (float)(range->count - 1);
+}
+
+/**
+ * @brief Collapse the zone figures into one score, the worst zone counts
+ */
+static void sweep_score(const ControlBench_Result_t *result, ControlMetrics_t *score)
+{
+    *score = result->zone[0];
+    for (uint8_t z = 1; z < HEATERS_ZONES; z++) {
+        const ControlMetrics_t *m = &result->zone[z];
+        if (m->settling_time > score->settling_time) {
+            score->settling_time = m->settling_time;
+        }
+        if (m->overshoot > score->overshoot) {
+            score->overshoot = m->overshoot;
+        }
+        score->iae += m->iae;
+        score->energy += m->energy;
+    }
+}
+
+static void *sweep_worker(void *arg)
+{
+    sweep_job_t *job = (sweep_job_t *)arg;
+
+    for (;;) {
+        Heaters_t heaters;
+        ThermalModel_t model;
+        ControlBench_Result_t result;
+        sweep_point_t *point;
+
+        pthread_mutex_lock(&job->lock);
+        point = (job->next < job->count) ? &job->points[job->next++] : NULL;
+        pthread_mutex_unlock(&job->lock);
+        if (point == NULL) {
+            return NULL;
+        }
+
+        SimPlant_Model(&model);
+        SimPlant_Heaters(&heaters, point->kp, point->ki, 0.0f);
+        ControlBench_Run(&result, job->scenario, &heaters, NULL, NULL, &model,
+                         job->setpoint, job->duration, NULL);
+        sweep_score(&result, &point->score);
+    }
+}
+
+static void sweep_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--kp MIN:MAX:N] [--ki MIN:MAX:N] [--scenario NAME]\n"
+                    "       [--setpoint C] [--duration S] [--threads N] [--front]\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    static sweep_point_t points[SWEEP_MAX_POINTS * SWEEP_MAX_POINTS];
+    pthread_t threads[SWEEP_MAX_THREADS];
+    sweep_range_t kp = { 2.0f, 16.0f, 8 };
+    sweep_range_t ki = { 0.005f, 0.05f, 10 };
+    sweep_job_t job = {
+        .points = points,
+        .scenario = CONTROL_BENCH_SETPOINT_STEP,
+        .setpoint = 200.0f,
+        .duration = 3600.0f,
+    };
+    uint32_t workers = 4;
+    uint8_t front_only = 0;
+    uint32_t fronts = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--kp") == 0 && i + 1 < argc) {
+            if (sweep_parse_range(argv[++i], &kp) != 0) {
+                break;
+            }
+        } else if (strcmp(argv[i], "--ki") == 0 && i + 1 < argc) {
+            if (sweep_parse_range(argv[++i], &ki) != 0) {
+                break;
+            }
+        } else if (strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            uint32_t s = 0;
+            i++;
+            while (s < CONTROL_BENCH_SCENARIOS && strcmp(argv[i], ControlBench_Name(s)) != 0) {
+                s++;
+            }
+            if (s == CONTROL_BENCH_SCENARIOS) {
+                break;
+            }
+            job.scenario = (ControlBench_Scenario_t)s;
+        } else if (strcmp(argv[i], "--setpoint") == 0 && i + 1 < argc) {
+            job.setpoint = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+            job.duration = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            workers = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--front") == 0) {
+            front_only = 1;
+        } else {
+            break;
+        }
+    }
+    if (i < argc || workers == 0 || workers > SWEEP_MAX_THREADS || job.duration <= 0.0f) {
+        sweep_usage(argv[0]);
+        return 2;
+    }
+
+    for (uint32_t p = 0; p < kp.count; p++) {
+        for (uint32_t q = 0; q < ki.count; q++) {
+            points[job.count].kp = sweep_value(&kp, p);
+            points[job.count].ki = sweep_value(&ki, q);
+            job.count++;
+        }
+    }
+
+    /* Every run owns its plant and controllers, the workers only share the index */
+    pthread_mutex_init(&job.lock, NULL);
+    for (uint32_t t = 0; t < workers; t++) {
+        pthread_create(&threads[t], NULL, sweep_worker, &job);
+    }
+    for (uint32_t t = 0; t < workers; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_mutex_destroy(&job.lock);
+
+    /* Pareto front: the gain sets no other set dominates */
+    for (uint32_t a = 0; a < job.count; a++) {
+        points[a].front = 1;
+        for (uint32_t b = 0; b < job.count && points[a].front; b++) {
+            if (b != a && ControlMetrics_Dominates(&points[b].score, &points[a].score)) {
+                points[a].front = 0;
+            }
+        }
+        fronts += points[a].front;
+    }
+
+    printf("kp,ki,settling_s,overshoot_C,iae_Cs,energy_pct_s,pareto\n");
+    for (uint32_t p = 0; p < job.count; p++) {
+        const sweep_point_t *pt = &points[p];
+        if (front_only && !pt->front) {
+            continue;
+        }
+        printf("%g,%g,%.2f,%.3f,%.1f,%.0f,%u\n", pt->kp, pt->ki, pt->score.settling_time,
+               pt->score.overshoot, pt->score.iae, pt->score.energy, pt->front);
+    }
+    fprintf(stderr, "%u gain sets, %u on the Pareto front (%s, %u threads)\n",
+            (unsigned)job.count, (unsigned)fronts, ControlBench_Name(job.scenario),
+            (unsigned)workers);
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file      sim_plant.c
+ * @author    Adrian Silva Palafox
+ * @brief     Reference barrel and controller setup shared by the host tools
+ * @version   1.0
+ * @date      October 2026
+ */
+
+#include "sim_plant.h"
+#include <string.h>
+
+/* Private constants --------------------------------------------------------*/
+static const ThermalModel_Zone_t sim_zones[THERMAL_MODEL_ZONES] = {
+    { 1500.0f, 1.2f, 400.0f, 5.0f },
+    { 2000.0f, 1.5f, 400.0f, 5.0f },
+    { 2500.0f, 1.5f, 400.0f, 5.0f },
+};
+
+/* Public functions ---------------------------------------------------------*/
+void SimPlant_Model(ThermalModel_t *model)
+{
+    memset(model, 0, sizeof(*model));
+    for (uint8_t z = 0; z < THERMAL_MODEL_ZONES; z++) {
+        model->zone[z] = sim_zones[z];
+    }
+    model->coupling[0] = 1.0f;
+    model->coupling[1] = 1.0f;
+    ThermalModel_Init(model, SIM_AMBIENT);
+}
+
+void SimPlant_Heaters(Heaters_t *heaters, float kp, float ki, float kd)
+{
+    Heaters_Init(heaters, SIM_PERIOD_S);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        Heaters_ConfigureZone(heaters, z, kp, ki, kd, 1.0f, 0.0f, 100.0f, 0.0f, 100.0f);
+    }
+}
@@ -0,0 +1,42 @@
+/**
+ * @file      sim_plant.h
+ * @author    Adrian Silva Palafox
+ * @brief     Reference barrel and controller setup shared by the host tools
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   The estimated zone parameters of main.c (warmupConfig) with 1 W/°C
+ *            between neighbouring zones, and a hand-tuned reference PI gain set
+ *            for it.
+ */
+
+#ifndef HOST_SIM_PLANT_H_
+#define HOST_SIM_PLANT_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include "heaters.h"
+#include "thermal_model.h"
+
+/* Configuration Constants --------------------------------------------------*/
+#define SIM_PERIOD_S        0.25f   /**< Control period, TIM3 tick [s] */
+#define SIM_AMBIENT         25.0f   /**< Ambient temperature [°C] */
+#define SIM_KP              8.0f    /**< Reference proportional gain [%/°C] */
+#define SIM_KI              0.02f   /**< Reference integral gain [%/(°C s)] */
+
+/* Function Prototypes ------------------------------------------------------*/
+/**
+ * @brief   Fill in the reference barrel, every zone at ambient
+ * @param   model       Pointer to model structure
+ */
+void SimPlant_Model(ThermalModel_t *model);
+
+/**
+ * @brief   Configure the zone controllers with PI gains, 0..100 % output
+ * @param   heaters     Pointer to heater zones structure
+ * @param   kp          Proportional gain
+ * @param   ki          Integral gain
+ * @param   kd          Derivative gain
+ */
+void SimPlant_Heaters(Heaters_t *heaters, float kp, float ki, float kd);
+
+#endif /* HOST_SIM_PLANT_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file      thermal_sim.c
+ * @author    Adrian Silva Palafox
+ * @brief     Closed-loop barrel simulation faster than real time
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Runs the firmware zone controllers (heaters.c) against the
+ *            thermal model (thermal_model.c) at the 250 ms control period and
+ *            reports how much faster than real time it ran:
+ *
+ *              thermal_sim [--hours H] [--setpoint C] [--csv] [--min-speed X]
+ *                          [--trace FILE]
+ *
+ *            --csv prints one line per simulated minute on stdout, the
+ *            summary always goes to stderr. With --min-speed the exit status
+ *            is 1 when the run was slower than X times real time. --trace
+ *            records the thermocouple frames, zero-cross counts and control
+ *            ticks in a sensor trace, as the firmware does, and writes its
+ *            image to FILE at the end for trace_replay.
+ */
+
+#include "sim_plant.h"
+#include "max6675_model.h"
+#include "sensor_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private constants --------------------------------------------------------*/
+#define SIM_PELLET_LOAD     150.0f  /**< Feed zone load once at temperature [W] */
+#define SIM_EDGES_PER_TICK  25U     /**< 50 Hz mains, one edge per half-cycle */
+
+/* Private functions --------------------------------------------------------*/
+static double sim_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static void sim_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--hours H] [--setpoint C] [--csv] [--min-speed X] [--trace FILE]\n",
+            name);
+}
+
+static int sim_write_trace(const char *path, const SensorTrace_t *trace)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL || fwrite(trace, sizeof(*trace), 1, f) != 1) {
+        perror(path);
+        if (f != NULL) fclose(f);
+        return -1;
+    }
+    return fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    static SensorTrace_t trace;
+    const char *trace_path = NULL;
+    Heaters_t heaters;
+    ThermalModel_t model;
+    float hours = 24.0f;
+    float setpoint = 200.0f;
+    float min_speed = 0.0f;
+    uint8_t csv = 0;
+    float setpoints[HEATERS_ZONES];
+    float temps[HEATERS_ZONES];
+    uint32_t ticks;
+    double start;
+    double wall;
+    double speed;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--hours") == 0 && i + 1 < argc) {
+            hours = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--setpoint") == 0 && i + 1 < argc) {
+            setpoint = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--min-speed") == 0 && i + 1 < argc) {
+            min_speed = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            sim_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    SimPlant_Model(&model);
+    SimPlant_Heaters(&heaters, SIM_KP, SIM_KI, 0.0f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        setpoints[z] = setpoint;
+    }
+
+    if (csv) {
+        printf("time_s,temp0,temp1,temp2,power0,power1,power2\n");
+    }
+
+    SensorTrace_Init(&trace);
+    trace.enabled = (trace_path != NULL);
+
+    ticks = (uint32_t)(hours * 3600.0f / SIM_PERIOD_S + 0.5f);
+    start = sim_now();
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        /* Pellets start feeding after the first hour */
+        model.disturbance[0] = (tick * SIM_PERIOD_S >= 3600.0f) ? -SIM_PELLET_LOAD : 0.0f;
+
+        uint32_t now = (uint32_t)((uint64_t)tick * (uint64_t)(SIM_PERIOD_S * 1e6f));
+
+        for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+            temps[z] = ThermalModel_ReadSensor(&model, z);
+            SensorTrace_Record(&trace, now, SENSOR_TRACE_MAX6675, z,
+                               Max6675Model_Frame((float)model.tc_temp[z], MAX6675_MODEL_OK));
+        }
+        SensorTrace_Record(&trace, now, SENSOR_TRACE_CONTROL_TICK, 0, (uint16_t)tick);
+        Heaters_ControlStep(&heaters, setpoints, temps);
+        SensorTrace_Record(&trace, now, SENSOR_TRACE_ZERO_CROSS, 0, SIM_EDGES_PER_TICK);
+        ThermalModel_Step(&model, heaters.power, SIM_PERIOD_S);
+
+        if (csv && tick % (uint32_t)(60.0f / SIM_PERIOD_S) == 0) {
+            printf("%.0f,%.2f,%.2f,%.2f,%.1f,%.1f,%.1f\n", tick * SIM_PERIOD_S,
+                   model.tc_temp[0], model.tc_temp[1], model.tc_temp[2],
+                   heaters.power[0], heaters.power[1], heaters.power[2]);
+        }
+    }
+    wall = sim_now() - start;
+
+    speed = (wall > 0.0) ? (double)ticks * SIM_PERIOD_S / wall : 1e12;
+    fprintf(stderr, "simulated %.0f s (%u control ticks) in %.3f s: %.0fx real time\n",
+            (double)ticks * SIM_PERIOD_S, (unsigned)ticks, wall, speed);
+    fprintf(stderr, "final temperatures %.2f %.2f %.2f C\n",
+            model.tc_temp[0], model.tc_temp[1], model.tc_temp[2]);
+
+    if (trace_path != NULL && sim_write_trace(trace_path, &trace) != 0) {
+        return 1;
+    }
+    return (min_speed > 0.0f && speed < min_speed) ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file      trace_replay.c
+ * @author    Adrian Silva Palafox
+ * @brief     Replay of a sensor trace through the drivers and zone controllers
+ * @version   1.0
+ * @date      October 2026
+ *
+ * @details   Reads a SensorTrace_t image dumped from the target (see
+ *            sensor_trace.h) or written by thermal_sim --trace, and feeds its
+ *            records in order to the code that consumed them on the machine:
+ *
+ *              - MAX6675 frames through MAX6675_ProcessFrame()
+ *              - AS5048B angle registers through AS5048B_ProcessAngle()
+ *              - every control tick: Heaters_ControlStep() on the last
+ *                decoded temperatures
+ *
+ *              trace_replay IMAGE [--kp KP] [--ki KI] [--setpoint C]
+ *
+ *            Prints one CSV line per control tick on stdout and a summary on
+ *            stderr. The exit status is 1 when the image is not a trace or a
+ *            record is malformed (unknown type, channel out of range, time
+ *            going backwards).
+ *
+ *            The controllers run on the raw readings (pidRawReadings) with
+ *            the gains given here. The integrator state at the first record
+ *            is not in the trace, so the powers match the machine only for a
+ *            trace that starts at power-up, or once the integrators have
+ *            caught up.
+ */
+
+#include "sim_plant.h"
+#include "sensor_trace.h"
+#include "max6675.h"
+#include "AS5048B.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private functions --------------------------------------------------------*/
+static void replay_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s IMAGE [--kp KP] [--ki KI] [--setpoint C]\n", name);
+}
+
+static int replay_load(const char *path, SensorTrace_t *trace)
+{
+    FILE *f = fopen(path, "rb");
+    size_t n;
+
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    n = fread(trace, 1, sizeof(*trace), f);
+    fclose(f);
+    if (n != sizeof(*trace) || trace->head - trace->tail > SENSOR_TRACE_DEPTH) {
+        fprintf(stderr, "%s: not a sensor trace image\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static SensorTrace_t trace;
+    static MAX6675_Driver_t thermocouples;
+    static AS5048B_Driver_t encoders;
+    Heaters_t heaters;
+    SensorTrace_Record_t rec;
+    const char *path = NULL;
+    float kp = SIM_KP;
+    float ki = SIM_KI;
+    float setpoint = 200.0f;
+    float setpoints[HEATERS_ZONES];
+    float temps[HEATERS_ZONES] = { 0 };
+    float angle = 0.0f;
+    uint32_t edges = 0;
+    uint32_t flywheel = 0;
+    uint32_t ticks = 0;
+    uint32_t records = 0;
+    uint32_t start = 0;
+    uint32_t last = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--kp") == 0 && i + 1 < argc) {
+            kp = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--ki") == 0 && i + 1 < argc) {
+            ki = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--setpoint") == 0 && i + 1 < argc) {
+            setpoint = strtof(argv[++i], NULL);
+        } else if (path == NULL && argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            replay_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (path == NULL) {
+        replay_usage(argv[0]);
+        return 2;
+    }
+    if (replay_load(path, &trace) != 0) {
+        return 1;
+    }
+
+    SimPlant_Heaters(&heaters, kp, ki, 0.0f);
+    for (uint8_t z = 0; z < HEATERS_ZONES; z++) {
+        setpoints[z] = setpoint;
+    }
+
+    printf("time_s,tick,temp0,temp1,temp2,power0,power1,power2,angle,edges,flywheel\n");
+    while (SensorTrace_Next(&trace, &rec)) {
+        if (records++ == 0) {
+            start = rec.time;
+        } else if ((int32_t)(rec.time - last) < 0) {
+            fprintf(stderr, "record %u: time goes backwards\n", (unsigned)records);
+            return 1;
+        }
+        last = rec.time;
+
+        switch (rec.type) {
+        case SENSOR_TRACE_MAX6675:
+            if (rec.channel >= MAX6675_MAX_DEVICES) {
+                fprintf(stderr, "record %u: thermocouple %u\n", (unsigned)records, rec.channel);
+                return 1;
+            }
+            /* A rejected frame keeps the previous reading, as on the machine */
+            if (MAX6675_ProcessFrame(&thermocouples, rec.channel, rec.value) == HAL_OK &&
+                rec.channel < HEATERS_ZONES) {
+                temps[rec.channel] = thermocouples.devices[rec.channel].temperature;
+            }
+            break;
+        case SENSOR_TRACE_AS5048B: {
+            const uint8_t data[2] = { (uint8_t)(rec.value >> 8), (uint8_t)(rec.value & 0x3FU) };
+
+            if (rec.channel >= AS5048B_MAX_DEVICES) {
+                fprintf(stderr, "record %u: encoder %u\n", (unsigned)records, rec.channel);
+                return 1;
+            }
+            angle = AS5048B_ProcessAngle(&encoders, rec.channel, data);
+            break;
+        }
+        case SENSOR_TRACE_ZERO_CROSS:
+            edges += rec.value;
+            flywheel += rec.channel;
+            break;
+        case SENSOR_TRACE_CONTROL_TICK:
+            Heaters_ControlStep(&heaters, setpoints, temps);
+            printf("%.3f,%u,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%u,%u\n",
+                   (double)(rec.time - start) * 1e-6, (unsigned)rec.value,
+                   temps[0], temps[1], temps[2],
+                   heaters.power[0], heaters.power[1], heaters.power[2],
+                   angle, (unsigned)edges, (unsigned)flywheel);
+            ticks++;
+            break;
+        default:
+            fprintf(stderr, "record %u: unknown type %u\n", (unsigned)records, rec.type);
+            return 1;
+        }
+    }
+
+    fprintf(stderr, "replayed %u records, %u control ticks over %.1f s\n",
+            (unsigned)records, (unsigned)ticks, (double)(last - start) * 1e-6);
+    return 0;
+}